@@ -0,0 +1,342 @@
+#pragma once
+#ifndef ANDRES_GRAPH_ARENA_HXX
+#define ANDRES_GRAPH_ARENA_HXX
+
+#include <cassert>
+#include <cstddef>
+#include <memory> // std::shared_ptr, std::unique_ptr
+#include <type_traits> // std::true_type, std::false_type
+#include <vector>
+
+namespace andres {
+namespace graph {
+
+/// Memory arena that hands out blocks from a small number of large slabs.
+///
+/// Blocks are taken from the current slab by advancing a pointer, so that
+/// blocks allocated one after the other are contiguous in memory. Slabs grow
+/// geometrically up to a maximum size. The size of each block is rounded up
+/// to a power of two. Blocks that are freed are kept in one free list per
+/// size and are reused by subsequent allocations of the same size. Slabs are
+/// released only when the arena is destroyed, all at once.
+///
+/// An arena is not thread-safe.
+///
+class Arena {
+public:
+    Arena(const std::size_t = 1 << 16, const std::size_t = 1 << 26);
+    void* allocate(const std::size_t);
+    void deallocate(void*, const std::size_t);
+    std::size_t numberOfSlabs() const;
+    std::size_t capacity() const;
+
+private:
+    struct FreeBlock {
+        FreeBlock* next_;
+    };
+
+    Arena(const Arena&); // not copyable
+    Arena& operator=(const Arena&); // not copyable
+    static std::size_t alignment();
+    static std::size_t sizeClass(const std::size_t);
+    static std::size_t blockSize(const std::size_t);
+    char* allocateSlab(const std::size_t);
+
+    std::vector<std::unique_ptr<char[]> > slabs_;
+    std::vector<FreeBlock*> freeLists_;
+    char* begin_;
+    char* end_;
+    std::size_t slabSize_;
+    std::size_t maximumSlabSize_;
+    std::size_t capacity_;
+};
+
+/// STL-compliant allocator that takes memory from an Arena.
+///
+/// A default-constructed allocator creates a new arena. Copies of an
+/// allocator, including copies rebound to other types, share the arena.
+/// The arena is destroyed together with the last allocator that refers to it.
+/// A copy of a container, by contrast, gets an allocator with a new arena,
+/// so that containers never share an arena by being copied.
+///
+/// Graph and Digraph take an allocator as their second template parameter,
+/// e.g. Graph<IdleGraphVisitor<>, ArenaAllocator<> >, and use it for the
+/// adjacencies of all vertices. A copy of such a graph has its own arena.
+///
+template<class T = std::size_t>
+class ArenaAllocator {
+public:
+    typedef T value_type;
+    typedef T* pointer;
+    typedef const T* const_pointer;
+    typedef T& reference;
+    typedef const T& const_reference;
+    typedef std::size_t size_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef std::false_type propagate_on_container_copy_assignment;
+    typedef std::true_type propagate_on_container_move_assignment;
+    typedef std::true_type propagate_on_container_swap;
+
+    template<class U>
+    struct rebind {
+        typedef ArenaAllocator<U> other;
+    };
+
+    ArenaAllocator();
+    ArenaAllocator(const std::shared_ptr<Arena>&);
+    template<class U>
+        ArenaAllocator(const ArenaAllocator<U>&);
+    pointer allocate(const size_type);
+    void deallocate(pointer, const size_type);
+    size_type max_size() const;
+    ArenaAllocator select_on_container_copy_construction() const;
+    const std::shared_ptr<Arena>& arena() const;
+
+private:
+    std::shared_ptr<Arena> arena_;
+};
+
+template<class T, class U>
+bool operator==(const ArenaAllocator<T>&, const ArenaAllocator<U>&);
+
+template<class T, class U>
+bool operator!=(const ArenaAllocator<T>&, const ArenaAllocator<U>&);
+
+/// Construct an arena.
+///
+/// \param slabSize Size in bytes of the first slab.
+/// \param maximumSlabSize Size in bytes up to which slabs grow.
+///
+inline
+Arena::Arena(
+    const std::size_t slabSize,
+    const std::size_t maximumSlabSize
+)
+:   slabs_(),
+    freeLists_(),
+    begin_(0),
+    end_(0),
+    slabSize_(slabSize < alignment() ? alignment() : slabSize),
+    maximumSlabSize_(maximumSlabSize < slabSize_ ? slabSize_ : maximumSlabSize),
+    capacity_(0)
+{}
+
+/// Allocate a block of memory.
+///
+/// \param size Size of the block in bytes.
+/// \return Pointer to the block, aligned for any fundamental type.
+///
+inline void*
+Arena::allocate(
+    const std::size_t size
+) {
+    const std::size_t c = sizeClass(size);
+    const std::size_t bytes = blockSize(c);
+
+    // reuse a free block of the same size
+    if(c < freeLists_.size() && freeLists_[c] != 0) {
+        FreeBlock* block = freeLists_[c];
+        freeLists_[c] = block->next_;
+        return block;
+    }
+
+    // blocks larger than a slab get a slab of their own
+    if(bytes > maximumSlabSize_) {
+        return allocateSlab(bytes);
+    }
+
+    if(static_cast<std::size_t>(end_ - begin_) < bytes) {
+        while(slabSize_ < bytes) {
+            slabSize_ *= 2;
+        }
+        begin_ = allocateSlab(slabSize_);
+        end_ = begin_ + slabSize_;
+        if(slabSize_ < maximumSlabSize_) {
+            slabSize_ = slabSize_ * 2 < maximumSlabSize_ ? slabSize_ * 2 : maximumSlabSize_;
+        }
+    }
+    void* block = begin_;
+    begin_ += bytes;
+    return block;
+}
+
+/// Return a block of memory to the arena for reuse.
+///
+/// \param pointer Pointer to a block obtained from allocate().
+/// \param size Size of the block in bytes, as passed to allocate().
+///
+inline void
+Arena::deallocate(
+    void* pointer,
+    const std::size_t size
+) {
+    if(pointer == 0) {
+        return;
+    }
+    const std::size_t c = sizeClass(size);
+    if(c >= freeLists_.size()) {
+        freeLists_.resize(c + 1, 0);
+    }
+    FreeBlock* block = static_cast<FreeBlock*>(pointer);
+    block->next_ = freeLists_[c];
+    freeLists_[c] = block;
+}
+
+/// Get the number of slabs allocated so far.
+///
+inline std::size_t
+Arena::numberOfSlabs() const {
+    return slabs_.size();
+}
+
+/// Get the total size in bytes of all slabs allocated so far.
+///
+inline std::size_t
+Arena::capacity() const {
+    return capacity_;
+}
+
+// blocks are multiples of this size, which also holds a FreeBlock
+inline std::size_t
+Arena::alignment() {
+    return alignof(std::max_align_t) < sizeof(FreeBlock) ? sizeof(FreeBlock) : alignof(std::max_align_t);
+}
+
+inline std::size_t
+Arena::sizeClass(
+    const std::size_t size
+) {
+    std::size_t c = 0;
+    while(blockSize(c) < size) {
+        ++c;
+    }
+    return c;
+}
+
+inline std::size_t
+Arena::blockSize(
+    const std::size_t sizeClass
+) {
+    return alignment() << sizeClass;
+}
+
+inline char*
+Arena::allocateSlab(
+    const std::size_t size
+) {
+    slabs_.push_back(std::unique_ptr<char[]>(new char[size]));
+    capacity_ += size;
+    return slabs_.back().get();
+}
+
+/// Construct an allocator with a new arena.
+///
+template<class T>
+inline
+ArenaAllocator<T>::ArenaAllocator()
+:   arena_(new Arena())
+{}
+
+/// Construct an allocator that takes memory from a given arena.
+///
+/// \param arena Arena.
+///
+template<class T>
+inline
+ArenaAllocator<T>::ArenaAllocator(
+    const std::shared_ptr<Arena>& arena
+)
+:   arena_(arena)
+{
+    assert(arena_);
+}
+
+/// Construct an allocator that shares the arena of another allocator.
+///
+/// \param other Allocator.
+///
+template<class T>
+template<class U>
+inline
+ArenaAllocator<T>::ArenaAllocator(
+    const ArenaAllocator<U>& other
+)
+:   arena_(other.arena())
+{}
+
+/// Allocate memory for a number of objects.
+///
+/// \param n Number of objects.
+///
+template<class T>
+inline typename ArenaAllocator<T>::pointer
+ArenaAllocator<T>::allocate(
+    const size_type n
+) {
+    return static_cast<pointer>(arena_->allocate(n * sizeof(T)));
+}
+
+/// Return memory to the arena.
+///
+/// \param p Pointer obtained from allocate().
+/// \param n Number of objects, as passed to allocate().
+///
+template<class T>
+inline void
+ArenaAllocator<T>::deallocate(
+    pointer p,
+    const size_type n
+) {
+    arena_->deallocate(p, n * sizeof(T));
+}
+
+/// Get the maximum number of objects that can be allocated at once.
+///
+template<class T>
+inline typename ArenaAllocator<T>::size_type
+ArenaAllocator<T>::max_size() const {
+    return (static_cast<size_type>(-1) / 2) / sizeof(T);
+}
+
+/// Get an allocator with a new arena for a copy of a container.
+///
+template<class T>
+inline ArenaAllocator<T>
+ArenaAllocator<T>::select_on_container_copy_construction() const {
+    return ArenaAllocator<T>();
+}
+
+/// Get the arena.
+///
+template<class T>
+inline const std::shared_ptr<Arena>&
+ArenaAllocator<T>::arena() const {
+    return arena_;
+}
+
+/// Allocators are equal if they share the same arena.
+///
+template<class T, class U>
+inline bool
+operator==(
+    const ArenaAllocator<T>& a,
+    const ArenaAllocator<U>& b
+) {
+    return a.arena() == b.arena();
+}
+
+/// Allocators are unequal if they take memory from different arenas.
+///
+template<class T, class U>
+inline bool
+operator!=(
+    const ArenaAllocator<T>& a,
+    const ArenaAllocator<U>& b
+) {
+    return !(a == b);
+}
+
+} // namespace graph
+} // namespace andres
+
+#endif // #ifndef ANDRES_GRAPH_ARENA_HXX
@@ -4,12 +4,18 @@
 
 #include <cassert>
 #include <cstddef>
+#include <cstdint>
 #include <limits>
 #include <queue>
 #include <type_traits>
 #include <vector>
+#include <algorithm> // std::sort
+#include <atomic>
+#include <memory> // std::unique_ptr
 
 #include "subgraph.hxx"
+#include "for-each.hxx"
+#include "search-workspace.hxx"
 
 namespace andres {
 namespace graph {
@@ -151,26 +157,32 @@ breadthFirstSearch(
         const auto v = data.next();
         const auto depth = data.depth(v) + 1;
 
-        auto e_it = g.edgesFromVertexBegin(v);
-        for(auto it = g.verticesFromVertexBegin(v); it != g.verticesFromVertexEnd(v); ++it, ++e_it)
-            if(data.depth(*it) == BreadthFirstSearchData<std::size_t>::NOT_VISITED &&
-                subgraph_mask.vertex(*it) &&
-                subgraph_mask.edge(*e_it))
+        bool stop = false;
+        forEachAdjacency(g, v, [&](const typename GRAPH::AdjacencyType& a)
+        {
+            const std::size_t w = a.vertex();
+            if(!stop &&
+                data.depth(w) == BreadthFirstSearchData<std::size_t>::NOT_VISITED &&
+                detail::isVertexInSubgraph(subgraph_mask, w) &&
+                detail::isEdgeInSubgraph(subgraph_mask, a.edge()))
             {
                 bool proceed;
                 bool add;
 
-                callback(*it, depth, proceed, add);
+                callback(w, depth, proceed, add);
 
                 if(!proceed)
-                {
-                    data.clearQueue();
-                    return;
-                }
-
-                if(add)
-                    data.add(*it, depth);
+                    stop = true;
+                else if(add)
+                    data.add(w, depth);
             }
+        });
+
+        if(stop)
+        {
+            data.clearQueue();
+            return;
+        }
     }
 }
 
@@ -187,6 +199,591 @@ breadthFirstSearch(
     breadthFirstSearch(g, subgraph_mask, start_vertex, callback, data);
 }
 
+/// Breadth-first search with a workspace that is reused across searches.
+///
+/// The callback is called as for breadthFirstSearch with
+/// BreadthFirstSearchData. Unlike those buffers, the workspace need not be
+/// reset between searches, so that a search takes time only in the number
+/// of vertices and edges it visits. After the search, workspace.distance(v)
+/// is the depth of every vertex v that has been added.
+///
+/// \param g A graph class such as andres::Graph or andres::Digraph.
+/// \param subgraph_mask A subgraph mask such as DefaultSubgraphMask.
+/// \param start_vertex Vertex at depth 0.
+/// \param callback Function called as callback(vertex, depth, proceed, add).
+/// \param workspace Workspace, reusable across searches.
+///
+template<typename GRAPH, typename SUBGRAPH, typename CALLBACK, typename VALUE, typename QUEUE_TAG>
+inline void
+breadthFirstSearch(
+    const GRAPH& g,
+    const SUBGRAPH& subgraph_mask,
+    const std::size_t start_vertex,
+    CALLBACK&& callback,
+    SearchWorkspace<VALUE, QUEUE_TAG>& workspace
+)
+{
+    assert(start_vertex < g.numberOfVertices());
+
+    workspace.startSearch(g.numberOfVertices());
+    std::vector<std::size_t>& queue = workspace.queues_[0];
+
+    {
+        bool proceed;
+        bool add;
+        callback(start_vertex, 0, proceed, add);
+        if(!proceed) {
+            return;
+        }
+        if(add) {
+            workspace.markVisited(start_vertex);
+            workspace.distances_[start_vertex] = 0;
+            queue.push_back(start_vertex);
+        }
+    }
+    for(std::size_t head = 0; head < queue.size(); ++head) {
+        const std::size_t v = queue[head];
+        const std::size_t depth = static_cast<std::size_t>(workspace.distances_[v]) + 1;
+
+        bool stop = false;
+        forEachAdjacency(g, v, [&](const typename GRAPH::AdjacencyType& a)
+        {
+            const std::size_t w = a.vertex();
+            if(!stop &&
+                !workspace.isVisited(w) &&
+                detail::isVertexInSubgraph(subgraph_mask, w) &&
+                detail::isEdgeInSubgraph(subgraph_mask, a.edge()))
+            {
+                bool proceed;
+                bool add;
+
+                callback(w, depth, proceed, add);
+
+                if(!proceed)
+                    stop = true;
+                else if(add)
+                {
+                    workspace.markVisited(w);
+                    workspace.distances_[w] = depth;
+                    queue.push_back(w);
+                }
+            }
+        });
+
+        if(stop)
+            return;
+    }
+}
+
+template<typename GRAPH, typename CALLBACK, typename VALUE, typename QUEUE_TAG>
+inline void
+breadthFirstSearch(
+    const GRAPH& g,
+    const std::size_t start_vertex,
+    CALLBACK&& callback,
+    SearchWorkspace<VALUE, QUEUE_TAG>& workspace
+)
+{
+    breadthFirstSearch(g, DefaultSubgraphMask<>(), start_vertex, callback, workspace);
+}
+
+/// Buffers for levelSynchronousBreadthFirstSearch.
+///
+/// Like BreadthFirstSearchData, the depths of vertices are kept after a
+/// search. To search again from another vertex, either call
+/// markAllNotvisited() or reset the depths of the visited vertices.
+///
+template<typename S = std::size_t>
+class LevelSynchronousBreadthFirstSearchData {
+public:
+    typedef S size_type;
+
+    static const size_type NOT_VISITED;
+
+    LevelSynchronousBreadthFirstSearchData(const size_type);
+    template<typename GRAPH>
+        LevelSynchronousBreadthFirstSearchData(const GRAPH&);
+    void markAllNotvisited()
+        { std::fill(depth_.begin(), depth_.end(), NOT_VISITED); }
+    size_type depth(const size_type v) const
+        { return depth_[v]; }
+    size_type& depth(const size_type v)
+        { return depth_[v]; }
+
+private:
+    typedef std::uint64_t Word;
+
+    void allocate(const size_type);
+    // true if the bit was not set before
+    bool setBit(const size_type v)
+        {
+            const Word bit = Word(1) << (v % 64);
+            if(bits_[v / 64].load(std::memory_order_relaxed) & bit) {
+                return false;
+            }
+            return (bits_[v / 64].fetch_or(bit, std::memory_order_relaxed) & bit) == 0;
+        }
+    bool bit(const size_type v) const
+        { return (bits_[v / 64].load(std::memory_order_relaxed) >> (v % 64)) & 1; }
+    // clears all bits in the word of v. this is used to clear all bits of a
+    // set of vertices that has been set before, and is cheaper than clearing
+    // one bit at a time
+    void clearWord(const size_type v)
+        { bits_[v / 64].store(0, std::memory_order_relaxed); }
+
+    std::vector<size_type> depth_;
+    std::vector<size_type> frontier_;
+    std::vector<size_type> next_;
+    std::unique_ptr<std::atomic<Word>[]> bits_; // all zero between levels
+
+template<typename GRAPH, typename SUBGRAPH, typename CALLBACK, typename T>
+friend void levelSynchronousBreadthFirstSearch(const GRAPH&, const SUBGRAPH&, const std::size_t, CALLBACK&&, LevelSynchronousBreadthFirstSearchData<T>&);
+};
+template<typename S>
+   const S LevelSynchronousBreadthFirstSearchData<S>::NOT_VISITED = std::numeric_limits<S>::max();
+
+template<typename S>
+inline
+LevelSynchronousBreadthFirstSearchData<S>::LevelSynchronousBreadthFirstSearchData(
+    const size_type size
+)
+:   depth_(size, NOT_VISITED),
+    frontier_(),
+    next_(),
+    bits_()
+{
+    allocate(size);
+}
+
+template<typename S>
+template<typename GRAPH>
+inline
+LevelSynchronousBreadthFirstSearchData<S>::LevelSynchronousBreadthFirstSearchData(
+    const GRAPH& graph
+)
+:   depth_(graph.numberOfVertices(), NOT_VISITED),
+    frontier_(),
+    next_(),
+    bits_()
+{
+    allocate(graph.numberOfVertices());
+}
+
+template<typename S>
+inline void
+LevelSynchronousBreadthFirstSearchData<S>::allocate(
+    const size_type size
+) {
+    const size_type numberOfWords = (size + 63) / 64;
+    bits_.reset(new std::atomic<Word>[numberOfWords]);
+    for(size_type j = 0; j < numberOfWords; ++j) {
+        bits_[j].store(0, std::memory_order_relaxed);
+    }
+}
+
+/// Breadth-first search that visits the graph one level at a time.
+///
+/// Vertices at the same depth are discovered in parallel if OpenMP is
+/// enabled. Small levels are expanded top-down, from the vertices of the
+/// current level to their neighbors. Large levels are expanded bottom-up,
+/// with each unvisited vertex searching its neighbors for one in the
+/// current level, which inspects far fewer edges once most vertices are
+/// reached.
+///
+/// S. Beamer, K. Asanovic and D. Patterson. Direction-Optimizing
+/// Breadth-First Search. In: Proc. SC 2012
+///
+/// The callback has the same signature and semantics as for
+/// breadthFirstSearch and is called sequentially after each level is
+/// complete. Within a level, vertices are passed in ascending order, so the
+/// search is deterministic. If the callback sets proceed to false, the
+/// search stops immediately. If the callback sets add to false, no depth is
+/// recorded for the vertex and its neighbors are not explored from it. The
+/// vertex remains unvisited and is passed to the callback again if it is
+/// reached in a later level. Unlike in breadthFirstSearch, it is passed at
+/// most once per level.
+///
+/// \param g A graph class such as andres::Graph or andres::Digraph.
+/// \param subgraph_mask A subgraph mask such as DefaultSubgraphMask.
+/// \param start_vertex Vertex at depth 0.
+/// \param callback Function called as callback(vertex, depth, proceed, add).
+/// \param data Depths and buffers, reusable across searches.
+///
+template<typename GRAPH, typename SUBGRAPH, typename CALLBACK, typename S>
+inline void
+levelSynchronousBreadthFirstSearch(
+    const GRAPH& g,
+    const SUBGRAPH& subgraph_mask,
+    const std::size_t start_vertex,
+    CALLBACK&& callback,
+    LevelSynchronousBreadthFirstSearchData<S>& data
+)
+{
+    typedef typename LevelSynchronousBreadthFirstSearchData<S>::size_type size_type;
+
+    // thresholds for switching between top-down and bottom-up, from the paper
+    const std::size_t ALPHA = 14;
+    const std::size_t BETA = 24;
+
+    assert(start_vertex < g.numberOfVertices());
+    const size_type NOT_VISITED = LevelSynchronousBreadthFirstSearchData<S>::NOT_VISITED;
+    const std::ptrdiff_t numberOfVertices = g.numberOfVertices();
+    std::vector<size_type>& frontier = data.frontier_;
+    std::vector<size_type>& next = data.next_;
+    frontier.clear();
+
+    {
+        bool proceed;
+        bool add;
+        callback(start_vertex, 0, proceed, add);
+        if(!proceed || !add) {
+            return;
+        }
+        data.depth_[start_vertex] = 0;
+        frontier.push_back(start_vertex);
+    }
+
+    // estimated number of adjacencies from vertices that have not been explored
+    std::size_t unexploredDegree = 2 * g.numberOfEdges();
+    std::size_t previousFrontierSize = 0;
+    bool bottomUp = false;
+    for(size_type depth = 1; !frontier.empty(); ++depth) {
+        const std::ptrdiff_t frontierSize = frontier.size();
+        std::size_t frontierDegree = 0;
+#pragma omp parallel for reduction(+:frontierDegree)
+        for(std::ptrdiff_t j = 0; j < frontierSize; ++j) {
+            frontierDegree += g.numberOfEdgesFromVertex(frontier[j]);
+        }
+        unexploredDegree -= std::min(unexploredDegree, frontierDegree);
+        // bottom-up while the frontier grows and has many edges, e.g. not
+        // for the wavefronts of a search in a grid graph
+        if(!bottomUp && frontierDegree > unexploredDegree / ALPHA && frontier.size() > previousFrontierSize) {
+            bottomUp = true;
+        }
+        else if(bottomUp && frontier.size() < g.numberOfVertices() / BETA) {
+            bottomUp = false;
+        }
+        previousFrontierSize = frontier.size();
+
+        next.clear();
+        if(bottomUp) {
+#pragma omp parallel for
+            for(std::ptrdiff_t j = 0; j < frontierSize; ++j) {
+                data.setBit(frontier[j]);
+            }
+#pragma omp parallel
+            {
+                std::vector<size_type> discovered;
+#pragma omp for schedule(dynamic, 1024) nowait
+                for(std::ptrdiff_t v = 0; v < numberOfVertices; ++v) {
+                    if(data.depth_[v] == NOT_VISITED && detail::isVertexInSubgraph(subgraph_mask, v)) {
+                        for(auto it = g.adjacenciesToVertexBegin(v); it != g.adjacenciesToVertexEnd(v); ++it) {
+                            if(data.bit(it->vertex()) && detail::isEdgeInSubgraph(subgraph_mask, it->edge())) {
+                                discovered.push_back(v);
+                                break;
+                            }
+                        }
+                    }
+                }
+#pragma omp critical
+                next.insert(next.end(), discovered.begin(), discovered.end());
+            }
+#pragma omp parallel for
+            for(std::ptrdiff_t j = 0; j < frontierSize; ++j) {
+                data.clearWord(frontier[j]);
+            }
+        }
+        else {
+#pragma omp parallel
+            {
+                std::vector<size_type> discovered;
+#pragma omp for schedule(dynamic, 64) nowait
+                for(std::ptrdiff_t j = 0; j < frontierSize; ++j) {
+                    forEachAdjacency(g, frontier[j], [&](const typename GRAPH::AdjacencyType& a) {
+                        const std::size_t w = a.vertex();
+                        if(data.depth_[w] == NOT_VISITED &&
+                            detail::isVertexInSubgraph(subgraph_mask, w) &&
+                            detail::isEdgeInSubgraph(subgraph_mask, a.edge()) &&
+                            data.setBit(w))
+                        {
+                            discovered.push_back(w);
+                        }
+                    });
+                }
+#pragma omp critical
+                next.insert(next.end(), discovered.begin(), discovered.end());
+            }
+            const std::ptrdiff_t nextSize = next.size();
+#pragma omp parallel for
+            for(std::ptrdiff_t j = 0; j < nextSize; ++j) {
+                data.clearWord(next[j]);
+            }
+        }
+        std::sort(next.begin(), next.end());
+
+        // callbacks, and the next frontier is compacted in place
+        std::size_t nextFrontierSize = 0;
+        for(std::size_t j = 0; j < next.size(); ++j) {
+            const size_type w = next[j];
+            bool proceed;
+            bool add;
+            callback(w, depth, proceed, add);
+            if(!proceed) {
+                frontier.clear();
+                return;
+            }
+            if(add) {
+                data.depth_[w] = depth;
+                next[nextFrontierSize] = w;
+                ++nextFrontierSize;
+            }
+        }
+        next.resize(nextFrontierSize);
+        frontier.swap(next);
+    }
+}
+
+template<typename GRAPH, typename CALLBACK, typename S>
+inline void
+levelSynchronousBreadthFirstSearch(
+    const GRAPH& g,
+    const std::size_t start_vertex,
+    CALLBACK&& callback,
+    LevelSynchronousBreadthFirstSearchData<S>& data
+)
+{
+    levelSynchronousBreadthFirstSearch(g, DefaultSubgraphMask<>(), start_vertex, callback, data);
+}
+
+template<typename GRAPH, typename SUBGRAPH, typename CALLBACK>
+inline void
+levelSynchronousBreadthFirstSearch(
+    const GRAPH& g,
+    const SUBGRAPH& subgraph_mask,
+    const std::size_t start_vertex,
+    CALLBACK&& callback
+)
+{
+    LevelSynchronousBreadthFirstSearchData<std::size_t> data(g);
+    levelSynchronousBreadthFirstSearch(g, subgraph_mask, start_vertex, callback, data);
+}
+
+template<typename GRAPH, typename CALLBACK>
+inline void
+levelSynchronousBreadthFirstSearch(
+    const GRAPH& g,
+    const std::size_t start_vertex,
+    CALLBACK&& callback
+)
+{
+    LevelSynchronousBreadthFirstSearchData<std::size_t> data(g);
+    levelSynchronousBreadthFirstSearch(g, DefaultSubgraphMask<>(), start_vertex, callback, data);
+}
+
+// \cond SUPPRESS_DOXYGEN
+namespace detail {
+
+// index of the least significant bit that is set in a non-zero word
+inline std::size_t
+lowestSetBit(
+    std::uint64_t word
+) {
+    assert(word != 0);
+#if defined(__GNUC__)
+    return __builtin_ctzll(word);
+#else
+    std::size_t bit = 0;
+    for(; (word & 1) == 0; word >>= 1) {
+        ++bit;
+    }
+    return bit;
+#endif
+}
+
+} // namespace detail
+// \endcond
+
+/// Buffers for multiSourceBreadthFirstSearch, reusable across searches.
+///
+template<typename S = std::size_t>
+class MultiSourceBreadthFirstSearchData {
+public:
+    typedef S size_type;
+    typedef std::uint64_t Mask;
+
+    /// Number of sources that are searched at once.
+    static const std::size_t BATCH_SIZE = 64;
+
+    MultiSourceBreadthFirstSearchData(const size_type size)
+        :   seen_(size), visit_(size), visitNext_(size), frontier_(), next_(), touched_()
+        {}
+    template<typename GRAPH>
+    MultiSourceBreadthFirstSearchData(const GRAPH& graph)
+        :   seen_(graph.numberOfVertices()), visit_(graph.numberOfVertices()), visitNext_(graph.numberOfVertices()),
+            frontier_(), next_(), touched_()
+        {}
+
+private:
+    // one bit per source of the current batch. all zero between batches
+    std::vector<Mask> seen_;
+    std::vector<Mask> visit_;
+    std::vector<Mask> visitNext_;
+    std::vector<size_type> frontier_;
+    std::vector<size_type> next_;
+    std::vector<size_type> touched_;
+
+template<typename GRAPH, typename SUBGRAPH, typename ITERATOR, typename CALLBACK, typename T>
+friend void multiSourceBreadthFirstSearch(const GRAPH&, const SUBGRAPH&, ITERATOR, ITERATOR, const std::size_t, CALLBACK&&, MultiSourceBreadthFirstSearchData<T>&);
+};
+template<typename S>
+   const std::size_t MultiSourceBreadthFirstSearchData<S>::BATCH_SIZE;
+
+/// Breadth-first searches from many sources, up to a maximum depth.
+///
+/// Sources are searched in batches of 64. Each vertex holds a bitmask of the
+/// sources of the batch that have reached it, so that one traversal of an
+/// adjacency serves all sources whose searches reach it at the same depth.
+/// This is much faster than separate searches if the neighborhoods of the
+/// sources overlap, e.g. for sources with consecutive indices in a graph
+/// whose vertices are ordered by locality.
+///
+/// M. Then, M. Kaufmann, F. Chirigati, T.-A. Hoang-Vu, K. Pham, A. Kemper,
+/// T. Neumann and H. T. Vo. The More the Merrier: Efficient Multi-Source
+/// Graph Traversal. In: Proc. VLDB Endowment 8(4):449-460, 2014
+///
+/// The callback is called as callback(source, vertex, depth) once for every
+/// source and every vertex whose distance from the source is at most
+/// maxDepth, including the source itself at depth 0. Calls are ordered by
+/// batch, then by depth. The search from a source is independent of the
+/// other sources, but the subgraph mask applies to all.
+///
+/// \param g A graph class such as andres::Graph or andres::Digraph.
+/// \param subgraph_mask A subgraph mask such as DefaultSubgraphMask.
+/// \param sourcesBegin Random access iterator to the beginning of a sequence of source vertices.
+/// \param sourcesEnd Random access iterator to the end of the sequence.
+/// \param maxDepth Maximum depth.
+/// \param callback Function called as callback(source, vertex, depth).
+/// \param data Buffers.
+///
+template<typename GRAPH, typename SUBGRAPH, typename ITERATOR, typename CALLBACK, typename S>
+inline void
+multiSourceBreadthFirstSearch(
+    const GRAPH& g,
+    const SUBGRAPH& subgraph_mask,
+    ITERATOR sourcesBegin,
+    ITERATOR sourcesEnd,
+    const std::size_t maxDepth,
+    CALLBACK&& callback,
+    MultiSourceBreadthFirstSearchData<S>& data
+)
+{
+    typedef MultiSourceBreadthFirstSearchData<S> Data;
+    typedef typename Data::size_type size_type;
+    typedef typename Data::Mask Mask;
+
+    while(sourcesBegin != sourcesEnd) {
+        const std::size_t batchSize = std::min<std::size_t>(sourcesEnd - sourcesBegin, Data::BATCH_SIZE);
+
+        data.frontier_.clear();
+        data.touched_.clear();
+        for(std::size_t j = 0; j < batchSize; ++j) {
+            const size_type s = sourcesBegin[j];
+            assert(s < g.numberOfVertices());
+            if(data.visit_[s] == 0) {
+                data.frontier_.push_back(s);
+            }
+            data.seen_[s] |= Mask(1) << j;
+            data.visit_[s] |= Mask(1) << j;
+            callback(s, s, std::size_t(0));
+        }
+        data.touched_.insert(data.touched_.end(), data.frontier_.begin(), data.frontier_.end());
+
+        for(std::size_t depth = 1; depth <= maxDepth && !data.frontier_.empty(); ++depth) {
+            data.next_.clear();
+            for(std::size_t j = 0; j < data.frontier_.size(); ++j) {
+                const Mask visit = data.visit_[data.frontier_[j]];
+                forEachAdjacency(g, data.frontier_[j], [&](const typename GRAPH::AdjacencyType& a) {
+                    const std::size_t w = a.vertex();
+                    const Mask discovered = visit & ~data.seen_[w];
+                    if(discovered != 0 &&
+                        detail::isVertexInSubgraph(subgraph_mask, w) &&
+                        detail::isEdgeInSubgraph(subgraph_mask, a.edge()))
+                    {
+                        if(data.visitNext_[w] == 0) {
+                            data.next_.push_back(w);
+                        }
+                        data.visitNext_[w] |= discovered;
+                    }
+                });
+            }
+            for(std::size_t j = 0; j < data.frontier_.size(); ++j) {
+                data.visit_[data.frontier_[j]] = 0;
+            }
+            for(std::size_t j = 0; j < data.next_.size(); ++j) {
+                const size_type w = data.next_[j];
+                const Mask discovered = data.visitNext_[w];
+                data.seen_[w] |= discovered;
+                data.visit_[w] = discovered;
+                data.visitNext_[w] = 0;
+                for(Mask m = discovered; m != 0; m &= m - 1) {
+                    callback(static_cast<size_type>(sourcesBegin[detail::lowestSetBit(m)]), w, depth);
+                }
+            }
+            data.touched_.insert(data.touched_.end(), data.next_.begin(), data.next_.end());
+            data.frontier_.swap(data.next_);
+        }
+
+        for(std::size_t j = 0; j < data.touched_.size(); ++j) {
+            data.seen_[data.touched_[j]] = 0;
+            data.visit_[data.touched_[j]] = 0;
+        }
+        sourcesBegin += batchSize;
+    }
+}
+
+template<typename GRAPH, typename ITERATOR, typename CALLBACK, typename S>
+inline void
+multiSourceBreadthFirstSearch(
+    const GRAPH& g,
+    ITERATOR sourcesBegin,
+    ITERATOR sourcesEnd,
+    const std::size_t maxDepth,
+    CALLBACK&& callback,
+    MultiSourceBreadthFirstSearchData<S>& data
+)
+{
+    multiSourceBreadthFirstSearch(g, DefaultSubgraphMask<>(), sourcesBegin, sourcesEnd, maxDepth, callback, data);
+}
+
+template<typename GRAPH, typename SUBGRAPH, typename ITERATOR, typename CALLBACK>
+inline void
+multiSourceBreadthFirstSearch(
+    const GRAPH& g,
+    const SUBGRAPH& subgraph_mask,
+    ITERATOR sourcesBegin,
+    ITERATOR sourcesEnd,
+    const std::size_t maxDepth,
+    CALLBACK&& callback
+)
+{
+    MultiSourceBreadthFirstSearchData<std::size_t> data(g);
+    multiSourceBreadthFirstSearch(g, subgraph_mask, sourcesBegin, sourcesEnd, maxDepth, callback, data);
+}
+
+template<typename GRAPH, typename ITERATOR, typename CALLBACK>
+inline void
+multiSourceBreadthFirstSearch(
+    const GRAPH& g,
+    ITERATOR sourcesBegin,
+    ITERATOR sourcesEnd,
+    const std::size_t maxDepth,
+    CALLBACK&& callback
+)
+{
+    MultiSourceBreadthFirstSearchData<std::size_t> data(g);
+    multiSourceBreadthFirstSearch(g, DefaultSubgraphMask<>(), sourcesBegin, sourcesEnd, maxDepth, callback, data);
+}
+
 } // namespace graph
 } // namespace andres
 
@@ -0,0 +1,327 @@
+#pragma once
+#ifndef ANDRES_GRAPH_BICONNECTED_COMPONENTS_HXX
+#define ANDRES_GRAPH_BICONNECTED_COMPONENTS_HXX
+
+#include <cassert>
+#include <cstddef>
+#include <limits>
+#include <algorithm> // std::min, std::sort
+#include <utility> // std::pair
+#include <vector>
+
+#include "subgraph.hxx"
+
+namespace andres {
+namespace graph {
+
+/// Biconnected components (blocks), cut vertices and block-cut tree of an
+/// undirected graph, computed in a single depth-first search.
+///
+/// Hopcroft J. and Tarjan R. (1973). Efficient algorithms for graph manipulation.
+/// Communications of the ACM 16(6):372-378.
+///
+/// Blocks are labeled 0, 1, ... in the order in which the search completes
+/// them. A block with a single edge is a bridge. Parallel edges belong to the
+/// same block. Each self-loop is a block of its own that does not make its
+/// vertex a cut vertex and is not part of the block-cut tree.
+///
+/// The vertices of the block-cut tree are the blocks and the cut vertices.
+/// Its edges connect each block to the cut vertices it contains and are
+/// stored as pairs (block, cut vertex), sorted by block.
+///
+/// All buffers are members, so repeated calls of build() with graphs of
+/// similar size do not allocate memory.
+///
+/// Runtime complexity O(|E| + |V|).
+///
+template<class GRAPH>
+struct BiconnectedComponents {
+    typedef GRAPH Graph;
+
+    static const std::size_t NO_BLOCK;
+
+    BiconnectedComponents();
+    std::size_t build(const Graph&);
+    template<class SUBGRAPH_MASK>
+        std::size_t build(const Graph&, const SUBGRAPH_MASK&);
+    std::size_t numberOfBlocks() const;
+    std::size_t numberOfEdgesInBlock(const std::size_t) const;
+    std::vector<std::size_t>::const_iterator edgesOfBlockBegin(const std::size_t) const;
+    std::vector<std::size_t>::const_iterator edgesOfBlockEnd(const std::size_t) const;
+    bool isBridge(const std::size_t) const;
+    bool isCutVertex(const std::size_t) const;
+
+    /// block of each edge, NO_BLOCK for edges not in the subgraph
+    std::vector<std::size_t> blockOfEdge_;
+    /// 1 for each cut vertex, 0 otherwise
+    std::vector<char> isCutVertex_;
+    /// edges (block, cut vertex) of the block-cut tree
+    std::vector<std::pair<std::size_t, std::size_t> > blockCutTree_;
+
+private:
+    typedef typename Graph::AdjacencyIterator AdjacencyIterator;
+
+    std::size_t numberOfBlocks_;
+    std::vector<std::size_t> blockEdgeOffsets_;
+    std::vector<std::size_t> blockEdges_;
+    std::vector<std::size_t> blockVertex_; // vertex at which the search completed each block, if not a self-loop
+    std::vector<std::size_t> depth_;
+    std::vector<std::size_t> low_;
+    std::vector<std::size_t> parentEdge_;
+    std::vector<std::size_t> parentVertex_;
+    std::vector<AdjacencyIterator> nextAdjacency_;
+    std::vector<std::size_t> vertexStack_;
+    std::vector<std::size_t> edgeStack_;
+};
+
+template<class GRAPH>
+const std::size_t BiconnectedComponents<GRAPH>::NO_BLOCK = std::numeric_limits<std::size_t>::max();
+
+template<class GRAPH>
+inline
+BiconnectedComponents<GRAPH>::BiconnectedComponents()
+:   blockOfEdge_(),
+    isCutVertex_(),
+    blockCutTree_(),
+    numberOfBlocks_(0)
+{}
+
+/// Find the blocks and cut vertices of a graph.
+///
+/// \param graph An undirected graph.
+/// \return Number of blocks.
+///
+template<class GRAPH>
+inline std::size_t
+BiconnectedComponents<GRAPH>::build(
+    const Graph& graph
+) {
+    return build(graph, DefaultSubgraphMask<>());
+}
+
+/// Find the blocks and cut vertices of a subgraph of a graph.
+///
+/// \param graph An undirected graph.
+/// \param mask A subgraph mask such as DefaultSubgraphMask.
+/// \return Number of blocks.
+///
+template<class GRAPH>
+template<class SUBGRAPH_MASK>
+inline std::size_t
+BiconnectedComponents<GRAPH>::build(
+    const Graph& graph,
+    const SUBGRAPH_MASK& mask
+) {
+    const std::size_t NOT_VISITED = std::numeric_limits<std::size_t>::max();
+    const std::size_t NO_EDGE = std::numeric_limits<std::size_t>::max();
+    const std::size_t NO_VERTEX = std::numeric_limits<std::size_t>::max();
+
+    blockOfEdge_.assign(graph.numberOfEdges(), NO_BLOCK);
+    isCutVertex_.assign(graph.numberOfVertices(), 0);
+    blockCutTree_.clear();
+    blockVertex_.clear();
+    depth_.assign(graph.numberOfVertices(), NOT_VISITED);
+    low_.resize(graph.numberOfVertices());
+    parentEdge_.resize(graph.numberOfVertices());
+    parentVertex_.resize(graph.numberOfVertices());
+    nextAdjacency_.resize(graph.numberOfVertices());
+    vertexStack_.clear();
+    edgeStack_.clear();
+    numberOfBlocks_ = 0;
+
+    for(std::size_t root = 0; root < graph.numberOfVertices(); ++root) {
+        if(depth_[root] != NOT_VISITED || !detail::isVertexInSubgraph(mask, root)) {
+            continue;
+        }
+
+        std::size_t numberOfRootChildren = 0;
+        depth_[root] = 0;
+        low_[root] = 0;
+        parentEdge_[root] = NO_EDGE;
+        nextAdjacency_[root] = graph.adjacenciesFromVertexBegin(root);
+        vertexStack_.push_back(root);
+
+        while(!vertexStack_.empty()) {
+            const std::size_t v = vertexStack_.back();
+            if(nextAdjacency_[v] != graph.adjacenciesFromVertexEnd(v)) {
+                const std::size_t e = nextAdjacency_[v]->edge();
+                const std::size_t w = nextAdjacency_[v]->vertex();
+                ++nextAdjacency_[v];
+
+                if(e == parentEdge_[v]
+                || !detail::isEdgeInSubgraph(mask, e)
+                || !detail::isVertexInSubgraph(mask, w)) {
+                    continue;
+                }
+                if(w == v) { // self-loop
+                    blockOfEdge_[e] = numberOfBlocks_;
+                    blockVertex_.push_back(NO_VERTEX);
+                    ++numberOfBlocks_;
+                }
+                else if(depth_[w] == NOT_VISITED) { // tree edge
+                    depth_[w] = depth_[v] + 1;
+                    low_[w] = depth_[w];
+                    parentEdge_[w] = e;
+                    parentVertex_[w] = v;
+                    nextAdjacency_[w] = graph.adjacenciesFromVertexBegin(w);
+                    edgeStack_.push_back(e);
+                    vertexStack_.push_back(w);
+                }
+                else if(depth_[w] < depth_[v]) { // back edge to an ancestor
+                    low_[v] = std::min(low_[v], depth_[w]);
+                    edgeStack_.push_back(e);
+                }
+                // edges to descendants have been pushed as back edges before
+            }
+            else {
+                vertexStack_.pop_back();
+                if(parentEdge_[v] == NO_EDGE) {
+                    continue;
+                }
+                const std::size_t u = parentVertex_[v];
+                low_[u] = std::min(low_[u], low_[v]);
+                if(low_[v] >= depth_[u]) {
+                    // u separates the subtree of v: its edges form a block
+                    std::size_t e;
+                    do {
+                        e = edgeStack_.back();
+                        edgeStack_.pop_back();
+                        blockOfEdge_[e] = numberOfBlocks_;
+                    } while(e != parentEdge_[v]);
+                    blockVertex_.push_back(u);
+                    ++numberOfBlocks_;
+
+                    if(u == root) {
+                        ++numberOfRootChildren;
+                    }
+                    else {
+                        isCutVertex_[u] = 1;
+                    }
+                }
+            }
+        }
+        assert(edgeStack_.empty());
+        if(numberOfRootChildren >= 2) {
+            isCutVertex_[root] = 1;
+        }
+    }
+
+    // block-cut tree: each block contains the vertex at which it was
+    // completed, and each cut vertex other than a root of the search also
+    // belongs to the block of the edge to its parent
+    for(std::size_t block = 0; block < numberOfBlocks_; ++block) {
+        const std::size_t u = blockVertex_[block];
+        if(u != NO_VERTEX && isCutVertex_[u]) {
+            blockCutTree_.push_back(std::make_pair(block, u));
+        }
+    }
+    for(std::size_t v = 0; v < graph.numberOfVertices(); ++v) {
+        if(isCutVertex_[v] && depth_[v] != 0) {
+            blockCutTree_.push_back(std::make_pair(blockOfEdge_[parentEdge_[v]], v));
+        }
+    }
+    std::sort(blockCutTree_.begin(), blockCutTree_.end());
+
+    // edges of each block, by counting sort
+    blockEdgeOffsets_.assign(numberOfBlocks_ + 1, 0);
+    for(std::size_t e = 0; e < blockOfEdge_.size(); ++e) {
+        if(blockOfEdge_[e] != NO_BLOCK) {
+            ++blockEdgeOffsets_[blockOfEdge_[e] + 1];
+        }
+    }
+    for(std::size_t block = 0; block < numberOfBlocks_; ++block) {
+        blockEdgeOffsets_[block + 1] += blockEdgeOffsets_[block];
+    }
+    blockEdges_.resize(blockEdgeOffsets_.back());
+    for(std::size_t e = 0; e < blockOfEdge_.size(); ++e) {
+        if(blockOfEdge_[e] != NO_BLOCK) {
+            blockEdges_[blockEdgeOffsets_[blockOfEdge_[e]]++] = e;
+        }
+    }
+    for(std::size_t block = numberOfBlocks_; block > 0; --block) {
+        blockEdgeOffsets_[block] = blockEdgeOffsets_[block - 1];
+    }
+    blockEdgeOffsets_[0] = 0;
+
+    return numberOfBlocks_;
+}
+
+/// Get the number of blocks.
+///
+template<class GRAPH>
+inline std::size_t
+BiconnectedComponents<GRAPH>::numberOfBlocks() const {
+    return numberOfBlocks_;
+}
+
+/// Get the number of edges in a block.
+///
+/// \param block Integer index of a block.
+///
+template<class GRAPH>
+inline std::size_t
+BiconnectedComponents<GRAPH>::numberOfEdgesInBlock(
+    const std::size_t block
+) const {
+    assert(block < numberOfBlocks_);
+    return blockEdgeOffsets_[block + 1] - blockEdgeOffsets_[block];
+}
+
+/// Get an iterator to the beginning of the sequence of edges in a block,
+/// in ascending order.
+///
+/// \param block Integer index of a block.
+///
+template<class GRAPH>
+inline std::vector<std::size_t>::const_iterator
+BiconnectedComponents<GRAPH>::edgesOfBlockBegin(
+    const std::size_t block
+) const {
+    assert(block < numberOfBlocks_);
+    return blockEdges_.begin() + blockEdgeOffsets_[block];
+}
+
+/// Get an iterator to the end of the sequence of edges in a block.
+///
+/// \param block Integer index of a block.
+///
+template<class GRAPH>
+inline std::vector<std::size_t>::const_iterator
+BiconnectedComponents<GRAPH>::edgesOfBlockEnd(
+    const std::size_t block
+) const {
+    assert(block < numberOfBlocks_);
+    return blockEdges_.begin() + blockEdgeOffsets_[block + 1];
+}
+
+/// Indicate if an edge is a bridge, i.e. the only edge of its block.
+///
+/// \param edge Integer index of an edge.
+///
+template<class GRAPH>
+inline bool
+BiconnectedComponents<GRAPH>::isBridge(
+    const std::size_t edge
+) const {
+    const std::size_t block = blockOfEdge_[edge];
+    return block != NO_BLOCK
+        && blockVertex_[block] != std::numeric_limits<std::size_t>::max()
+        && numberOfEdgesInBlock(block) == 1;
+}
+
+/// Indicate if a vertex is a cut vertex (articulation point).
+///
+/// \param vertex Integer index of a vertex.
+///
+template<class GRAPH>
+inline bool
+BiconnectedComponents<GRAPH>::isCutVertex(
+    const std::size_t vertex
+) const {
+    return isCutVertex_[vertex] != 0;
+}
+
+} // namespace graph
+} // namespace andres
+
+#endif // #ifndef ANDRES_GRAPH_BICONNECTED_COMPONENTS_HXX
@@ -2,9 +2,11 @@
 #ifndef ANDRES_GRAPH_BRIDGES_HXX
 #define ANDRES_GRAPH_BRIDGES_HXX
 
+#include <cstddef>
 #include <stack>
 #include <vector>
 #include "subgraph.hxx"
+#include "detail/spanning-forest.hxx"
 
 namespace andres {
 namespace graph {
@@ -23,6 +25,20 @@ struct BridgesBuffers
     std::vector<char> visited_;
 };
 
+/// Buffers for the parallel algorithm of Tarjan and Vishkin.
+///
+/// Passing these buffers to findBridges selects the parallel algorithm.
+///
+template<class GRAPH>
+struct ParallelBridgesBuffers
+{
+    typedef GRAPH GraphType;
+
+    ParallelBridgesBuffers(const GraphType&);
+
+    detail::SpanningForestIntervals<GRAPH> forest_;
+};
+
 template<typename GRAPH, typename ARRAY>
 inline void
 findBridges(
@@ -74,6 +90,23 @@ findBridges(
     BridgesBuffers<GRAPH>&
 );
 
+template<typename GRAPH, typename ARRAY>
+inline void
+findBridges(
+    const GRAPH&,
+    ARRAY&,
+    ParallelBridgesBuffers<GRAPH>&
+);
+
+template<typename GRAPH, typename SUBGRAPH, typename ARRAY>
+inline void
+findBridges(
+    const GRAPH&,
+    const SUBGRAPH&,
+    ARRAY&,
+    ParallelBridgesBuffers<GRAPH>&
+);
+
 template<typename GRAPH>
 BridgesBuffers<GRAPH>::BridgesBuffers(const GraphType& graph) :
     depth_(graph.numberOfVertices()),
@@ -83,6 +116,11 @@ BridgesBuffers<GRAPH>::BridgesBuffers(const GraphType& graph) :
     visited_(graph.numberOfVertices())
 {}
 
+template<typename GRAPH>
+ParallelBridgesBuffers<GRAPH>::ParallelBridgesBuffers(const GraphType& graph) :
+    forest_(graph)
+{}
+
 /// \brief Find, by Tarjan's algorithm, bridges (cut edges) in an undirected graph.
 ///
 /// Tarjan, R. (1974). A note on finding the bridges of a graph.
@@ -292,6 +330,79 @@ findBridges(
     }
 }
 
+/// \brief Find, by the parallel algorithm of Tarjan and Vishkin, bridges (cut edges) in an undirected graph.
+///
+/// R. E. Tarjan and U. Vishkin. An Efficient Parallel Biconnectivity Algorithm.
+/// SIAM Journal on Computing 14(4):862-874. 1985
+///
+/// Runtime complexity O(|E| + |V|). Edges are processed in parallel if OpenMP is enabled.
+///
+/// \param graph An undirected graph.
+/// \param is_bridge Array storing 1 for each edge-index if it is a bridge, or 0 otherwise.
+/// \param buffer A pre-allocated buffer object.
+///
+template<typename GRAPH, typename ARRAY>
+inline void
+findBridges(
+    const GRAPH& graph,
+    ARRAY& is_bridge,
+    ParallelBridgesBuffers<GRAPH>& buffer
+)
+{
+    findBridges(graph, DefaultSubgraphMask<>(), is_bridge, buffer);
+}
+
+/// \brief Find, by the parallel algorithm of Tarjan and Vishkin, bridges (cut edges) in a subgraph of an undirected graph.
+///
+/// R. E. Tarjan and U. Vishkin. An Efficient Parallel Biconnectivity Algorithm.
+/// SIAM Journal on Computing 14(4):862-874. 1985
+///
+/// A breadth-first spanning forest is searched level by level. The tree edge
+/// from a vertex to its parent is a bridge if and only if no non-tree edge
+/// joins the subtree of the vertex to a vertex outside this subtree, which is
+/// decided from the range of preorder numbers reached from the subtree.
+/// Unlike the sequential algorithm, this distinguishes parallel edges, none
+/// of which is a bridge.
+///
+/// Runtime complexity O(|E| + |V|). Edges are processed in parallel if OpenMP is enabled.
+///
+/// \param graph An undirected graph.
+/// \param subgraph_mask Mask defining the subgraph.
+/// \param is_bridge Array storing 1 for each edge-index if it is a bridge, or 0 otherwise.
+/// \param buffer A pre-allocated buffer object.
+///
+template<typename GRAPH, typename SUBGRAPH, typename ARRAY>
+inline void
+findBridges(
+    const GRAPH& graph,
+    const SUBGRAPH& subgraph_mask,
+    ARRAY& is_bridge,
+    ParallelBridgesBuffers<GRAPH>& buffer
+)
+{
+    auto& forest = buffer.forest_;
+    forest.build(graph, subgraph_mask);
+
+    const std::ptrdiff_t numberOfEdges = graph.numberOfEdges();
+#pragma omp parallel for
+    for (std::ptrdiff_t e = 0; e < numberOfEdges; ++e)
+        if (
+            detail::isEdgeInSubgraph(subgraph_mask, e) &&
+            forest.isInForest(graph.vertexOfEdge(e, 0)) &&
+            forest.isInForest(graph.vertexOfEdge(e, 1))
+            )
+            is_bridge[e] = 0;
+
+    const std::ptrdiff_t numberOfVertices = forest.levels_.size();
+#pragma omp parallel for
+    for (std::ptrdiff_t j = 0; j < numberOfVertices; ++j)
+    {
+        auto v = forest.levels_[j];
+        if (!forest.isRoot(v) && forest.low_[v] >= forest.preorder_[v] && forest.high_[v] < forest.preorder_[v] + forest.size_[v])
+            is_bridge[forest.parentEdge_[v]] = 1;
+    }
+}
+
 }
 }
 
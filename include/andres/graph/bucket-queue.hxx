@@ -0,0 +1,325 @@
+#pragma once
+#ifndef ANDRES_GRAPH_BUCKET_QUEUE_HXX
+#define ANDRES_GRAPH_BUCKET_QUEUE_HXX
+
+#include <cassert>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+namespace andres {
+namespace graph {
+
+/// Monotone priority queue of integer items with small integral keys.
+///
+/// Dial R. B. (1969). Algorithm 360: Shortest-path forest with topological
+/// ordering. Communications of the ACM 12(11):632-633.
+///
+/// Items are kept in one bucket per key, in a circular array of buckets that
+/// spans the keys from the key popped last to the largest key contained.
+/// The array is doubled whenever a key does not fit. For Dijkstra's
+/// algorithm with integral edge weights of at most C, it holds O(C) buckets.
+///
+/// The queue is monotone: No key may be smaller than the key of the item
+/// popped last or, before the first pop after construction or clear(),
+/// than the first key pushed.
+///
+/// Runtime complexity O(1) for push and decreaseKey. Popping scans the
+/// buckets up to the next key contained, so a Dijkstra search costs
+/// O(|E| + D) for a largest distance D.
+///
+/// \tparam VALUE Integral type of keys.
+///
+template<class VALUE>
+class BucketQueue {
+public:
+    typedef VALUE Value;
+
+    static const std::size_t NOT_IN_QUEUE;
+
+    BucketQueue(const std::size_t = 0);
+    void resize(const std::size_t);
+    void clear();
+    bool empty() const
+        { return size_ == 0; }
+    std::size_t size() const
+        { return size_; }
+    std::size_t numberOfItems() const
+        { return keys_.size(); }
+    std::size_t numberOfBuckets() const
+        { return buckets_.size(); }
+    bool contains(const std::size_t item) const
+        { return previous_[item] != NOT_IN_QUEUE; }
+    std::size_t top() const;
+    Value topKey() const;
+    Value key(const std::size_t) const;
+    void push(const std::size_t, const Value);
+    void decreaseKey(const std::size_t, const Value);
+    bool pushOrDecreaseKey(const std::size_t, const Value);
+    void pop();
+
+private:
+    static const std::size_t HEAD; // previous_ of the first item in a bucket
+
+    std::size_t bucketIndex(const Value key) const
+        { return static_cast<std::size_t>(key) & (buckets_.size() - 1); }
+    void link(const std::size_t);
+    void unlink(const std::size_t);
+    void grow(const Value);
+
+    std::vector<Value> keys_;
+    std::vector<std::size_t> next_; // in the same bucket
+    std::vector<std::size_t> previous_; // in the same bucket
+    std::vector<std::size_t> buckets_; // first item, size a power of 2
+    std::size_t size_;
+    bool started_; // base_ is set
+    Value base_; // no key is smaller
+    Value minimum_; // smallest key contained
+};
+
+template<class VALUE>
+const std::size_t BucketQueue<VALUE>::NOT_IN_QUEUE = std::numeric_limits<std::size_t>::max();
+
+template<class VALUE>
+const std::size_t BucketQueue<VALUE>::HEAD = std::numeric_limits<std::size_t>::max() - 1;
+
+/// Construct an empty queue.
+///
+/// \param numberOfItems Number of items that can be pushed.
+///
+template<class VALUE>
+inline
+BucketQueue<VALUE>::BucketQueue(
+    const std::size_t numberOfItems
+)
+:   keys_(numberOfItems),
+    next_(numberOfItems),
+    previous_(numberOfItems, NOT_IN_QUEUE),
+    buckets_(1, NOT_IN_QUEUE),
+    size_(0),
+    started_(false),
+    base_(),
+    minimum_()
+{
+    static_assert(std::is_integral<VALUE>::value, "BucketQueue requires integral keys.");
+}
+
+/// Set the number of items that can be pushed.
+///
+/// Items that are dropped must not be contained in the queue.
+///
+/// \param numberOfItems Number of items.
+///
+template<class VALUE>
+inline void
+BucketQueue<VALUE>::resize(
+    const std::size_t numberOfItems
+) {
+    keys_.resize(numberOfItems);
+    next_.resize(numberOfItems);
+    previous_.resize(numberOfItems, NOT_IN_QUEUE);
+}
+
+/// Remove all items and forget the key popped last.
+///
+/// Runtime complexity O(size() + numberOfBuckets()).
+///
+template<class VALUE>
+inline void
+BucketQueue<VALUE>::clear() {
+    if(size_ != 0) {
+        for(std::size_t j = 0; j < buckets_.size(); ++j) {
+            for(std::size_t item = buckets_[j]; item != NOT_IN_QUEUE; item = next_[item]) {
+                previous_[item] = NOT_IN_QUEUE;
+            }
+            buckets_[j] = NOT_IN_QUEUE;
+        }
+        size_ = 0;
+    }
+    started_ = false;
+}
+
+/// Get an item of smallest key.
+///
+template<class VALUE>
+inline std::size_t
+BucketQueue<VALUE>::top() const {
+    assert(!empty());
+    return buckets_[bucketIndex(minimum_)];
+}
+
+/// Get the smallest key.
+///
+template<class VALUE>
+inline typename BucketQueue<VALUE>::Value
+BucketQueue<VALUE>::topKey() const {
+    assert(!empty());
+    return minimum_;
+}
+
+/// Get the key of a contained item.
+///
+/// \param item Item.
+///
+template<class VALUE>
+inline typename BucketQueue<VALUE>::Value
+BucketQueue<VALUE>::key(
+    const std::size_t item
+) const {
+    assert(contains(item));
+    return keys_[item];
+}
+
+/// Insert an item that is not contained in the queue.
+///
+/// \param item Item.
+/// \param key Key not smaller than the key popped last.
+///
+template<class VALUE>
+inline void
+BucketQueue<VALUE>::push(
+    const std::size_t item,
+    const Value key
+) {
+    assert(item < numberOfItems());
+    assert(!contains(item));
+    if(!started_) {
+        base_ = key;
+        started_ = true;
+    }
+    assert(!(key < base_));
+    if(static_cast<std::size_t>(key - base_) >= buckets_.size()) {
+        grow(key);
+    }
+    if(size_ == 0 || key < minimum_) {
+        minimum_ = key;
+    }
+    keys_[item] = key;
+    link(item);
+    ++size_;
+}
+
+/// Decrease the key of a contained item.
+///
+/// \param item Item.
+/// \param key Key not greater than the current key of the item and not
+///     smaller than the key popped last.
+///
+template<class VALUE>
+inline void
+BucketQueue<VALUE>::decreaseKey(
+    const std::size_t item,
+    const Value key
+) {
+    assert(contains(item));
+    assert(!(keys_[item] < key));
+    assert(!(key < base_));
+    unlink(item);
+    keys_[item] = key;
+    link(item);
+    if(key < minimum_) {
+        minimum_ = key;
+    }
+}
+
+/// Insert an item or, if it is contained, decrease its key.
+///
+/// \param item Item.
+/// \param key Key.
+/// \return false if the item is contained with a key that is not greater.
+///
+template<class VALUE>
+inline bool
+BucketQueue<VALUE>::pushOrDecreaseKey(
+    const std::size_t item,
+    const Value key
+) {
+    if(!contains(item)) {
+        push(item, key);
+        return true;
+    }
+    else if(key < keys_[item]) {
+        decreaseKey(item, key);
+        return true;
+    }
+    else {
+        return false;
+    }
+}
+
+/// Remove an item of smallest key.
+///
+template<class VALUE>
+inline void
+BucketQueue<VALUE>::pop() {
+    assert(!empty());
+    unlink(top());
+    --size_;
+    base_ = minimum_;
+    if(size_ != 0) {
+        // all keys are smaller than base_ + buckets_.size()
+        while(buckets_[bucketIndex(minimum_)] == NOT_IN_QUEUE) {
+            ++minimum_;
+        }
+    }
+}
+
+template<class VALUE>
+inline void
+BucketQueue<VALUE>::link(
+    const std::size_t item
+) {
+    std::size_t& first = buckets_[bucketIndex(keys_[item])];
+    next_[item] = first;
+    previous_[item] = HEAD;
+    if(first != NOT_IN_QUEUE) {
+        previous_[first] = item;
+    }
+    first = item;
+}
+
+template<class VALUE>
+inline void
+BucketQueue<VALUE>::unlink(
+    const std::size_t item
+) {
+    if(previous_[item] == HEAD) {
+        buckets_[bucketIndex(keys_[item])] = next_[item];
+    }
+    else {
+        next_[previous_[item]] = next_[item];
+    }
+    if(next_[item] != NOT_IN_QUEUE) {
+        previous_[next_[item]] = previous_[item];
+    }
+    previous_[item] = NOT_IN_QUEUE;
+}
+
+// double the number of buckets until a key fits
+template<class VALUE>
+inline void
+BucketQueue<VALUE>::grow(
+    const Value key
+) {
+    std::vector<std::size_t> items;
+    items.reserve(size_);
+    for(std::size_t j = 0; j < buckets_.size(); ++j) {
+        for(std::size_t item = buckets_[j]; item != NOT_IN_QUEUE; item = next_[item]) {
+            items.push_back(item);
+        }
+    }
+    std::size_t numberOfBuckets = buckets_.size();
+    while(numberOfBuckets <= static_cast<std::size_t>(key - base_)) {
+        numberOfBuckets *= 2;
+    }
+    buckets_.assign(numberOfBuckets, NOT_IN_QUEUE);
+    for(std::size_t j = 0; j < items.size(); ++j) {
+        link(items[j]);
+    }
+}
+
+} // namespace graph
+} // namespace andres
+
+#endif // #ifndef ANDRES_GRAPH_BUCKET_QUEUE_HXX
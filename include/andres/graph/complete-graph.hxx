@@ -13,6 +13,30 @@
 namespace andres {
 namespace graph {
 
+// \cond SUPPRESS_DOXYGEN
+namespace detail {
+
+// largest integer r such that r * r <= x, for x < 2^62. the floating point
+// square root is only a first guess that is corrected in integer
+// arithmetic, so the result is exact also where a double cannot represent x.
+inline std::size_t
+integerSquareRoot(
+    const std::size_t x
+) {
+    assert(static_cast<unsigned long long>(x) < (1ULL << 62));
+    std::size_t r = static_cast<std::size_t>(std::sqrt(static_cast<double>(x)));
+    while(r * r > x) {
+        --r;
+    }
+    while((r + 1) * (r + 1) <= x) {
+        ++r;
+    }
+    return r;
+}
+
+} // namespace detail
+// \endcond
+
 /// Complete graph.
 template<typename VISITOR = IdleGraphVisitor<std::size_t> >
 class CompleteGraph {
@@ -160,6 +184,12 @@ public:
     std::pair<bool, std::size_t> findEdge(const std::size_t, const std::size_t) const;
     bool multipleEdgesEnabled() const;
 
+    // blocked access
+    template<class FUNCTION>
+        void forEachAdjacency(const std::size_t, FUNCTION) const;
+    template<class FUNCTION>
+        void forEachEdge(FUNCTION) const;
+
 private:
     std::size_t edgeOfStrictlyIncreasingPairOfVertices(const std::size_t, const std::size_t) const;
 
@@ -462,9 +492,12 @@ CompleteGraph<VISITOR>::vertexOfEdge(
 ) const {
     assert(edge < numberOfEdges());
     assert(j < 2);
-    double p = static_cast<double>(numberOfVertices() * 2 - 1) / 2;
-    double q = static_cast<double>(edge) * 2;
-    std::size_t vertex0 = static_cast<std::size_t>(p - std::sqrt(p * p - q));
+
+    // counted from the last edge, the rows of edges have lengths 1, 2, ...,
+    // so the row is the inverse of the triangular number of that count
+    const std::size_t reverseEdge = numberOfEdges() - 1 - edge;
+    const std::size_t reverseRow = (detail::integerSquareRoot(8 * reverseEdge + 1) - 1) / 2;
+    const std::size_t vertex0 = numberOfVertices() - 2 - reverseRow;
     if(j == 0) {
         return vertex0;
     }
@@ -636,6 +669,67 @@ CompleteGraph<VISITOR>::multipleEdgesEnabled() const {
     return false;
 }
 
+/// Call a function for each adjacency of a vertex.
+///
+/// The adjacencies are visited in the same order as by the
+/// AdjacencyIterator. The index of each edge is obtained from that of the
+/// previous one by an addition.
+///
+/// \param vertex Integer index of a vertex.
+/// \param f Function that is called with an AdjacencyType for each
+/// adjacency.
+///
+template<typename VISITOR>
+template<class FUNCTION>
+inline void
+CompleteGraph<VISITOR>::forEachAdjacency(
+    const std::size_t vertex,
+    FUNCTION f
+) const {
+    assert(vertex < numberOfVertices());
+
+    // edges (w, vertex) for w < vertex, one in each row
+    std::size_t edge = vertex - 1;
+    for(std::size_t w = 0; w < vertex; ++w) {
+        assert(edge == edgeOfStrictlyIncreasingPairOfVertices(w, vertex));
+        f(AdjacencyType(w, edge));
+        edge += numberOfVertices() - w - 2;
+    }
+
+    // edges (vertex, w) for w > vertex, contiguous in the row of vertex
+    if(vertex + 1 < numberOfVertices()) {
+        edge = edgeOfStrictlyIncreasingPairOfVertices(vertex, vertex + 1);
+        for(std::size_t w = vertex + 1; w < numberOfVertices(); ++w, ++edge) {
+            f(AdjacencyType(w, edge));
+        }
+    }
+}
+
+/// Call a function for each edge, in the order of edge indices.
+///
+/// Edges are enumerated row by row, i.e. all edges (v0, v1) with v1 > v0
+/// for one vertex v0 at a time, such that no arithmetic is needed to
+/// recover their vertices.
+///
+/// \param f Function that is called with the integer index of the edge and
+/// the integer indices of its first and second vertex, i.e.
+/// f(edge, vertexOfEdge(edge, 0), vertexOfEdge(edge, 1)).
+///
+template<typename VISITOR>
+template<class FUNCTION>
+inline void
+CompleteGraph<VISITOR>::forEachEdge(
+    FUNCTION f
+) const {
+    std::size_t edge = 0;
+    for(std::size_t vertex0 = 0; vertex0 < numberOfVertices(); ++vertex0) {
+        for(std::size_t vertex1 = vertex0 + 1; vertex1 < numberOfVertices(); ++vertex1, ++edge) {
+            f(edge, vertex0, vertex1);
+        }
+    }
+    assert(edge == numberOfEdges());
+}
+
 // private
 template<typename VISITOR>
 inline std::size_t
@@ -5,7 +5,9 @@
 #include <cstddef>
 #include <vector>
 #include <queue>
-#include <algorithm> // std::fill
+#include <algorithm> // std::fill, std::swap
+#include <atomic>
+#include <memory> // std::unique_ptr
 
 #include "andres/partition.hxx"
 
@@ -14,6 +16,57 @@
 namespace andres {
 namespace graph {
 
+// \cond SUPPRESS_DOXYGEN
+namespace detail {
+
+// find with path halving in disjoint sets whose roots are their smallest
+// elements. as parents never have larger indices than their children,
+// concurrent updates only ever shorten paths.
+inline std::size_t
+findConcurrently(
+    std::atomic<std::size_t>* parents,
+    std::size_t vertex
+) {
+    std::size_t parent = parents[vertex].load(std::memory_order_relaxed);
+    while(parent != vertex) {
+        const std::size_t grandparent = parents[parent].load(std::memory_order_relaxed);
+        if(grandparent != parent) {
+            parents[vertex].compare_exchange_weak(parent, grandparent, std::memory_order_relaxed);
+        }
+        vertex = grandparent;
+        parent = parents[vertex].load(std::memory_order_relaxed);
+    }
+    return vertex;
+}
+
+// union that may run concurrently with other unions and finds
+inline void
+mergeConcurrently(
+    std::atomic<std::size_t>* parents,
+    std::size_t vertex0,
+    std::size_t vertex1
+) {
+    for(;;) {
+        vertex0 = findConcurrently(parents, vertex0);
+        vertex1 = findConcurrently(parents, vertex1);
+        if(vertex0 == vertex1) {
+            return;
+        }
+        if(vertex0 < vertex1) {
+            std::swap(vertex0, vertex1);
+        }
+        // link the larger root to the smaller. fails if vertex0 is no
+        // longer a root, in which case both roots are searched again.
+        std::size_t expected = vertex0;
+        if(parents[vertex0].compare_exchange_strong(expected, vertex1, std::memory_order_acq_rel)) {
+            return;
+        }
+    }
+}
+
+} // namespace detail
+// \endcond
+
 /// Connected component labeling by breadth-first-search (labels start at 0).
 template<class GRAPH>
 struct ComponentsBySearch {
@@ -42,6 +95,35 @@ struct ComponentsByPartition {
     andres::Partition<std::size_t> partition_;
 };
 
+/// Connected component labeling by concurrent union-find (labels start at 0).
+///
+/// Edges are processed in parallel if OpenMP is enabled. Each union links
+/// the root with the larger index to the root with the smaller index by an
+/// atomic compare-and-swap, so that the root of each component is its
+/// smallest vertex regardless of the order in which edges are processed.
+/// Labels are therefore deterministic and identical to those of
+/// ComponentsBySearch.
+///
+template<class GRAPH>
+struct ComponentsByParallelUnionFind {
+    typedef GRAPH Graph;
+
+    ComponentsByParallelUnionFind();
+    std::size_t build(const Graph&);
+    template<class SUBGRAPH_MASK>
+        std::size_t build(const Graph&, const SUBGRAPH_MASK&);
+    bool areConnected(const std::size_t, const std::size_t) const;
+
+    std::vector<std::size_t> labels_;
+
+private:
+    std::size_t find(const std::size_t) const;
+    void merge(const std::size_t, const std::size_t);
+
+    std::unique_ptr<std::atomic<std::size_t>[]> parents_;
+    std::size_t capacity_;
+};
+
 /// Connected component labeling by breadth-first-search (labels start at 0).
 ///
 /// \param graph Graph.
@@ -77,7 +159,7 @@ labelComponents(
     std::vector<char> visited(graph.numberOfVertices());
     std::queue<std::size_t> queue;
     for(std::size_t v = 0; v < graph.numberOfVertices(); ++v) {
-        if(mask.vertex(v)) {
+        if(detail::isVertexInSubgraph(mask, v)) {
             if(!visited[v]) {
                 labeling[v] = label; // label
                 queue.push(v);
@@ -87,8 +169,8 @@ labelComponents(
                     queue.pop();
                     for(typename GRAPH::AdjacencyIterator it = graph.adjacenciesFromVertexBegin(w);
                     it != graph.adjacenciesFromVertexEnd(w); ++it) {
-                        if(mask.edge(it->edge()) 
-                        && mask.vertex(it->vertex()) 
+                        if(detail::isEdgeInSubgraph(mask, it->edge()) 
+                        && detail::isVertexInSubgraph(mask, it->vertex()) 
                         && !visited[it->vertex()]) {
                             labeling[it->vertex()] = label; // label
                             queue.push(it->vertex());
@@ -163,10 +245,10 @@ ComponentsByPartition<GRAPH>::build(
 ) {
     partition_.assign(graph.numberOfVertices());
     for(std::size_t edge = 0; edge < graph.numberOfEdges(); ++edge) {
-        if(mask.edge(edge)) {
+        if(detail::isEdgeInSubgraph(mask, edge)) {
             const std::size_t v0 = graph.vertexOfEdge(edge, 0);
             const std::size_t v1 = graph.vertexOfEdge(edge, 1);
-            if(mask.vertex(v0) && mask.vertex(v1)) {
+            if(detail::isVertexInSubgraph(mask, v0) && detail::isVertexInSubgraph(mask, v1)) {
                 partition_.merge(v0, v1);
             }
         }
@@ -183,6 +265,107 @@ ComponentsByPartition<GRAPH>::areConnected(
     return partition_.find(vertex0) == partition_.find(vertex1);
 }
 
+template<class GRAPH>
+inline
+ComponentsByParallelUnionFind<GRAPH>::ComponentsByParallelUnionFind()
+:   labels_(),
+    parents_(),
+    capacity_(0)
+{}
+
+template<class GRAPH>
+inline std::size_t
+ComponentsByParallelUnionFind<GRAPH>::build(
+    const Graph& graph
+) {
+    return build(graph, DefaultSubgraphMask<>());
+}
+
+template<class GRAPH>
+template<class SUBGRAPH_MASK>
+inline std::size_t
+ComponentsByParallelUnionFind<GRAPH>::build(
+    const Graph& graph,
+    const SUBGRAPH_MASK& mask
+) {
+    const std::ptrdiff_t numberOfVertices = graph.numberOfVertices();
+    const std::ptrdiff_t numberOfEdges = graph.numberOfEdges();
+
+    // parents are kept between calls to avoid reallocation
+    if(capacity_ < graph.numberOfVertices()) {
+        parents_.reset(new std::atomic<std::size_t>[graph.numberOfVertices()]);
+        capacity_ = graph.numberOfVertices();
+    }
+    labels_.resize(graph.numberOfVertices());
+
+#pragma omp parallel for
+    for(std::ptrdiff_t v = 0; v < numberOfVertices; ++v) {
+        parents_[v].store(v, std::memory_order_relaxed);
+    }
+
+#pragma omp parallel for schedule(guided)
+    for(std::ptrdiff_t edge = 0; edge < numberOfEdges; ++edge) {
+        if(detail::isEdgeInSubgraph(mask, edge)) {
+            const std::size_t v0 = graph.vertexOfEdge(edge, 0);
+            const std::size_t v1 = graph.vertexOfEdge(edge, 1);
+            if(detail::isVertexInSubgraph(mask, v0) && detail::isVertexInSubgraph(mask, v1)) {
+                merge(v0, v1);
+            }
+        }
+    }
+
+    // roots are the smallest vertices of their components. they are
+    // labeled in ascending order, i.e. in the order of a sequential search.
+#pragma omp parallel for
+    for(std::ptrdiff_t v = 0; v < numberOfVertices; ++v) {
+        labels_[v] = find(v);
+    }
+    std::size_t label = 0;
+    for(std::size_t v = 0; v < graph.numberOfVertices(); ++v) {
+        if(labels_[v] == v && detail::isVertexInSubgraph(mask, v)) {
+            parents_[v].store(label, std::memory_order_relaxed);
+            ++label;
+        }
+    }
+#pragma omp parallel for
+    for(std::ptrdiff_t v = 0; v < numberOfVertices; ++v) {
+        if(detail::isVertexInSubgraph(mask, v)) {
+            labels_[v] = parents_[labels_[v]].load(std::memory_order_relaxed);
+        }
+        else {
+            labels_[v] = 0;
+        }
+    }
+
+    return label;
+}
+
+template<class GRAPH>
+inline bool
+ComponentsByParallelUnionFind<GRAPH>::areConnected(
+    const std::size_t vertex0,
+    const std::size_t vertex1
+) const {
+    return labels_[vertex0] == labels_[vertex1];
+}
+
+template<class GRAPH>
+inline std::size_t
+ComponentsByParallelUnionFind<GRAPH>::find(
+    const std::size_t vertex
+) const {
+    return detail::findConcurrently(parents_.get(), vertex);
+}
+
+template<class GRAPH>
+inline void
+ComponentsByParallelUnionFind<GRAPH>::merge(
+    const std::size_t vertex0,
+    const std::size_t vertex1
+) {
+    detail::mergeConcurrently(parents_.get(), vertex0, vertex1);
+}
+
 } // namespace graph
 } // namespace andres
 
@@ -2,9 +2,14 @@
 #ifndef ANDRES_GRAPH_CUT_VERTICES_HXX
 #define ANDRES_GRAPH_CUT_VERTICES_HXX
 
+#include <cstddef>
 #include <stack>
 #include <vector>
+#include <atomic>
+#include <memory> // std::unique_ptr
 #include "subgraph.hxx"
+#include "components.hxx"
+#include "detail/spanning-forest.hxx"
 
 namespace andres {
 namespace graph {
@@ -23,6 +28,21 @@ struct CutVerticesBuffers
     std::vector<char> visited_;
 };
 
+/// Buffers for the parallel algorithm of Tarjan and Vishkin.
+///
+/// Passing these buffers to findCutVertices selects the parallel algorithm.
+///
+template<class GRAPH>
+struct ParallelCutVerticesBuffers
+{
+    typedef GRAPH GraphType;
+
+    ParallelCutVerticesBuffers(const GraphType&);
+
+    detail::SpanningForestIntervals<GRAPH> forest_;
+    std::unique_ptr<std::atomic<std::size_t>[]> parents_; // disjoint sets of tree edges, each identified with its child vertex
+};
+
 template<typename GRAPH, typename ARRAY>
 inline void
 findCutVertices(
@@ -74,6 +94,23 @@ findCutVertices(
     CutVerticesBuffers<GRAPH>&
 );
 
+template<typename GRAPH, typename ARRAY>
+inline void
+findCutVertices(
+    const GRAPH&,
+    ARRAY&,
+    ParallelCutVerticesBuffers<GRAPH>&
+);
+
+template<typename GRAPH, typename SUBGRAPH, typename ARRAY>
+inline void
+findCutVertices(
+    const GRAPH&,
+    const SUBGRAPH&,
+    ARRAY&,
+    ParallelCutVerticesBuffers<GRAPH>&
+);
+
 template<typename GRAPH>
 CutVerticesBuffers<GRAPH>::CutVerticesBuffers(const GraphType& graph) :
     depth_(graph.numberOfVertices()),
@@ -83,6 +120,12 @@ CutVerticesBuffers<GRAPH>::CutVerticesBuffers(const GraphType& graph) :
     visited_(graph.numberOfVertices())
 {}
 
+template<typename GRAPH>
+ParallelCutVerticesBuffers<GRAPH>::ParallelCutVerticesBuffers(const GraphType& graph) :
+    forest_(graph),
+    parents_(new std::atomic<std::size_t>[graph.numberOfVertices()])
+{}
+
 /// \brief Find, by Hopcroft-Tarjan algorithm, cut vertices (articulation points) in an undirected graph.
 ///
 /// Hopcroft J. and Tarjan R. (1973). Efficient algorithms for graph manipulation.
@@ -297,6 +340,123 @@ findCutVertices(
         is_cut_vertex[starting_vertex] = 1;
 }
 
+/// \brief Find, by the parallel algorithm of Tarjan and Vishkin, cut vertices (articulation points) in an undirected graph.
+///
+/// R. E. Tarjan and U. Vishkin. An Efficient Parallel Biconnectivity Algorithm.
+/// SIAM Journal on Computing 14(4):862-874. 1985
+///
+/// Runtime complexity O(|E| + |V|) up to the inverse Ackermann function. Edges are processed in parallel if OpenMP is enabled.
+///
+/// \param graph An undirected graph.
+/// \param is_cut_vertex Array storing 1 for each vertex-index if it is a cut vertex, or 0 otherwise.
+/// \param buffer A pre-allocated buffer object.
+///
+template<typename GRAPH, typename ARRAY>
+inline void
+findCutVertices(
+    const GRAPH& graph,
+    ARRAY& is_cut_vertex,
+    ParallelCutVerticesBuffers<GRAPH>& buffer
+)
+{
+    findCutVertices(graph, DefaultSubgraphMask<>(), is_cut_vertex, buffer);
+}
+
+/// \brief Find, by the parallel algorithm of Tarjan and Vishkin, cut vertices (articulation points) in a subgraph of an undirected graph.
+///
+/// R. E. Tarjan and U. Vishkin. An Efficient Parallel Biconnectivity Algorithm.
+/// SIAM Journal on Computing 14(4):862-874. 1985
+///
+/// A breadth-first spanning forest is searched level by level. Tree edges
+/// are then merged into the blocks (biconnected components) they belong to,
+/// by concurrent union-find: the tree edges above the endpoints of a non-tree
+/// edge between unrelated vertices, and the tree edges to a vertex and to its
+/// parent if the subtree of the vertex is joined by a non-tree edge to a
+/// vertex outside the subtree of the parent. A vertex is a cut vertex if and
+/// only if the tree edges incident to it belong to more than one block.
+///
+/// Runtime complexity O(|E| + |V|) up to the inverse Ackermann function. Edges are processed in parallel if OpenMP is enabled.
+///
+/// \param graph An undirected graph.
+/// \param subgraph_mask Mask defining the subgraph.
+/// \param is_cut_vertex Array storing 1 for each vertex-index if it is a cut vertex, or 0 otherwise.
+/// \param buffer A pre-allocated buffer object.
+///
+template<typename GRAPH, typename SUBGRAPH, typename ARRAY>
+inline void
+findCutVertices(
+    const GRAPH& graph,
+    const SUBGRAPH& subgraph_mask,
+    ARRAY& is_cut_vertex,
+    ParallelCutVerticesBuffers<GRAPH>& buffer
+)
+{
+    auto& forest = buffer.forest_;
+    auto parents = buffer.parents_.get();
+    forest.build(graph, subgraph_mask);
+
+    const std::ptrdiff_t numberOfVertices = forest.levels_.size();
+#pragma omp parallel for
+    for (std::ptrdiff_t j = 0; j < numberOfVertices; ++j)
+        parents[forest.levels_[j]].store(forest.levels_[j], std::memory_order_relaxed);
+
+    // non-tree edges between vertices none of which is an ancestor of the other
+    const std::ptrdiff_t numberOfEdges = graph.numberOfEdges();
+#pragma omp parallel for schedule(guided)
+    for (std::ptrdiff_t e = 0; e < numberOfEdges; ++e)
+    {
+        auto v0 = graph.vertexOfEdge(e, 0);
+        auto v1 = graph.vertexOfEdge(e, 1);
+
+        if (
+            !detail::isEdgeInSubgraph(subgraph_mask, e) ||
+            !forest.isInForest(v0) ||
+            !forest.isInForest(v1) ||
+            forest.parentEdge_[v0] == static_cast<std::size_t>(e) ||
+            forest.parentEdge_[v1] == static_cast<std::size_t>(e)
+            )
+            continue;
+
+        if (!forest.isDescendant(v0, v1) && !forest.isDescendant(v1, v0))
+            detail::mergeConcurrently(parents, v0, v1);
+    }
+
+    // tree edges to a vertex and to its parent
+#pragma omp parallel for
+    for (std::ptrdiff_t j = 0; j < numberOfVertices; ++j)
+    {
+        auto v = forest.levels_[j];
+        if (forest.isRoot(v) || forest.isRoot(forest.parent_[v]))
+            continue;
+
+        auto u = forest.parent_[v];
+        if (forest.low_[v] < forest.preorder_[u] || forest.high_[v] >= forest.preorder_[u] + forest.size_[u])
+            detail::mergeConcurrently(parents, v, u);
+    }
+
+#pragma omp parallel for schedule(dynamic, 1024)
+    for (std::ptrdiff_t j = 0; j < numberOfVertices; ++j)
+    {
+        auto v = forest.levels_[j];
+        is_cut_vertex[v] = 0;
+
+        auto first = forest.childOffsets_[v];
+        auto last = forest.childOffsets_[v + 1];
+        if (first == last)
+            continue;
+
+        // the edge to the parent of a root does not exist. it is replaced
+        // by the edge to the first child.
+        auto block = detail::findConcurrently(parents, forest.isRoot(v) ? forest.children_[first] : v);
+        for (auto k = first; k < last; ++k)
+            if (detail::findConcurrently(parents, forest.children_[k]) != block)
+            {
+                is_cut_vertex[v] = 1;
+                break;
+            }
+    }
+}
+
 }
 }
 #endif
@@ -3,7 +3,11 @@
 #define ANDRES_GRAPH_DETAIL_GRAPH_HXX
 
 #include <iterator>
+#include <type_traits> // std::is_integral
+
 #include <andres/random-access-set.hxx>
+#include "../adjacency.hxx"
+#include "../visitor.hxx"
 
 namespace andres {
 namespace graph {
@@ -25,12 +29,43 @@ private:
 
 typedef RandomAccessSet<Adjacency<> > Adjacencies;
 
-template<bool T>
+// Void type, used to detect member types by SFINAE.
+template<class T>
+struct VoidType {
+    typedef void type;
+};
+
+// Integer type of a visitor, std::size_t if the visitor does not define size_type.
+template<class VISITOR, class = void>
+struct VisitorSizeType {
+    typedef std::size_t type;
+};
+
+template<class VISITOR>
+struct VisitorSizeType<VISITOR, typename VoidType<typename VISITOR::size_type>::type> {
+    typedef typename VISITOR::size_type type;
+};
+
+// Visitor and integer type in which indices of vertices and edges are stored,
+// given either a visitor or an integer type as the template parameter of a graph.
+template<class T, bool = std::is_integral<T>::value>
+struct GraphTraits {
+    typedef T Visitor;
+    typedef typename VisitorSizeType<T>::type size_type;
+};
+
+template<class T>
+struct GraphTraits<T, true> {
+    typedef IdleGraphVisitor<T> Visitor;
+    typedef T size_type;
+};
+
+template<bool T, class BASE = Adjacencies::const_iterator>
 class IteratorHelper
-:   public Adjacencies::const_iterator
+:   public BASE
 {
 private:
-    typedef typename Adjacencies::const_iterator Base;
+    typedef BASE Base;
 
 public:
     typedef typename Base::iterator_category iterator_category;
@@ -42,21 +77,21 @@ public:
     // construction and assignment
     IteratorHelper();
     IteratorHelper(const Base&);
-    IteratorHelper(const IteratorHelper<T>&);
+    IteratorHelper(const IteratorHelper<T, BASE>&);
     IteratorHelper operator=(const Base&);
-    IteratorHelper operator=(const IteratorHelper<T>&);
+    IteratorHelper operator=(const IteratorHelper<T, BASE>&);
 
     // increment and decrement
-    IteratorHelper<T>& operator+=(const difference_type);
-    IteratorHelper<T>& operator-=(const difference_type);
-    IteratorHelper<T>& operator++(); // prefix
-    IteratorHelper<T>& operator--(); // prefix
-    IteratorHelper<T> operator++(int); // postfix
-    IteratorHelper<T> operator--(int); // postfix
-    IteratorHelper<T> operator+(const difference_type) const;
-    IteratorHelper<T> operator-(const difference_type) const;
+    IteratorHelper<T, BASE>& operator+=(const difference_type);
+    IteratorHelper<T, BASE>& operator-=(const difference_type);
+    IteratorHelper<T, BASE>& operator++(); // prefix
+    IteratorHelper<T, BASE>& operator--(); // prefix
+    IteratorHelper<T, BASE> operator++(int); // postfix
+    IteratorHelper<T, BASE> operator--(int); // postfix
+    IteratorHelper<T, BASE> operator+(const difference_type) const;
+    IteratorHelper<T, BASE> operator-(const difference_type) const;
     #ifdef _MSC_VER
-    difference_type operator-(const IteratorHelper<T>&) const;
+    difference_type operator-(const IteratorHelper<T, BASE>&) const;
     #endif
 
     // access
@@ -116,49 +151,49 @@ Edge<DIRECTED, T>::operator[](
 
 // implementation of IteratorHelper
 
-template<bool T>
+template<bool T, class BASE>
 inline
-IteratorHelper<T>::IteratorHelper()
+IteratorHelper<T, BASE>::IteratorHelper()
 :   Base()
 {}
 
-template<bool T>
+template<bool T, class BASE>
 inline
-IteratorHelper<T>::IteratorHelper(
+IteratorHelper<T, BASE>::IteratorHelper(
     const Base& it
 )
 :   Base(it)
 {}
 
-template<bool T>
+template<bool T, class BASE>
 inline
-IteratorHelper<T>::IteratorHelper(
-    const IteratorHelper<T>& it
+IteratorHelper<T, BASE>::IteratorHelper(
+    const IteratorHelper<T, BASE>& it
 )
 :   Base(it)
 {}
 
-template<bool T>
-inline IteratorHelper<T>
-IteratorHelper<T>::operator=(
+template<bool T, class BASE>
+inline IteratorHelper<T, BASE>
+IteratorHelper<T, BASE>::operator=(
     const Base& it
 ) {
     Base::operator=(it);
     return *this;
 }
 
-template<bool T>
-inline IteratorHelper<T>
-IteratorHelper<T>::operator=(
-    const IteratorHelper<T>& it
+template<bool T, class BASE>
+inline IteratorHelper<T, BASE>
+IteratorHelper<T, BASE>::operator=(
+    const IteratorHelper<T, BASE>& it
 ) {
     Base::operator=(it);
     return *this;
 }
 
-template<bool T>
-inline typename IteratorHelper<T>::value_type
-IteratorHelper<T>::operator*() const {
+template<bool T, class BASE>
+inline typename IteratorHelper<T, BASE>::value_type
+IteratorHelper<T, BASE>::operator*() const {
     if(T) { // evaluated at compile time
         return Base::operator*().vertex();
     }
@@ -167,9 +202,9 @@ IteratorHelper<T>::operator*() const {
     }
 }
 
-template<bool T>
-inline typename IteratorHelper<T>::value_type
-IteratorHelper<T>::operator[](
+template<bool T, class BASE>
+inline typename IteratorHelper<T, BASE>::value_type
+IteratorHelper<T, BASE>::operator[](
     const std::size_t j
 ) const {
     if(T) { // evaluated at compile time
@@ -180,71 +215,71 @@ IteratorHelper<T>::operator[](
     }
 }
 
-template<bool T>
-inline IteratorHelper<T>&
-IteratorHelper<T>::operator+=(
+template<bool T, class BASE>
+inline IteratorHelper<T, BASE>&
+IteratorHelper<T, BASE>::operator+=(
     const difference_type d
 ) {
     Base::operator+=(d);
     return *this;
 }
 
-template<bool T>
-inline IteratorHelper<T>&
-IteratorHelper<T>::operator-=(
+template<bool T, class BASE>
+inline IteratorHelper<T, BASE>&
+IteratorHelper<T, BASE>::operator-=(
     const difference_type d
 ) {
     Base::operator-=(d);
     return *this;
 }
 
-template<bool T>
-inline IteratorHelper<T>&
-IteratorHelper<T>::operator++() { // prefix
+template<bool T, class BASE>
+inline IteratorHelper<T, BASE>&
+IteratorHelper<T, BASE>::operator++() { // prefix
     Base::operator++();
     return *this;
 }
 
-template<bool T>
-inline IteratorHelper<T>&
-IteratorHelper<T>::operator--() { // prefix
+template<bool T, class BASE>
+inline IteratorHelper<T, BASE>&
+IteratorHelper<T, BASE>::operator--() { // prefix
     Base::operator--();
     return *this;
 }
 
-template<bool T>
-inline IteratorHelper<T>
-IteratorHelper<T>::operator++(int) { // postfix
+template<bool T, class BASE>
+inline IteratorHelper<T, BASE>
+IteratorHelper<T, BASE>::operator++(int) { // postfix
     return Base::operator++(int());
 }
 
-template<bool T>
-inline IteratorHelper<T>
-IteratorHelper<T>::operator--(int) { // postfix
+template<bool T, class BASE>
+inline IteratorHelper<T, BASE>
+IteratorHelper<T, BASE>::operator--(int) { // postfix
     return Base::operator--(int());
 }
 
-template<bool T>
-inline IteratorHelper<T>
-IteratorHelper<T>::operator+(
+template<bool T, class BASE>
+inline IteratorHelper<T, BASE>
+IteratorHelper<T, BASE>::operator+(
     const difference_type d
 ) const {
     return Base::operator+(d);
 }
 
-template<bool T>
-inline IteratorHelper<T>
-IteratorHelper<T>::operator-(
+template<bool T, class BASE>
+inline IteratorHelper<T, BASE>
+IteratorHelper<T, BASE>::operator-(
     const difference_type d
 ) const {
     return Base::operator-(d);
 }
 
 #ifdef _MSC_VER
-template<bool T>
-inline typename IteratorHelper<T>::difference_type
-IteratorHelper<T>::operator-(
-    const IteratorHelper<T>& other
+template<bool T, class BASE>
+inline typename IteratorHelper<T, BASE>::difference_type
+IteratorHelper<T, BASE>::operator-(
+    const IteratorHelper<T, BASE>& other
 ) const {
     return Base::operator-(other);
 }
@@ -0,0 +1,244 @@
+#pragma once
+#ifndef ANDRES_GRAPH_DETAIL_SPANNING_FOREST_HXX
+#define ANDRES_GRAPH_DETAIL_SPANNING_FOREST_HXX
+
+#include <cstddef>
+#include <limits>
+#include <vector>
+#include <algorithm> // std::min, std::max
+
+#include "../subgraph.hxx"
+#include "../bfs.hxx"
+
+namespace andres {
+namespace graph {
+// \cond SUPPRESS_DOXYGEN
+namespace detail {
+
+// Breadth-first spanning forest of a subgraph of an undirected graph with,
+// for every vertex v, the interval [preorder_[v], preorder_[v] + size_[v])
+// of preorder numbers of the subtree rooted at v, and the smallest and
+// largest preorder number low_[v] and high_[v] of any vertex that is in this
+// subtree or is joined to it by a non-tree edge. These are the quantities on
+// which the parallel biconnectivity algorithm is built:
+//
+// R. E. Tarjan and U. Vishkin. An Efficient Parallel Biconnectivity
+// Algorithm. SIAM Journal on Computing 14(4):862-874. 1985
+//
+// Every tree is found by a level-synchronous breadth-first search. All
+// further passes over edges process one level of the forest at a time, in
+// parallel if OpenMP is enabled. Vertices are grouped by depth and by parent
+// in two sequential counting passes over the vertices.
+//
+template<class GRAPH>
+struct SpanningForestIntervals {
+    typedef GRAPH Graph;
+
+    static const std::size_t NO_EDGE;
+
+    SpanningForestIntervals(const Graph&);
+    template<class SUBGRAPH_MASK>
+        void build(const Graph&, const SUBGRAPH_MASK&);
+    bool isInForest(const std::size_t v) const
+        { return search_.depth(v) != LevelSynchronousBreadthFirstSearchData<>::NOT_VISITED; }
+    bool isRoot(const std::size_t v) const
+        { return search_.depth(v) == 0; }
+    std::size_t numberOfLevels() const
+        { return levelOffsets_.size() - 1; }
+    // true if w is in the subtree rooted at v
+    bool isDescendant(const std::size_t w, const std::size_t v) const
+        { return preorder_[v] <= preorder_[w] && preorder_[w] < preorder_[v] + size_[v]; }
+
+    LevelSynchronousBreadthFirstSearchData<> search_;
+    std::vector<std::size_t> parent_;
+    std::vector<std::size_t> parentEdge_; // NO_EDGE for roots
+    std::vector<std::size_t> levels_; // vertices of the forest by depth
+    std::vector<std::size_t> levelOffsets_;
+    std::vector<std::size_t> children_; // vertices of the forest by parent
+    std::vector<std::size_t> childOffsets_;
+    std::vector<std::size_t> preorder_;
+    std::vector<std::size_t> size_;
+    std::vector<std::size_t> low_;
+    std::vector<std::size_t> high_;
+};
+
+template<class GRAPH>
+const std::size_t SpanningForestIntervals<GRAPH>::NO_EDGE = std::numeric_limits<std::size_t>::max();
+
+template<class GRAPH>
+inline
+SpanningForestIntervals<GRAPH>::SpanningForestIntervals(
+    const Graph& graph
+)
+:   search_(graph),
+    parent_(graph.numberOfVertices()),
+    parentEdge_(graph.numberOfVertices()),
+    levels_(),
+    levelOffsets_(),
+    children_(),
+    childOffsets_(graph.numberOfVertices() + 1),
+    preorder_(graph.numberOfVertices()),
+    size_(graph.numberOfVertices()),
+    low_(graph.numberOfVertices()),
+    high_(graph.numberOfVertices())
+{}
+
+template<class GRAPH>
+template<class SUBGRAPH_MASK>
+inline void
+SpanningForestIntervals<GRAPH>::build(
+    const Graph& graph,
+    const SUBGRAPH_MASK& mask
+) {
+    const std::size_t NOT_VISITED = LevelSynchronousBreadthFirstSearchData<>::NOT_VISITED;
+
+    // trees, and vertices grouped by depth
+    search_.markAllNotvisited();
+    levels_.clear();
+    levelOffsets_.assign(1, 0);
+    for(std::size_t root = 0; root < graph.numberOfVertices(); ++root) {
+        if(search_.depth(root) == NOT_VISITED && detail::isVertexInSubgraph(mask, root)) {
+            levelSynchronousBreadthFirstSearch(graph, mask, root,
+                [&](const std::size_t, const std::size_t depth, bool& proceed, bool& add) {
+                    if(depth + 1 >= levelOffsets_.size()) {
+                        levelOffsets_.push_back(0);
+                    }
+                    ++levelOffsets_[depth + 1];
+                    proceed = true;
+                    add = true;
+                },
+                search_
+            );
+        }
+    }
+    for(std::size_t d = 1; d < levelOffsets_.size(); ++d) {
+        levelOffsets_[d] += levelOffsets_[d - 1];
+    }
+    levels_.resize(levelOffsets_.back());
+    for(std::size_t v = 0; v < graph.numberOfVertices(); ++v) {
+        if(search_.depth(v) != NOT_VISITED) {
+            levels_[levelOffsets_[search_.depth(v)]++] = v;
+        }
+    }
+    for(std::size_t d = levelOffsets_.size() - 1; d > 0; --d) {
+        levelOffsets_[d] = levelOffsets_[d - 1];
+    }
+    levelOffsets_[0] = 0;
+
+    // the parent of each vertex is its first neighbor one level up
+    const std::ptrdiff_t numberOfForestVertices = levels_.size();
+#pragma omp parallel for schedule(dynamic, 1024)
+    for(std::ptrdiff_t j = 0; j < numberOfForestVertices; ++j) {
+        const std::size_t v = levels_[j];
+        parentEdge_[v] = NO_EDGE;
+        if(search_.depth(v) != 0) {
+            for(auto it = graph.adjacenciesFromVertexBegin(v); it != graph.adjacenciesFromVertexEnd(v); ++it) {
+                if(search_.depth(it->vertex()) + 1 == search_.depth(v)
+                && detail::isEdgeInSubgraph(mask, it->edge())) {
+                    parent_[v] = it->vertex();
+                    parentEdge_[v] = it->edge();
+                    break;
+                }
+            }
+        }
+    }
+
+    // children of each vertex, in ascending order
+    std::fill(childOffsets_.begin(), childOffsets_.end(), 0);
+    for(std::size_t v = 0; v < graph.numberOfVertices(); ++v) {
+        if(search_.depth(v) != NOT_VISITED && parentEdge_[v] != NO_EDGE) {
+            ++childOffsets_[parent_[v]];
+        }
+    }
+    std::size_t offset = 0;
+    for(std::size_t v = 0; v < graph.numberOfVertices(); ++v) {
+        const std::size_t numberOfChildren = childOffsets_[v];
+        childOffsets_[v] = offset;
+        offset += numberOfChildren;
+    }
+    childOffsets_[graph.numberOfVertices()] = offset;
+    children_.resize(offset);
+    for(std::size_t v = 0; v < graph.numberOfVertices(); ++v) {
+        if(search_.depth(v) != NOT_VISITED && parentEdge_[v] != NO_EDGE) {
+            children_[childOffsets_[parent_[v]]++] = v;
+        }
+    }
+    for(std::size_t v = graph.numberOfVertices(); v > 0; --v) {
+        childOffsets_[v] = childOffsets_[v - 1];
+    }
+    childOffsets_[0] = 0;
+
+    // subtree sizes, bottom-up
+    for(std::size_t d = numberOfLevels(); d > 0; --d) {
+        const std::ptrdiff_t begin = levelOffsets_[d - 1];
+        const std::ptrdiff_t end = levelOffsets_[d];
+#pragma omp parallel for schedule(dynamic, 1024)
+        for(std::ptrdiff_t j = begin; j < end; ++j) {
+            const std::size_t v = levels_[j];
+            std::size_t size = 1;
+            for(std::size_t k = childOffsets_[v]; k < childOffsets_[v + 1]; ++k) {
+                size += size_[children_[k]];
+            }
+            size_[v] = size;
+        }
+    }
+
+    // preorder numbers, top-down. the trees are numbered in the order of
+    // their roots, and the children of each vertex in ascending order.
+    offset = 0;
+    if(numberOfLevels() > 0) {
+        for(std::size_t j = 0; j < levelOffsets_[1]; ++j) {
+            preorder_[levels_[j]] = offset;
+            offset += size_[levels_[j]];
+        }
+    }
+    for(std::size_t d = 0; d < numberOfLevels(); ++d) {
+        const std::ptrdiff_t begin = levelOffsets_[d];
+        const std::ptrdiff_t end = levelOffsets_[d + 1];
+#pragma omp parallel for schedule(dynamic, 1024)
+        for(std::ptrdiff_t j = begin; j < end; ++j) {
+            const std::size_t v = levels_[j];
+            std::size_t next = preorder_[v] + 1;
+            for(std::size_t k = childOffsets_[v]; k < childOffsets_[v + 1]; ++k) {
+                preorder_[children_[k]] = next;
+                next += size_[children_[k]];
+            }
+        }
+    }
+
+    // low and high over non-tree edges, bottom-up
+    for(std::size_t d = numberOfLevels(); d > 0; --d) {
+        const std::ptrdiff_t begin = levelOffsets_[d - 1];
+        const std::ptrdiff_t end = levelOffsets_[d];
+#pragma omp parallel for schedule(dynamic, 1024)
+        for(std::ptrdiff_t j = begin; j < end; ++j) {
+            const std::size_t v = levels_[j];
+            std::size_t low = preorder_[v];
+            std::size_t high = preorder_[v];
+            for(auto it = graph.adjacenciesFromVertexBegin(v); it != graph.adjacenciesFromVertexEnd(v); ++it) {
+                const std::size_t w = it->vertex();
+                const std::size_t e = it->edge();
+                if(detail::isVertexInSubgraph(mask, w)
+                && detail::isEdgeInSubgraph(mask, e)
+                && e != parentEdge_[v] && e != parentEdge_[w]) {
+                    low = std::min(low, preorder_[w]);
+                    high = std::max(high, preorder_[w]);
+                }
+            }
+            for(std::size_t k = childOffsets_[v]; k < childOffsets_[v + 1]; ++k) {
+                low = std::min(low, low_[children_[k]]);
+                high = std::max(high, high_[children_[k]]);
+            }
+            low_[v] = low;
+            high_[v] = high;
+        }
+    }
+}
+
+} // namespace detail
+// \endcond
+
+} // namespace graph
+} // namespace andres
+
+#endif // #ifndef ANDRES_GRAPH_DETAIL_SPANNING_FOREST_HXX
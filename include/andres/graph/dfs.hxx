@@ -9,6 +9,7 @@
 #include <vector>
 
 #include "subgraph.hxx"
+#include "search-workspace.hxx"
 
 namespace andres {
 namespace graph {
@@ -156,7 +157,7 @@ depthFirstSearch(
             {
                 auto e_it = g.edgesFromVertexBegin(v);
                 for(auto it = g.verticesFromVertexBegin(v); it != g.verticesFromVertexEnd(v); ++it, ++e_it)
-                    if (!data.visited(*it) && subgraph_mask.vertex(*it) && subgraph_mask.edge(*e_it))
+                    if (!data.visited(*it) && detail::isVertexInSubgraph(subgraph_mask, *it) && detail::isEdgeInSubgraph(subgraph_mask, *e_it))
                         data.add(*it);
             }
         }
@@ -176,6 +177,76 @@ depthFirstSearch(
     depthFirstSearch(g, subgraph_mask, start_vertex, callback, data);
 }
 
+/// Depth-first search with a workspace that is reused across searches.
+///
+/// The callback is called as for depthFirstSearch with DepthFirstSearchData.
+/// Unlike those buffers, the workspace need not be reset between searches,
+/// so that a search takes time only in the number of vertices and edges it
+/// visits.
+///
+/// \param g A graph class such as andres::Graph or andres::Digraph.
+/// \param subgraph_mask A subgraph mask such as DefaultSubgraphMask.
+/// \param start_vertex Vertex at which the search starts.
+/// \param callback Function called as callback(vertex, proceed, addNeighbors).
+/// \param workspace Workspace, reusable across searches.
+///
+template<typename GRAPH, typename SUBGRAPH, typename CALLBACK, typename VALUE, typename QUEUE_TAG>
+inline void
+depthFirstSearch(
+    const GRAPH& g,
+    const SUBGRAPH& subgraph_mask,
+    const std::size_t start_vertex,
+    CALLBACK&& callback,
+    SearchWorkspace<VALUE, QUEUE_TAG>& workspace
+)
+{
+    assert(start_vertex < g.numberOfVertices());
+
+    workspace.startSearch(g.numberOfVertices());
+    std::vector<std::size_t>& stack = workspace.queues_[0];
+
+    stack.push_back(start_vertex);
+
+    while(!stack.empty())
+    {
+        auto v = stack.back();
+        stack.pop_back();
+
+        if (!workspace.isVisited(v))
+        {
+            workspace.markVisited(v);
+
+            bool proceed;
+            bool addNeighbors;
+
+            callback(v, proceed, addNeighbors);
+
+            if (!proceed)
+                return;
+
+            if (addNeighbors)
+            {
+                auto e_it = g.edgesFromVertexBegin(v);
+                for(auto it = g.verticesFromVertexBegin(v); it != g.verticesFromVertexEnd(v); ++it, ++e_it)
+                    if (!workspace.isVisited(*it) && detail::isVertexInSubgraph(subgraph_mask, *it) && detail::isEdgeInSubgraph(subgraph_mask, *e_it))
+                        stack.push_back(*it);
+            }
+        }
+    }
+}
+
+template<typename GRAPH, typename CALLBACK, typename VALUE, typename QUEUE_TAG>
+inline void
+depthFirstSearch(
+    const GRAPH& g,
+    const std::size_t start_vertex,
+    CALLBACK&& callback,
+    SearchWorkspace<VALUE, QUEUE_TAG>& workspace
+)
+{
+    depthFirstSearch(g, DefaultSubgraphMask<>(), start_vertex, callback, workspace);
+}
+
 } // namespace graph
 } // namespace andres
 
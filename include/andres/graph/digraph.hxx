@@ -8,8 +8,11 @@
 #include <vector>
 #include <set>
 #include <iostream>
-#include <utility> // std::pair
-#include <algorithm> // std::fill
+#include <utility> // std::pair, std::move
+#include <algorithm> // std::sort
+#include <functional> // std::less
+#include <memory> // std::allocator, std::allocator_traits
+#include <limits> // std::numeric_limits
 
 #include "adjacency.hxx"
 #include "subgraph.hxx"
@@ -20,19 +23,29 @@ namespace andres {
 namespace graph {
 
 /// Directed graph, implemented as an adjacency list.
-template<typename VISITOR = IdleGraphVisitor<std::size_t> >
+///
+/// The template parameter is either a visitor or an unsigned integer type
+/// in which indices of vertices and edges are stored, as for Graph.
+///
+template<typename VISITOR = IdleGraphVisitor<std::size_t>, class ALLOCATOR = std::allocator<std::size_t> >
 class Digraph {
 public:
-    typedef VISITOR Visitor;
-    typedef detail::VertexIterator VertexIterator;
-    typedef detail::EdgeIterator EdgeIterator;
-    typedef detail::Adjacencies::const_iterator AdjacencyIterator;
+    typedef typename detail::GraphTraits<VISITOR>::Visitor Visitor;
+    typedef typename detail::GraphTraits<VISITOR>::size_type IndexType;
+    typedef typename std::allocator_traits<ALLOCATOR>::template rebind_alloc<Adjacency<IndexType> > Allocator;
+    typedef typename RandomAccessSet<Adjacency<IndexType>, std::less<Adjacency<IndexType> >, Allocator>::const_iterator AdjacencyIterator;
+    typedef detail::IteratorHelper<true, AdjacencyIterator> VertexIterator;
+    typedef detail::IteratorHelper<false, AdjacencyIterator> EdgeIterator;
     
     typedef typename AdjacencyIterator::value_type AdjacencyType;
 
     // construction
     Digraph(const Visitor& = Visitor());
     Digraph(const std::size_t, const Visitor& = Visitor());
+    Digraph(const Digraph&);
+    Digraph(Digraph&&) = default;
+    Digraph& operator=(const Digraph&);
+    Digraph& operator=(Digraph&&) = default;
     void assign(const Visitor& = Visitor());
     void assign(const std::size_t, const Visitor& = Visitor());
     void reserveVertices(const std::size_t);
@@ -66,29 +79,38 @@ public:
     const AdjacencyType& adjacencyToVertex(const std::size_t, const std::size_t) const;
     std::pair<bool, std::size_t> findEdge(const std::size_t, const std::size_t) const;
     bool multipleEdgesEnabled() const;
+    Allocator get_allocator() const;
 
     // manipulation
     std::size_t insertVertex();
     std::size_t insertVertices(const std::size_t);
     std::size_t insertEdge(const std::size_t, const std::size_t);
+    template<class ITERATOR>
+        std::size_t insertEdges(ITERATOR, ITERATOR);
     void eraseVertex(const std::size_t);
+    template<class MASK>
+        void eraseVertices(const MASK&);
     void eraseEdge(const std::size_t);
+    template<class MASK>
+        void eraseEdges(const MASK&);
     bool& multipleEdgesEnabled();
 
 private:
-    typedef detail::Adjacencies Adjacencies;
+    typedef RandomAccessSet<AdjacencyType, std::less<AdjacencyType>, Allocator> Adjacencies;
     struct Vertex {
-        Vertex()
-            : from_(), to_()
+        Vertex(const Allocator& allocator)
+            : from_(std::less<AdjacencyType>(), allocator), to_(std::less<AdjacencyType>(), allocator)
             {}
         Adjacencies from_;
         Adjacencies to_;
     };
-    typedef detail::Edge<true> Edge;
+    typedef detail::Edge<true, IndexType> Edge;
 
     void insertAdjacenciesForEdge(const std::size_t);
+    void insertAdjacenciesForEdges(const std::size_t);
     void eraseAdjacenciesForEdge(const std::size_t);
 
+    Allocator allocator_;
     std::vector<Vertex> vertices_;
     std::vector<Edge> edges_;
     bool multipleEdgesEnabled_;
@@ -101,12 +123,13 @@ private:
 ///
 /// \param visitor Visitor to follow changes of integer indices of vertices and edges.
 ///
-template<typename VISITOR>
+template<typename VISITOR, class ALLOCATOR>
 inline
-Digraph<VISITOR>::Digraph(
+Digraph<VISITOR, ALLOCATOR>::Digraph(
     const Visitor& visitor
 )
-:   vertices_(),
+:   allocator_(),
+    vertices_(),
     edges_(),
     multipleEdgesEnabled_(false),
     visitor_(visitor)
@@ -117,31 +140,82 @@ Digraph<VISITOR>::Digraph(
 /// \param numberOfVertices Number of vertices.
 /// \param visitor Visitor to follow changes of integer indices of vertices and edges.
 ///
-template<typename VISITOR>
+template<typename VISITOR, class ALLOCATOR>
 inline
-Digraph<VISITOR>::Digraph(
+Digraph<VISITOR, ALLOCATOR>::Digraph(
     const std::size_t numberOfVertices,
     const Visitor& visitor
 )
-:   vertices_(numberOfVertices),
+:   allocator_(),
+    vertices_(),
     edges_(),
     multipleEdgesEnabled_(false),
     visitor_(visitor)
 {
+    // vertices are constructed one at a time because copies of a vertex
+    // would obtain an allocator from select_on_container_copy_construction()
+    vertices_.reserve(numberOfVertices);
+    for(std::size_t v = 0; v < numberOfVertices; ++v) {
+        vertices_.push_back(Vertex(allocator_));
+    }
     visitor_.insertVertices(0, numberOfVertices);
 }
 
+/// Copy a directed graph.
+///
+/// The adjacencies of the copy are allocated by an allocator obtained from
+/// select_on_container_copy_construction(), so that a copy of a graph with
+/// an ArenaAllocator has an arena of its own.
+///
+/// \param other Graph to be copied.
+///
+template<typename VISITOR, class ALLOCATOR>
+inline
+Digraph<VISITOR, ALLOCATOR>::Digraph(
+    const Digraph<VISITOR, ALLOCATOR>& other
+)
+:   allocator_(std::allocator_traits<Allocator>::select_on_container_copy_construction(other.allocator_)),
+    vertices_(),
+    edges_(other.edges_),
+    multipleEdgesEnabled_(other.multipleEdgesEnabled_),
+    visitor_(other.visitor_)
+{
+    vertices_.reserve(other.vertices_.size());
+    for(std::size_t v = 0; v < other.vertices_.size(); ++v) {
+        vertices_.push_back(Vertex(allocator_));
+        vertices_.back().from_ = other.vertices_[v].from_;
+        vertices_.back().to_ = other.vertices_[v].to_;
+    }
+}
+
+/// Assign a copy of a directed graph.
+///
+/// \param other Graph to be copied.
+///
+template<typename VISITOR, class ALLOCATOR>
+inline Digraph<VISITOR, ALLOCATOR>&
+Digraph<VISITOR, ALLOCATOR>::operator=(
+    const Digraph<VISITOR, ALLOCATOR>& other
+) {
+    if(this != &other) {
+        Digraph<VISITOR, ALLOCATOR> copy(other);
+        *this = std::move(copy);
+    }
+    return *this;
+}
+
 /// Clear a directed graph.
 ///
 /// \param visitor Visitor to follow changes of integer indices of vertices and edges.
 ///
-template<typename VISITOR>
+template<typename VISITOR, class ALLOCATOR>
 inline void
-Digraph<VISITOR>::assign(
+Digraph<VISITOR, ALLOCATOR>::assign(
     const Visitor& visitor
 ) {
     vertices_.clear();
     edges_.clear();
+    allocator_ = Allocator();
     multipleEdgesEnabled_ = false;
     visitor_ = visitor;
 }
@@ -151,15 +225,19 @@ Digraph<VISITOR>::assign(
 /// \param numberOfVertices Number of vertices.
 /// \param visitor Visitor to follow changes of integer indices of vertices and edges.
 ///
-template<typename VISITOR>
+template<typename VISITOR, class ALLOCATOR>
 inline void
-Digraph<VISITOR>::assign(
+Digraph<VISITOR, ALLOCATOR>::assign(
     const std::size_t numberOfVertices,
     const Visitor& visitor
 ) {
-    vertices_.resize(numberOfVertices);
-    std::fill(vertices_.begin(), vertices_.end(), Vertex());
+    vertices_.clear();
     edges_.clear();
+    allocator_ = Allocator();
+    vertices_.reserve(numberOfVertices);
+    for(std::size_t v = 0; v < numberOfVertices; ++v) {
+        vertices_.push_back(Vertex(allocator_));
+    }
     multipleEdgesEnabled_ = false;
     visitor_ = visitor;
     visitor_.insertVertices(0, numberOfVertices);
@@ -167,17 +245,17 @@ Digraph<VISITOR>::assign(
 
 /// Get the number of vertices.
 ///
-template<typename VISITOR>
+template<typename VISITOR, class ALLOCATOR>
 inline std::size_t
-Digraph<VISITOR>::numberOfVertices() const {
+Digraph<VISITOR, ALLOCATOR>::numberOfVertices() const {
     return vertices_.size();
 }
 
 /// Get the number of edges.
 ///
-template<typename VISITOR>
+template<typename VISITOR, class ALLOCATOR>
 inline std::size_t
-Digraph<VISITOR>::numberOfEdges() const {
+Digraph<VISITOR, ALLOCATOR>::numberOfEdges() const {
     return edges_.size();
 }
 
@@ -187,9 +265,9 @@ Digraph<VISITOR>::numberOfEdges() const {
 ///
 /// \sa edgeFromVertex()
 ///
-template<typename VISITOR>
+template<typename VISITOR, class ALLOCATOR>
 inline std::size_t
-Digraph<VISITOR>::numberOfEdgesFromVertex(
+Digraph<VISITOR, ALLOCATOR>::numberOfEdgesFromVertex(
     const std::size_t vertex
 ) const {
     return vertices_[vertex].to_.size();
@@ -201,9 +279,9 @@ Digraph<VISITOR>::numberOfEdgesFromVertex(
 ///
 /// \sa edgeToVertex()
 ///
-template<typename VISITOR>
+template<typename VISITOR, class ALLOCATOR>
 inline std::size_t
-Digraph<VISITOR>::numberOfEdgesToVertex(
+Digraph<VISITOR, ALLOCATOR>::numberOfEdgesToVertex(
     const std::size_t vertex
 ) const {
     return vertices_[vertex].from_.size();
@@ -214,9 +292,9 @@ Digraph<VISITOR>::numberOfEdgesToVertex(
 /// \param edge Integer index of an edge.
 /// \param j Number of the vertex in the edge; either 0 or 1.
 ///
-template<typename VISITOR>
+template<typename VISITOR, class ALLOCATOR>
 inline std::size_t
-Digraph<VISITOR>::vertexOfEdge(
+Digraph<VISITOR, ALLOCATOR>::vertexOfEdge(
     const std::size_t edge,
     const std::size_t j
 ) const {
@@ -232,9 +310,9 @@ Digraph<VISITOR>::vertexOfEdge(
 ///
 /// \sa numberOfEdgesFromVertex()
 ///
-template<typename VISITOR>
+template<typename VISITOR, class ALLOCATOR>
 inline std::size_t
-Digraph<VISITOR>::edgeFromVertex(
+Digraph<VISITOR, ALLOCATOR>::edgeFromVertex(
     const std::size_t vertex,
     const std::size_t j
 ) const {
@@ -248,9 +326,9 @@ Digraph<VISITOR>::edgeFromVertex(
 ///
 /// \sa numberOfEdgesToVertex()
 ///
-template<typename VISITOR>
+template<typename VISITOR, class ALLOCATOR>
 inline std::size_t
-Digraph<VISITOR>::edgeToVertex(
+Digraph<VISITOR, ALLOCATOR>::edgeToVertex(
     const std::size_t vertex,
     const std::size_t j
 ) const {
@@ -264,9 +342,9 @@ Digraph<VISITOR>::edgeToVertex(
 ///
 /// \sa numberOfEdgesFromVertex()
 ///
-template<typename VISITOR>
+template<typename VISITOR, class ALLOCATOR>
 inline std::size_t
-Digraph<VISITOR>::vertexFromVertex(
+Digraph<VISITOR, ALLOCATOR>::vertexFromVertex(
     const std::size_t vertex,
     const std::size_t j
 ) const {
@@ -280,9 +358,9 @@ Digraph<VISITOR>::vertexFromVertex(
 ///
 /// \sa numberOfEdgesFromVertex()
 ///
-template<typename VISITOR>
+template<typename VISITOR, class ALLOCATOR>
 inline std::size_t
-Digraph<VISITOR>::vertexToVertex(
+Digraph<VISITOR, ALLOCATOR>::vertexToVertex(
     const std::size_t vertex,
     const std::size_t j
 ) const {
@@ -295,10 +373,12 @@ Digraph<VISITOR>::vertexToVertex(
 ///
 /// \sa insertVertices()
 ///
-template<typename VISITOR>
+template<typename VISITOR, class ALLOCATOR>
 inline std::size_t
-Digraph<VISITOR>::insertVertex() {
-    vertices_.push_back(Vertex());
+Digraph<VISITOR, ALLOCATOR>::insertVertex() {
+    assert(vertices_.size() < static_cast<std::size_t>(std::numeric_limits<IndexType>::max()));
+
+    vertices_.push_back(Vertex(allocator_));
     visitor_.insertVertex(vertices_.size() - 1);
     return vertices_.size() - 1;
 }
@@ -310,13 +390,17 @@ Digraph<VISITOR>::insertVertex() {
 ///
 /// \sa insertVertex()
 ///
-template<typename VISITOR>
+template<typename VISITOR, class ALLOCATOR>
 inline std::size_t
-Digraph<VISITOR>::insertVertices(
+Digraph<VISITOR, ALLOCATOR>::insertVertices(
     const std::size_t number
 ) {
+    assert(number <= static_cast<std::size_t>(std::numeric_limits<IndexType>::max()) - vertices_.size());
+
     std::size_t position = vertices_.size();
-    vertices_.insert(vertices_.end(), number, Vertex());
+    for(std::size_t v = 0; v < number; ++v) {
+        vertices_.push_back(Vertex(allocator_));
+    }
     visitor_.insertVertices(position, number);
     return position;
 }
@@ -327,9 +411,9 @@ Digraph<VISITOR>::insertVertices(
 /// \param vertexIndex1 Integer index of the second vertex (target) of the edge.
 /// \return Integer index of the newly inserted edge.
 ///
-template<typename VISITOR>
+template<typename VISITOR, class ALLOCATOR>
 inline std::size_t
-Digraph<VISITOR>::insertEdge(
+Digraph<VISITOR, ALLOCATOR>::insertEdge(
     const std::size_t vertexIndex0,
     const std::size_t vertexIndex1
 ) {
@@ -338,6 +422,7 @@ Digraph<VISITOR>::insertEdge(
 
     if(multipleEdgesEnabled()) {
 insertEdgeMark:
+        assert(edges_.size() < static_cast<std::size_t>(std::numeric_limits<IndexType>::max()));
         edges_.push_back(Edge(vertexIndex0, vertexIndex1));
         std::size_t edgeIndex = edges_.size() - 1;
         insertAdjacenciesForEdge(edgeIndex);
@@ -355,13 +440,79 @@ insertEdgeMark:
     }
 }
 
+/// Insert additional edges.
+///
+/// Inserting many edges at once is faster than calling insertEdge() for
+/// each edge. The adjacencies of all vertices are sorted and merged only
+/// once, in O(m log m) time for m edges, instead of one linear-time
+/// insertion per edge and vertex. Edges are inserted and reported to the
+/// visitor in the order of the sequence. If multiple edges are disabled,
+/// pairs of vertices that are connected already or that occur earlier in
+/// the sequence are skipped, as in insertEdge().
+///
+/// \param begin Iterator to the beginning of a sequence of pairs of integer
+///     indices of vertices, e.g. std::pair<std::size_t, std::size_t>.
+/// \param end Iterator to the end of the sequence.
+/// \return Integer index of the first newly inserted edge.
+///
+template<typename VISITOR, class ALLOCATOR>
+template<class ITERATOR>
+inline std::size_t
+Digraph<VISITOR, ALLOCATOR>::insertEdges(
+    ITERATOR begin,
+    ITERATOR end
+) {
+    const std::size_t position = edges_.size();
+    for(; begin != end; ++begin) {
+        assert(static_cast<std::size_t>(begin->first) < numberOfVertices());
+        assert(static_cast<std::size_t>(begin->second) < numberOfVertices());
+        assert(edges_.size() < static_cast<std::size_t>(std::numeric_limits<IndexType>::max()));
+        edges_.push_back(Edge(begin->first, begin->second));
+    }
+
+    if(!multipleEdgesEnabled()) {
+        // sort pairs of vertices, keeping the position in the sequence
+        typedef std::pair<std::pair<std::size_t, std::size_t>, std::size_t> Entry;
+        std::vector<Entry> entries(edges_.size() - position);
+        for(std::size_t j = 0; j < entries.size(); ++j) {
+            const Edge& edge = edges_[position + j];
+            entries[j] = Entry(std::make_pair(edge[0], edge[1]), position + j);
+        }
+        std::sort(entries.begin(), entries.end());
+
+        // keep the first occurrence of each pair that is not connected already
+        std::vector<char> keep(entries.size(), 0);
+        for(std::size_t j = 0; j < entries.size(); ++j) {
+            if(j == 0 || entries[j].first != entries[j - 1].first) {
+                if(!findEdge(entries[j].first.first, entries[j].first.second).first) {
+                    keep[entries[j].second - position] = 1;
+                }
+            }
+        }
+        std::size_t edgeIndex = position;
+        for(std::size_t j = 0; j < keep.size(); ++j) {
+            if(keep[j]) {
+                edges_[edgeIndex] = edges_[position + j];
+                ++edgeIndex;
+            }
+        }
+        edges_.erase(edges_.begin() + edgeIndex, edges_.end());
+    }
+
+    insertAdjacenciesForEdges(position);
+    for(std::size_t edgeIndex = position; edgeIndex < edges_.size(); ++edgeIndex) {
+        visitor_.insertEdge(edgeIndex);
+    }
+    return position;
+}
+
 /// Erase a vertex and all edges connecting this vertex.
 ///
 /// \param vertexIndex Integer index of the vertex to be erased.
 ///
-template<typename VISITOR>
+template<typename VISITOR, class ALLOCATOR>
 void
-Digraph<VISITOR>::eraseVertex(
+Digraph<VISITOR, ALLOCATOR>::eraseVertex(
     const std::size_t vertexIndex
 ) {
     assert(vertexIndex < numberOfVertices());
@@ -384,11 +535,11 @@ Digraph<VISITOR>::eraseVertex(
         // collect indices of edges affected by the move
         std::size_t movingVertexIndex = numberOfVertices() - 1;
         std::set<std::size_t> affectedEdgeIndices;
-        for(Adjacencies::const_iterator it = vertices_[movingVertexIndex].from_.begin();
+        for(typename Adjacencies::const_iterator it = vertices_[movingVertexIndex].from_.begin();
         it != vertices_[movingVertexIndex].from_.end(); ++it) {
             affectedEdgeIndices.insert(it->edge());
         }
-        for(Adjacencies::const_iterator it = vertices_[movingVertexIndex].to_.begin();
+        for(typename Adjacencies::const_iterator it = vertices_[movingVertexIndex].to_.begin();
         it != vertices_[movingVertexIndex].to_.end(); ++it) {
             affectedEdgeIndices.insert(it->edge());
         }
@@ -422,13 +573,82 @@ Digraph<VISITOR>::eraseVertex(
     }
 }
 
+/// Erase all vertices selected by a mask and all edges connecting these vertices.
+///
+/// In contrast to calling eraseVertex() for each vertex, the remaining
+/// vertices and edges keep their relative order and are compacted in a
+/// single pass, in time linear in the size of the graph. Edges are erased
+/// first, as in eraseEdges(). Then, the visitor is notified for each
+/// vertex, in the order of the old indices, either via eraseVertex(old)
+/// or, if its index changes, via relabelVertex(old, new).
+///
+/// \param mask Random access sequence, e.g. std::vector<char>, such that
+///     mask[v] is true for every vertex v to be erased.
+///
+template<typename VISITOR, class ALLOCATOR>
+template<class MASK>
+inline void
+Digraph<VISITOR, ALLOCATOR>::eraseVertices(
+    const MASK& mask
+) {
+    // erase edges connecting erased vertices
+    std::vector<char> edgeMask(numberOfEdges());
+    for(std::size_t e = 0; e < numberOfEdges(); ++e) {
+        edgeMask[e] = (mask[edges_[e][0]] || mask[edges_[e][1]]);
+    }
+    eraseEdges(edgeMask);
+
+    // compute new indices of vertices
+    std::vector<std::size_t> vertexIndices(numberOfVertices());
+    std::size_t numberOfRemainingVertices = 0;
+    for(std::size_t v = 0; v < numberOfVertices(); ++v) {
+        if(!mask[v]) {
+            vertexIndices[v] = numberOfRemainingVertices;
+            ++numberOfRemainingVertices;
+        }
+    }
+    if(numberOfRemainingVertices == numberOfVertices()) {
+        return;
+    }
+
+    // compact vertices and relabel their adjacencies; the relabeling preserves the order
+    for(std::size_t v = 0; v < numberOfVertices(); ++v) {
+        if(!mask[v]) {
+            Vertex& vertex = vertices_[v];
+            for(typename Adjacencies::iterator it = vertex.from_.begin(); it != vertex.from_.end(); ++it) {
+                it->vertex() = vertexIndices[it->vertex()];
+            }
+            for(typename Adjacencies::iterator it = vertex.to_.begin(); it != vertex.to_.end(); ++it) {
+                it->vertex() = vertexIndices[it->vertex()];
+            }
+            if(vertexIndices[v] != v) {
+                std::swap(vertices_[vertexIndices[v]], vertex);
+            }
+        }
+    }
+    vertices_.erase(vertices_.begin() + numberOfRemainingVertices, vertices_.end());
+    for(std::size_t e = 0; e < numberOfEdges(); ++e) {
+        edges_[e][0] = vertexIndices[edges_[e][0]];
+        edges_[e][1] = vertexIndices[edges_[e][1]];
+    }
+
+    for(std::size_t v = 0; v < vertexIndices.size(); ++v) {
+        if(mask[v]) {
+            visitor_.eraseVertex(v);
+        }
+        else if(vertexIndices[v] != v) {
+            visitor_.relabelVertex(v, vertexIndices[v]);
+        }
+    }
+}
+
 /// Erase an edge.
 ///
 /// \param edgeIndex Integer index of the edge to be erased.
 ///
-template<typename VISITOR>
+template<typename VISITOR, class ALLOCATOR>
 inline void
-Digraph<VISITOR>::eraseEdge(
+Digraph<VISITOR, ALLOCATOR>::eraseEdge(
     const std::size_t edgeIndex
 ) {
     assert(edgeIndex < numberOfEdges());
@@ -449,6 +669,69 @@ Digraph<VISITOR>::eraseEdge(
     }
 }
 
+/// Erase all edges selected by a mask.
+///
+/// In contrast to calling eraseEdge() for each edge, the remaining edges
+/// keep their relative order and are compacted in a single pass, in time
+/// linear in the size of the graph. The visitor is notified for each edge,
+/// in the order of the old indices, either via eraseEdge(old) or, if its
+/// index changes, via relabelEdge(old, new).
+///
+/// \param mask Random access sequence, e.g. std::vector<char>, such that
+///     mask[e] is true for every edge e to be erased.
+///
+template<typename VISITOR, class ALLOCATOR>
+template<class MASK>
+inline void
+Digraph<VISITOR, ALLOCATOR>::eraseEdges(
+    const MASK& mask
+) {
+    // compute new indices of edges
+    std::vector<std::size_t> edgeIndices(numberOfEdges());
+    std::size_t numberOfRemainingEdges = 0;
+    for(std::size_t e = 0; e < numberOfEdges(); ++e) {
+        if(!mask[e]) {
+            edgeIndices[e] = numberOfRemainingEdges;
+            ++numberOfRemainingEdges;
+        }
+    }
+    if(numberOfRemainingEdges == numberOfEdges()) {
+        return;
+    }
+
+    // remove and relabel adjacencies; the relabeling preserves the order
+    for(std::size_t v = 0; v < numberOfVertices(); ++v) {
+        Adjacencies* adjacencies[2] = { &vertices_[v].from_, &vertices_[v].to_ };
+        for(std::size_t j = 0; j < 2; ++j) {
+            typename Adjacencies::iterator target = adjacencies[j]->begin();
+            for(typename Adjacencies::iterator it = adjacencies[j]->begin(); it != adjacencies[j]->end(); ++it) {
+                if(!mask[it->edge()]) {
+                    *target = AdjacencyType(it->vertex(), edgeIndices[it->edge()]);
+                    ++target;
+                }
+            }
+            adjacencies[j]->erase(target, adjacencies[j]->end());
+        }
+    }
+
+    // compact edges
+    for(std::size_t e = 0; e < edges_.size(); ++e) {
+        if(!mask[e]) {
+            edges_[edgeIndices[e]] = edges_[e];
+        }
+    }
+    edges_.erase(edges_.begin() + numberOfRemainingEdges, edges_.end());
+
+    for(std::size_t e = 0; e < edgeIndices.size(); ++e) {
+        if(mask[e]) {
+            visitor_.eraseEdge(e);
+        }
+        else if(edgeIndices[e] != e) {
+            visitor_.relabelEdge(e, edgeIndices[e]);
+        }
+    }
+}
+
 /// Get an iterator to the beginning of the sequence of vertices reachable from a given vertex via a single edge.
 ///
 /// \param vertex Integer index of the vertex.
@@ -456,9 +739,9 @@ Digraph<VISITOR>::eraseEdge(
 ///
 /// \sa verticesFromVertexEnd()
 ///
-template<typename VISITOR>
-inline typename Digraph<VISITOR>::VertexIterator
-Digraph<VISITOR>::verticesFromVertexBegin(
+template<typename VISITOR, class ALLOCATOR>
+inline typename Digraph<VISITOR, ALLOCATOR>::VertexIterator
+Digraph<VISITOR, ALLOCATOR>::verticesFromVertexBegin(
     const std::size_t vertex
 ) const {
     return vertices_[vertex].to_.begin();
@@ -471,9 +754,9 @@ Digraph<VISITOR>::verticesFromVertexBegin(
 ///
 /// \sa verticesFromVertexBegin()
 ///
-template<typename VISITOR>
-inline typename Digraph<VISITOR>::VertexIterator
-Digraph<VISITOR>::verticesFromVertexEnd(
+template<typename VISITOR, class ALLOCATOR>
+inline typename Digraph<VISITOR, ALLOCATOR>::VertexIterator
+Digraph<VISITOR, ALLOCATOR>::verticesFromVertexEnd(
     const std::size_t vertex
 ) const {
     return vertices_[vertex].to_.end();
@@ -486,9 +769,9 @@ Digraph<VISITOR>::verticesFromVertexEnd(
 ///
 /// \sa verticesToVertexEnd()
 ///
-template<typename VISITOR>
-inline typename Digraph<VISITOR>::VertexIterator
-Digraph<VISITOR>::verticesToVertexBegin(
+template<typename VISITOR, class ALLOCATOR>
+inline typename Digraph<VISITOR, ALLOCATOR>::VertexIterator
+Digraph<VISITOR, ALLOCATOR>::verticesToVertexBegin(
     const std::size_t vertex
 ) const {
     return vertices_[vertex].from_.begin();
@@ -501,9 +784,9 @@ Digraph<VISITOR>::verticesToVertexBegin(
 ///
 /// \sa verticesToVertexBegin()
 ///
-template<typename VISITOR>
-inline typename Digraph<VISITOR>::VertexIterator
-Digraph<VISITOR>::verticesToVertexEnd(
+template<typename VISITOR, class ALLOCATOR>
+inline typename Digraph<VISITOR, ALLOCATOR>::VertexIterator
+Digraph<VISITOR, ALLOCATOR>::verticesToVertexEnd(
     const std::size_t vertex
 ) const {
     return vertices_[vertex].from_.end();
@@ -516,9 +799,9 @@ Digraph<VISITOR>::verticesToVertexEnd(
 ///
 /// \sa edgesFromVertexEnd()
 ///
-template<typename VISITOR>
-inline typename Digraph<VISITOR>::EdgeIterator
-Digraph<VISITOR>::edgesFromVertexBegin(
+template<typename VISITOR, class ALLOCATOR>
+inline typename Digraph<VISITOR, ALLOCATOR>::EdgeIterator
+Digraph<VISITOR, ALLOCATOR>::edgesFromVertexBegin(
     const std::size_t vertex
 ) const {
     return vertices_[vertex].to_.begin();
@@ -531,9 +814,9 @@ Digraph<VISITOR>::edgesFromVertexBegin(
 ///
 /// \sa edgesFromVertexBegin()
 ///
-template<typename VISITOR>
-inline typename Digraph<VISITOR>::EdgeIterator
-Digraph<VISITOR>::edgesFromVertexEnd(
+template<typename VISITOR, class ALLOCATOR>
+inline typename Digraph<VISITOR, ALLOCATOR>::EdgeIterator
+Digraph<VISITOR, ALLOCATOR>::edgesFromVertexEnd(
     const std::size_t vertex
 ) const {
     return vertices_[vertex].to_.end();
@@ -546,9 +829,9 @@ Digraph<VISITOR>::edgesFromVertexEnd(
 ///
 /// \sa edgesToVertexEnd()
 ///
-template<typename VISITOR>
-inline typename Digraph<VISITOR>::EdgeIterator
-Digraph<VISITOR>::edgesToVertexBegin(
+template<typename VISITOR, class ALLOCATOR>
+inline typename Digraph<VISITOR, ALLOCATOR>::EdgeIterator
+Digraph<VISITOR, ALLOCATOR>::edgesToVertexBegin(
     const std::size_t vertex
 ) const {
     return vertices_[vertex].from_.begin();
@@ -561,9 +844,9 @@ Digraph<VISITOR>::edgesToVertexBegin(
 ///
 /// \sa edgesToVertexBegin()
 ///
-template<typename VISITOR>
-inline typename Digraph<VISITOR>::EdgeIterator
-Digraph<VISITOR>::edgesToVertexEnd(
+template<typename VISITOR, class ALLOCATOR>
+inline typename Digraph<VISITOR, ALLOCATOR>::EdgeIterator
+Digraph<VISITOR, ALLOCATOR>::edgesToVertexEnd(
     const std::size_t vertex
 ) const {
     return vertices_[vertex].from_.end();
@@ -576,9 +859,9 @@ Digraph<VISITOR>::edgesToVertexEnd(
 ///
 /// \sa adjacenciesFromVertexEnd()
 ///
-template<typename VISITOR>
-inline typename Digraph<VISITOR>::AdjacencyIterator
-Digraph<VISITOR>::adjacenciesFromVertexBegin(
+template<typename VISITOR, class ALLOCATOR>
+inline typename Digraph<VISITOR, ALLOCATOR>::AdjacencyIterator
+Digraph<VISITOR, ALLOCATOR>::adjacenciesFromVertexBegin(
     const std::size_t vertex
 ) const {
     return vertices_[vertex].to_.begin();
@@ -591,9 +874,9 @@ Digraph<VISITOR>::adjacenciesFromVertexBegin(
 ///
 /// \sa adjacenciesFromVertexBegin()
 ///
-template<typename VISITOR>
-inline typename Digraph<VISITOR>::AdjacencyIterator
-Digraph<VISITOR>::adjacenciesFromVertexEnd(
+template<typename VISITOR, class ALLOCATOR>
+inline typename Digraph<VISITOR, ALLOCATOR>::AdjacencyIterator
+Digraph<VISITOR, ALLOCATOR>::adjacenciesFromVertexEnd(
     const std::size_t vertex
 ) const {
     return vertices_[vertex].to_.end();
@@ -606,9 +889,9 @@ Digraph<VISITOR>::adjacenciesFromVertexEnd(
 ///
 /// \sa adjacenciesToVertexEnd()
 ///
-template<typename VISITOR>
-inline typename Digraph<VISITOR>::AdjacencyIterator
-Digraph<VISITOR>::adjacenciesToVertexBegin(
+template<typename VISITOR, class ALLOCATOR>
+inline typename Digraph<VISITOR, ALLOCATOR>::AdjacencyIterator
+Digraph<VISITOR, ALLOCATOR>::adjacenciesToVertexBegin(
     const std::size_t vertex
 ) const {
     return vertices_[vertex].from_.begin();
@@ -621,9 +904,9 @@ Digraph<VISITOR>::adjacenciesToVertexBegin(
 ///
 /// \sa adjacenciesToVertexBegin()
 ///
-template<typename VISITOR>
-inline typename Digraph<VISITOR>::AdjacencyIterator
-Digraph<VISITOR>::adjacenciesToVertexEnd(
+template<typename VISITOR, class ALLOCATOR>
+inline typename Digraph<VISITOR, ALLOCATOR>::AdjacencyIterator
+Digraph<VISITOR, ALLOCATOR>::adjacenciesToVertexEnd(
     const std::size_t vertex
 ) const {
     return vertices_[vertex].from_.end();
@@ -633,9 +916,9 @@ Digraph<VISITOR>::adjacenciesToVertexEnd(
 ///
 /// \param number Total number of vertices.
 ///
-template<typename VISITOR>
+template<typename VISITOR, class ALLOCATOR>
 inline void
-Digraph<VISITOR>::reserveVertices(
+Digraph<VISITOR, ALLOCATOR>::reserveVertices(
     const std::size_t number
 ) {
     vertices_.reserve(number);
@@ -645,9 +928,9 @@ Digraph<VISITOR>::reserveVertices(
 ///
 /// \param number Total number of edges.
 ///
-template<typename VISITOR>
+template<typename VISITOR, class ALLOCATOR>
 inline void
-Digraph<VISITOR>::reserveEdges(
+Digraph<VISITOR, ALLOCATOR>::reserveEdges(
     const std::size_t number
 ) {
     edges_.reserve(number);
@@ -658,9 +941,9 @@ Digraph<VISITOR>::reserveEdges(
 /// \param vertex Vertex.
 /// \param j Number of the adjacency.
 ///
-template<typename VISITOR>
-inline const typename Digraph<VISITOR>::AdjacencyType&
-Digraph<VISITOR>::adjacencyFromVertex(
+template<typename VISITOR, class ALLOCATOR>
+inline const typename Digraph<VISITOR, ALLOCATOR>::AdjacencyType&
+Digraph<VISITOR, ALLOCATOR>::adjacencyFromVertex(
     const std::size_t vertex,
     const std::size_t j
 ) const {
@@ -672,9 +955,9 @@ Digraph<VISITOR>::adjacencyFromVertex(
 /// \param vertex Vertex.
 /// \param j Number of the adjacency.
 ///
-template<typename VISITOR>
-inline const typename Digraph<VISITOR>::AdjacencyType&
-Digraph<VISITOR>::adjacencyToVertex(
+template<typename VISITOR, class ALLOCATOR>
+inline const typename Digraph<VISITOR, ALLOCATOR>::AdjacencyType&
+Digraph<VISITOR, ALLOCATOR>::adjacencyToVertex(
     const std::size_t vertex,
     const std::size_t j
 ) const {
@@ -689,9 +972,9 @@ Digraph<VISITOR>::adjacencyToVertex(
 ///     and pair.second is the index of such an edge. if no edge from vertex0
 ///     to vertex1 exists, pair.first is false and pair.second is undefined.
 ///
-template<typename VISITOR>
+template<typename VISITOR, class ALLOCATOR>
 inline std::pair<bool, std::size_t>
-Digraph<VISITOR>::findEdge(
+Digraph<VISITOR, ALLOCATOR>::findEdge(
     const std::size_t vertex0,
     const std::size_t vertex1
 ) const {
@@ -713,13 +996,21 @@ Digraph<VISITOR>::findEdge(
     }
 }
 
+/// Get the allocator of the adjacencies of all vertices.
+///
+template<typename VISITOR, class ALLOCATOR>
+inline typename Digraph<VISITOR, ALLOCATOR>::Allocator
+Digraph<VISITOR, ALLOCATOR>::get_allocator() const {
+    return allocator_;
+}
+
 /// Indicate if multiple edges are enabled.
 ///
 /// \return true if multiple edges are enabled, false otherwise.
 ///
-template<typename VISITOR>
+template<typename VISITOR, class ALLOCATOR>
 inline bool
-Digraph<VISITOR>::multipleEdgesEnabled() const {
+Digraph<VISITOR, ALLOCATOR>::multipleEdgesEnabled() const {
     return multipleEdgesEnabled_;
 }
 
@@ -729,15 +1020,15 @@ Digraph<VISITOR>::multipleEdgesEnabled() const {
 ///
 /// \return reference the a Boolean flag.
 ///
-template<typename VISITOR>
+template<typename VISITOR, class ALLOCATOR>
 inline bool&
-Digraph<VISITOR>::multipleEdgesEnabled() {
+Digraph<VISITOR, ALLOCATOR>::multipleEdgesEnabled() {
     return multipleEdgesEnabled_;
 }
 
-template<typename VISITOR>
+template<typename VISITOR, class ALLOCATOR>
 inline void
-Digraph<VISITOR>::insertAdjacenciesForEdge(
+Digraph<VISITOR, ALLOCATOR>::insertAdjacenciesForEdge(
     const std::size_t edgeIndex
 ) {
     const Edge& edge = edges_[edgeIndex];
@@ -751,9 +1042,49 @@ Digraph<VISITOR>::insertAdjacenciesForEdge(
     );
 }
 
-template<typename VISITOR>
+// inserts the adjacencies for all edges from the given index onwards,
+// merging the sorted adjacencies into the adjacencies of each vertex once.
+template<typename VISITOR, class ALLOCATOR>
+inline void
+Digraph<VISITOR, ALLOCATOR>::insertAdjacenciesForEdges(
+    const std::size_t edgeIndex
+) {
+    typedef std::pair<std::size_t, AdjacencyType> Entry;
+    std::vector<Entry> entriesTo;
+    std::vector<Entry> entriesFrom;
+    entriesTo.reserve(edges_.size() - edgeIndex);
+    entriesFrom.reserve(edges_.size() - edgeIndex);
+    for(std::size_t e = edgeIndex; e < edges_.size(); ++e) {
+        const std::size_t vertexIndex0 = edges_[e][0];
+        const std::size_t vertexIndex1 = edges_[e][1];
+        entriesTo.push_back(Entry(vertexIndex0, AdjacencyType(vertexIndex1, e)));
+        entriesFrom.push_back(Entry(vertexIndex1, AdjacencyType(vertexIndex0, e)));
+    }
+    std::sort(entriesTo.begin(), entriesTo.end());
+    std::sort(entriesFrom.begin(), entriesFrom.end());
+
+    std::vector<AdjacencyType> adjacencies;
+    for(std::size_t j = 0; j < entriesTo.size(); ) {
+        const std::size_t vertexIndex = entriesTo[j].first;
+        adjacencies.clear();
+        for(; j < entriesTo.size() && entriesTo[j].first == vertexIndex; ++j) {
+            adjacencies.push_back(entriesTo[j].second);
+        }
+        vertices_[vertexIndex].to_.insert(adjacencies.begin(), adjacencies.end());
+    }
+    for(std::size_t j = 0; j < entriesFrom.size(); ) {
+        const std::size_t vertexIndex = entriesFrom[j].first;
+        adjacencies.clear();
+        for(; j < entriesFrom.size() && entriesFrom[j].first == vertexIndex; ++j) {
+            adjacencies.push_back(entriesFrom[j].second);
+        }
+        vertices_[vertexIndex].from_.insert(adjacencies.begin(), adjacencies.end());
+    }
+}
+
+template<typename VISITOR, class ALLOCATOR>
 inline void
-Digraph<VISITOR>::eraseAdjacenciesForEdge(
+Digraph<VISITOR, ALLOCATOR>::eraseAdjacenciesForEdge(
     const std::size_t edgeIndex
 ) {
     const Edge& edge = edges_[edgeIndex];
@@ -763,7 +1094,7 @@ Digraph<VISITOR>::eraseAdjacenciesForEdge(
     Vertex& vertex1 = vertices_[vertexIndex1];
 
     AdjacencyType adj(vertexIndex1, edgeIndex);
-    RandomAccessSet<AdjacencyType>::iterator it = vertex0.to_.find(adj);
+    typename Adjacencies::iterator it = vertex0.to_.find(adj);
     assert(it != vertex0.to_.end());
     vertex0.to_.erase(it);
 
@@ -0,0 +1,685 @@
+#pragma once
+#ifndef ANDRES_GRAPH_DYNAMIC_CONNECTIVITY_HXX
+#define ANDRES_GRAPH_DYNAMIC_CONNECTIVITY_HXX
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility> // std::pair
+#include <vector>
+
+#include "subgraph.hxx"
+
+namespace andres {
+namespace graph {
+
+/// Connectivity of a graph from which edges are erased (and to which edges
+/// are inserted) one at a time.
+///
+/// Holm J., de Lichtenberg K. and Thorup M. (2001). Poly-logarithmic
+/// deterministic fully-dynamic algorithms for connectivity, minimum spanning
+/// tree, 2-edge, and biconnectivity. Journal of the ACM 48(4):723-760.
+///
+/// A spanning forest is maintained as Euler tours stored in randomized
+/// balanced search trees. Every edge has a level that only ever increases.
+/// When an edge of the spanning forest is erased, a replacement edge is
+/// searched from the smaller of the two trees, level by level, and the edges
+/// inspected in vain are moved one level up. As every level at most halves
+/// the size of trees, each edge is inspected O(log |V|) times in total.
+///
+/// Amortized runtime complexity O(log(|V|)^2) per insertion or erasure and
+/// O(log |V|) per query.
+///
+/// Edges are identified by the indices of the graph passed to build(),
+/// followed by the indices returned by insertEdge(). Self-loops and
+/// parallel edges are allowed.
+///
+template<class GRAPH>
+class DynamicConnectivity {
+public:
+    typedef GRAPH Graph;
+
+    DynamicConnectivity();
+    void build(const Graph&);
+    template<class SUBGRAPH_MASK>
+        void build(const Graph&, const SUBGRAPH_MASK&);
+    std::size_t insertEdge(const std::size_t, const std::size_t);
+    void eraseEdge(const std::size_t);
+    bool areConnected(const std::size_t, const std::size_t) const;
+    bool isEdgeErased(const std::size_t) const;
+    std::size_t numberOfVertices() const;
+    std::size_t numberOfEdges() const;
+
+private:
+    enum EdgeState : unsigned char { NON_TREE_EDGE, TREE_EDGE, ERASED_EDGE };
+
+    static const std::size_t NONE;
+    static const unsigned char HAS_TREE_EDGES = 1;
+    static const unsigned char HAS_NON_TREE_EDGES = 2;
+
+    // node of a treap that stores an Euler tour in its in-order sequence.
+    // a vertex has one node per level at which it is incident to a tree
+    // edge, a tree edge two nodes (arcs) per level up to its own.
+    struct Node {
+        std::size_t parent_;
+        std::size_t left_;
+        std::size_t right_;
+        std::size_t priority_;
+        std::size_t vertex_; // NONE for arcs
+        std::size_t numberOfVertices_; // in the subtree
+        std::size_t numberOfTreeEdges_; // incident tree edges of this level
+        std::size_t numberOfNonTreeEdges_; // incident non-tree edges of this level
+        unsigned char flags_; // of the subtree
+    };
+    struct Edge {
+        std::size_t vertices_[2];
+        std::size_t level_;
+        EdgeState state_;
+    };
+
+    // treaps
+    std::size_t newNode(const std::size_t);
+    void freeNode(const std::size_t);
+    void update(const std::size_t);
+    void updatePath(std::size_t);
+    std::size_t root(std::size_t) const;
+    std::size_t merge(const std::size_t, const std::size_t);
+    std::pair<std::size_t, std::size_t> split(const std::size_t, const bool);
+    std::size_t findFlagged(std::size_t, const unsigned char) const;
+
+    // Euler tour forests, one per level
+    std::size_t vertexNode(const std::size_t, const std::size_t);
+    std::size_t findVertexNode(const std::size_t, const std::size_t) const;
+    std::size_t reroot(const std::size_t);
+    void link(const std::size_t, const std::size_t);
+    void cut(const std::size_t, const std::size_t);
+
+    // edges
+    void insertIncidences(const std::size_t);
+    void eraseIncidences(const std::size_t);
+    bool isEdgeAt(const std::size_t, const std::size_t, const EdgeState) const;
+    bool replace(const std::size_t, const std::size_t, const std::size_t);
+
+    std::size_t numberOfVertices_;
+    std::vector<Node> nodes_;
+    std::vector<std::size_t> freeNodes_;
+    // edges incident to each vertex node, including edges that have been
+    // erased or moved to another level since, which are dropped lazily
+    std::vector<std::vector<std::size_t> > treeEdges_;
+    std::vector<std::vector<std::size_t> > nonTreeEdges_;
+    std::vector<std::vector<std::size_t> > vertexNodes_; // by level and vertex
+    std::vector<Edge> edges_;
+    std::vector<std::vector<std::size_t> > arcs_; // of each tree edge, by level
+    std::uint64_t randomState_;
+};
+
+template<class GRAPH>
+const std::size_t DynamicConnectivity<GRAPH>::NONE = std::numeric_limits<std::size_t>::max();
+
+template<class GRAPH>
+const unsigned char DynamicConnectivity<GRAPH>::HAS_TREE_EDGES;
+
+template<class GRAPH>
+const unsigned char DynamicConnectivity<GRAPH>::HAS_NON_TREE_EDGES;
+
+template<class GRAPH>
+inline
+DynamicConnectivity<GRAPH>::DynamicConnectivity()
+:   numberOfVertices_(0),
+    nodes_(),
+    freeNodes_(),
+    treeEdges_(),
+    nonTreeEdges_(),
+    vertexNodes_(),
+    edges_(),
+    arcs_(),
+    randomState_(0x9E3779B97F4A7C15ULL)
+{}
+
+/// Build the structure for all edges of a graph.
+///
+/// Runtime complexity O(|E| log |V|).
+///
+/// \param graph An undirected graph.
+///
+template<class GRAPH>
+inline void
+DynamicConnectivity<GRAPH>::build(
+    const Graph& graph
+) {
+    build(graph, DefaultSubgraphMask<>());
+}
+
+/// Build the structure for the edges of a subgraph. Edges not in the
+/// subgraph keep their indices but are erased from the start.
+///
+/// \param graph An undirected graph.
+/// \param mask A subgraph mask such as DefaultSubgraphMask.
+///
+template<class GRAPH>
+template<class SUBGRAPH_MASK>
+inline void
+DynamicConnectivity<GRAPH>::build(
+    const Graph& graph,
+    const SUBGRAPH_MASK& mask
+) {
+    numberOfVertices_ = graph.numberOfVertices();
+    nodes_.clear();
+    freeNodes_.clear();
+    treeEdges_.clear();
+    nonTreeEdges_.clear();
+    vertexNodes_.clear();
+    edges_.clear();
+    arcs_.clear();
+    edges_.reserve(graph.numberOfEdges());
+    arcs_.reserve(graph.numberOfEdges());
+
+    for(std::size_t e = 0; e < graph.numberOfEdges(); ++e) {
+        const std::size_t v0 = graph.vertexOfEdge(e, 0);
+        const std::size_t v1 = graph.vertexOfEdge(e, 1);
+        if(detail::isEdgeInSubgraph(mask, e)
+        && detail::isVertexInSubgraph(mask, v0)
+        && detail::isVertexInSubgraph(mask, v1)) {
+            insertEdge(v0, v1);
+        }
+        else {
+            Edge edge = {{v0, v1}, 0, ERASED_EDGE};
+            edges_.push_back(edge);
+            arcs_.push_back(std::vector<std::size_t>());
+        }
+    }
+}
+
+/// Insert an edge.
+///
+/// \param vertex0 Integer index of a vertex.
+/// \param vertex1 Integer index of a vertex.
+/// \return Integer index of the new edge.
+///
+template<class GRAPH>
+inline std::size_t
+DynamicConnectivity<GRAPH>::insertEdge(
+    const std::size_t vertex0,
+    const std::size_t vertex1
+) {
+    assert(vertex0 < numberOfVertices_);
+    assert(vertex1 < numberOfVertices_);
+
+    const std::size_t e = edges_.size();
+    const EdgeState state = areConnected(vertex0, vertex1) ? NON_TREE_EDGE : TREE_EDGE;
+    Edge edge = {{vertex0, vertex1}, 0, state};
+    edges_.push_back(edge);
+    arcs_.push_back(std::vector<std::size_t>());
+    if(state == TREE_EDGE) {
+        link(0, e);
+    }
+    insertIncidences(e);
+    return e;
+}
+
+/// Erase an edge.
+///
+/// \param edge Integer index of an edge that has not been erased.
+///
+template<class GRAPH>
+inline void
+DynamicConnectivity<GRAPH>::eraseEdge(
+    const std::size_t edge
+) {
+    assert(edge < edges_.size());
+    assert(edges_[edge].state_ != ERASED_EDGE);
+
+    const std::size_t v0 = edges_[edge].vertices_[0];
+    const std::size_t v1 = edges_[edge].vertices_[1];
+    const std::size_t level = edges_[edge].level_;
+    const bool isTreeEdge = edges_[edge].state_ == TREE_EDGE;
+
+    eraseIncidences(edge);
+    edges_[edge].state_ = ERASED_EDGE;
+    if(isTreeEdge) {
+        for(std::size_t i = 0; i <= level; ++i) {
+            cut(i, edge);
+        }
+        arcs_[edge].clear();
+        for(std::size_t i = level + 1; i > 0; --i) {
+            if(replace(i - 1, v0, v1)) {
+                break;
+            }
+        }
+    }
+}
+
+/// Indicate if two vertices are connected.
+///
+/// \param vertex0 Integer index of a vertex.
+/// \param vertex1 Integer index of a vertex.
+///
+template<class GRAPH>
+inline bool
+DynamicConnectivity<GRAPH>::areConnected(
+    const std::size_t vertex0,
+    const std::size_t vertex1
+) const {
+    if(vertex0 == vertex1) {
+        return true;
+    }
+    const std::size_t node0 = findVertexNode(0, vertex0);
+    const std::size_t node1 = findVertexNode(0, vertex1);
+    return node0 != NONE && node1 != NONE && root(node0) == root(node1);
+}
+
+/// Indicate if an edge has been erased.
+///
+/// \param edge Integer index of an edge.
+///
+template<class GRAPH>
+inline bool
+DynamicConnectivity<GRAPH>::isEdgeErased(
+    const std::size_t edge
+) const {
+    return edges_[edge].state_ == ERASED_EDGE;
+}
+
+template<class GRAPH>
+inline std::size_t
+DynamicConnectivity<GRAPH>::numberOfVertices() const {
+    return numberOfVertices_;
+}
+
+/// Get the number of edges, including erased edges.
+///
+template<class GRAPH>
+inline std::size_t
+DynamicConnectivity<GRAPH>::numberOfEdges() const {
+    return edges_.size();
+}
+
+template<class GRAPH>
+inline std::size_t
+DynamicConnectivity<GRAPH>::newNode(
+    const std::size_t vertex
+) {
+    // xorshift
+    randomState_ ^= randomState_ << 13;
+    randomState_ ^= randomState_ >> 7;
+    randomState_ ^= randomState_ << 17;
+
+    Node node = {NONE, NONE, NONE, static_cast<std::size_t>(randomState_), vertex, vertex != NONE ? 1u : 0u, 0, 0, 0};
+    if(freeNodes_.empty()) {
+        nodes_.push_back(node);
+        treeEdges_.push_back(std::vector<std::size_t>());
+        nonTreeEdges_.push_back(std::vector<std::size_t>());
+        return nodes_.size() - 1;
+    }
+    else {
+        const std::size_t x = freeNodes_.back();
+        freeNodes_.pop_back();
+        nodes_[x] = node;
+        return x;
+    }
+}
+
+template<class GRAPH>
+inline void
+DynamicConnectivity<GRAPH>::freeNode(
+    const std::size_t x
+) {
+    freeNodes_.push_back(x);
+}
+
+template<class GRAPH>
+inline void
+DynamicConnectivity<GRAPH>::update(
+    const std::size_t x
+) {
+    Node& node = nodes_[x];
+    node.numberOfVertices_ = node.vertex_ != NONE ? 1 : 0;
+    node.flags_ = (node.numberOfTreeEdges_ != 0 ? HAS_TREE_EDGES : 0)
+        | (node.numberOfNonTreeEdges_ != 0 ? HAS_NON_TREE_EDGES : 0);
+    if(node.left_ != NONE) {
+        node.numberOfVertices_ += nodes_[node.left_].numberOfVertices_;
+        node.flags_ |= nodes_[node.left_].flags_;
+    }
+    if(node.right_ != NONE) {
+        node.numberOfVertices_ += nodes_[node.right_].numberOfVertices_;
+        node.flags_ |= nodes_[node.right_].flags_;
+    }
+}
+
+// update a node and all its ancestors
+template<class GRAPH>
+inline void
+DynamicConnectivity<GRAPH>::updatePath(
+    std::size_t x
+) {
+    for(; x != NONE; x = nodes_[x].parent_) {
+        update(x);
+    }
+}
+
+template<class GRAPH>
+inline std::size_t
+DynamicConnectivity<GRAPH>::root(
+    std::size_t x
+) const {
+    while(nodes_[x].parent_ != NONE) {
+        x = nodes_[x].parent_;
+    }
+    return x;
+}
+
+// concatenate the sequences of two treaps, given by their roots
+template<class GRAPH>
+inline std::size_t
+DynamicConnectivity<GRAPH>::merge(
+    const std::size_t a,
+    const std::size_t b
+) {
+    if(a == NONE) {
+        return b;
+    }
+    if(b == NONE) {
+        return a;
+    }
+    if(nodes_[a].priority_ > nodes_[b].priority_) {
+        const std::size_t right = merge(nodes_[a].right_, b);
+        nodes_[a].right_ = right;
+        nodes_[right].parent_ = a;
+        update(a);
+        return a;
+    }
+    else {
+        const std::size_t left = merge(a, nodes_[b].left_);
+        nodes_[b].left_ = left;
+        nodes_[left].parent_ = b;
+        update(b);
+        return b;
+    }
+}
+
+// split the sequence of a treap before or after a node. returns the roots of
+// both parts.
+template<class GRAPH>
+inline std::pair<std::size_t, std::size_t>
+DynamicConnectivity<GRAPH>::split(
+    const std::size_t x,
+    const bool before
+) {
+    std::size_t p = nodes_[x].parent_;
+    std::size_t left;
+    std::size_t right;
+    if(before) {
+        left = nodes_[x].left_;
+        nodes_[x].left_ = NONE;
+        right = x;
+    }
+    else {
+        right = nodes_[x].right_;
+        nodes_[x].right_ = NONE;
+        left = x;
+    }
+    if(left != NONE) {
+        nodes_[left].parent_ = NONE;
+    }
+    if(right != NONE) {
+        nodes_[right].parent_ = NONE;
+    }
+    update(x);
+
+    // walk up, attaching each ancestor and one of its subtrees to the part
+    // to which it belongs
+    std::size_t child = x;
+    while(p != NONE) {
+        const std::size_t next = nodes_[p].parent_;
+        if(nodes_[p].right_ == child) {
+            nodes_[p].right_ = left;
+            if(left != NONE) {
+                nodes_[left].parent_ = p;
+            }
+            left = p;
+        }
+        else {
+            nodes_[p].left_ = right;
+            if(right != NONE) {
+                nodes_[right].parent_ = p;
+            }
+            right = p;
+        }
+        nodes_[p].parent_ = NONE;
+        update(p);
+        child = p;
+        p = next;
+    }
+    return std::make_pair(left, right);
+}
+
+// first node in the sequence of a treap whose own flags contain a flag
+template<class GRAPH>
+inline std::size_t
+DynamicConnectivity<GRAPH>::findFlagged(
+    std::size_t x,
+    const unsigned char flag
+) const {
+    if(!(nodes_[x].flags_ & flag)) {
+        return NONE;
+    }
+    for(;;) {
+        const Node& node = nodes_[x];
+        if(node.left_ != NONE && (nodes_[node.left_].flags_ & flag)) {
+            x = node.left_;
+        }
+        else if(((node.numberOfTreeEdges_ != 0 ? HAS_TREE_EDGES : 0)
+            | (node.numberOfNonTreeEdges_ != 0 ? HAS_NON_TREE_EDGES : 0)) & flag) {
+            return x;
+        }
+        else {
+            assert(node.right_ != NONE);
+            x = node.right_;
+        }
+    }
+}
+
+template<class GRAPH>
+inline std::size_t
+DynamicConnectivity<GRAPH>::vertexNode(
+    const std::size_t level,
+    const std::size_t vertex
+) {
+    while(vertexNodes_.size() <= level) {
+        vertexNodes_.push_back(std::vector<std::size_t>(numberOfVertices_, NONE));
+    }
+    if(vertexNodes_[level][vertex] == NONE) {
+        const std::size_t x = newNode(vertex);
+        vertexNodes_[level][vertex] = x;
+    }
+    return vertexNodes_[level][vertex];
+}
+
+template<class GRAPH>
+inline std::size_t
+DynamicConnectivity<GRAPH>::findVertexNode(
+    const std::size_t level,
+    const std::size_t vertex
+) const {
+    return level < vertexNodes_.size() ? vertexNodes_[level][vertex] : NONE;
+}
+
+// rotate the Euler tour of a tree to begin at a vertex. returns the root.
+template<class GRAPH>
+inline std::size_t
+DynamicConnectivity<GRAPH>::reroot(
+    const std::size_t x
+) {
+    const std::pair<std::size_t, std::size_t> parts = split(x, true);
+    return merge(parts.second, parts.first);
+}
+
+// join the trees of the endpoints of an edge at a level by the edge
+template<class GRAPH>
+inline void
+DynamicConnectivity<GRAPH>::link(
+    const std::size_t level,
+    const std::size_t edge
+) {
+    assert(arcs_[edge].size() == 2 * level);
+
+    const std::size_t node0 = vertexNode(level, edges_[edge].vertices_[0]);
+    const std::size_t node1 = vertexNode(level, edges_[edge].vertices_[1]);
+    const std::size_t root0 = reroot(node0);
+    const std::size_t root1 = reroot(node1);
+    const std::size_t arc01 = newNode(NONE);
+    const std::size_t arc10 = newNode(NONE);
+    arcs_[edge].push_back(arc01);
+    arcs_[edge].push_back(arc10);
+    merge(merge(merge(root0, arc01), root1), arc10);
+}
+
+// split the tree of an edge at a level into the trees of its endpoints.
+// the Euler tour A arc B arc C falls into the tours B and C A.
+template<class GRAPH>
+inline void
+DynamicConnectivity<GRAPH>::cut(
+    const std::size_t level,
+    const std::size_t edge
+) {
+    const std::size_t arc0 = arcs_[edge][2 * level];
+    const std::size_t arc1 = arcs_[edge][2 * level + 1];
+
+    const std::size_t a = split(arc0, true).first;
+    const std::size_t b = split(arc0, false).second;
+    if(b != NONE && root(arc1) == b) {
+        split(arc1, true);
+        const std::size_t c = split(arc1, false).second;
+        merge(a, c);
+    }
+    else {
+        const std::size_t a0 = split(arc1, true).first;
+        split(arc1, false);
+        merge(a0, b);
+    }
+    freeNode(arc0);
+    freeNode(arc1);
+}
+
+template<class GRAPH>
+inline void
+DynamicConnectivity<GRAPH>::insertIncidences(
+    const std::size_t edge
+) {
+    const Edge& e = edges_[edge];
+    if(e.vertices_[0] == e.vertices_[1]) {
+        return; // self-loops are never needed to connect anything
+    }
+    for(std::size_t j = 0; j < 2; ++j) {
+        const std::size_t x = vertexNode(e.level_, e.vertices_[j]);
+        if(e.state_ == TREE_EDGE) {
+            treeEdges_[x].push_back(edge);
+            ++nodes_[x].numberOfTreeEdges_;
+        }
+        else {
+            nonTreeEdges_[x].push_back(edge);
+            ++nodes_[x].numberOfNonTreeEdges_;
+        }
+        updatePath(x);
+    }
+}
+
+template<class GRAPH>
+inline void
+DynamicConnectivity<GRAPH>::eraseIncidences(
+    const std::size_t edge
+) {
+    const Edge& e = edges_[edge];
+    if(e.vertices_[0] == e.vertices_[1]) {
+        return;
+    }
+    for(std::size_t j = 0; j < 2; ++j) {
+        const std::size_t x = findVertexNode(e.level_, e.vertices_[j]);
+        if(e.state_ == TREE_EDGE) {
+            --nodes_[x].numberOfTreeEdges_;
+        }
+        else {
+            --nodes_[x].numberOfNonTreeEdges_;
+        }
+        updatePath(x);
+    }
+}
+
+template<class GRAPH>
+inline bool
+DynamicConnectivity<GRAPH>::isEdgeAt(
+    const std::size_t edge,
+    const std::size_t level,
+    const EdgeState state
+) const {
+    return edges_[edge].state_ == state && edges_[edge].level_ == level;
+}
+
+// search for an edge that replaces an erased tree edge between the trees of
+// two vertices at a level. the tree edges of the smaller tree and the
+// non-tree edges inspected in vain are moved one level up.
+template<class GRAPH>
+inline bool
+DynamicConnectivity<GRAPH>::replace(
+    const std::size_t level,
+    const std::size_t vertex0,
+    const std::size_t vertex1
+) {
+    const std::size_t root0 = root(findVertexNode(level, vertex0));
+    const std::size_t root1 = root(findVertexNode(level, vertex1));
+    const std::size_t smallRoot = nodes_[root0].numberOfVertices_ <= nodes_[root1].numberOfVertices_ ? root0 : root1;
+
+    std::vector<std::size_t> edges;
+    for(;;) {
+        const std::size_t x = findFlagged(smallRoot, HAS_TREE_EDGES);
+        if(x == NONE) {
+            break;
+        }
+        edges.clear();
+        edges.swap(treeEdges_[x]);
+        for(std::size_t f : edges) {
+            if(isEdgeAt(f, level, TREE_EDGE)) {
+                eraseIncidences(f);
+                ++edges_[f].level_;
+                link(level + 1, f);
+                insertIncidences(f);
+            }
+        }
+    }
+
+    for(;;) {
+        const std::size_t x = findFlagged(smallRoot, HAS_NON_TREE_EDGES);
+        if(x == NONE) {
+            return false;
+        }
+        const std::size_t v = nodes_[x].vertex_;
+        edges.clear();
+        edges.swap(nonTreeEdges_[x]);
+        for(std::size_t k = 0; k < edges.size(); ++k) {
+            const std::size_t f = edges[k];
+            if(!isEdgeAt(f, level, NON_TREE_EDGE)) {
+                continue;
+            }
+            const std::size_t w = edges_[f].vertices_[0] == v ? edges_[f].vertices_[1] : edges_[f].vertices_[0];
+            eraseIncidences(f);
+            if(root(findVertexNode(level, w)) != smallRoot) {
+                // replacement found
+                edges_[f].state_ = TREE_EDGE;
+                for(std::size_t i = 0; i <= level; ++i) {
+                    link(i, f);
+                }
+                insertIncidences(f);
+                nonTreeEdges_[x].insert(nonTreeEdges_[x].end(), edges.begin() + k + 1, edges.end());
+                return true;
+            }
+            ++edges_[f].level_;
+            insertIncidences(f);
+        }
+    }
+}
+
+} // namespace graph
+} // namespace andres
+
+#endif // #ifndef ANDRES_GRAPH_DYNAMIC_CONNECTIVITY_HXX
@@ -0,0 +1,264 @@
+#pragma once
+#ifndef ANDRES_GRAPH_EDGE_INDEX_HXX
+#define ANDRES_GRAPH_EDGE_INDEX_HXX
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits> // std::false_type, std::true_type
+#include <utility> // std::pair
+#include <vector>
+
+#include "digraph.hxx"
+
+namespace andres {
+namespace graph {
+
+// \cond SUPPRESS_DOXYGEN
+namespace detail {
+
+template<class GRAPH>
+struct IsDirected : std::false_type {};
+
+template<class VISITOR, class ALLOCATOR>
+struct IsDirected<Digraph<VISITOR, ALLOCATOR> > : std::true_type {};
+
+} // namespace detail
+// \endcond
+
+/// Hash table that maps pairs of vertices to edges in constant expected time.
+///
+/// The index is built once for a graph, in time linear in the number of
+/// edges, and answers findEdge() like the graph itself. Edges inserted into
+/// the graph later on can be added via insertEdge(). Like Graph::findEdge(),
+/// the index finds the edge with the smallest index if there are multiple
+/// edges between two vertices. Pairs of vertices are unordered for
+/// undirected graphs and ordered for Digraph.
+///
+/// Since EdgeIndex provides findEdge(), it can be passed instead of the
+/// graph to functions that only search for edges, e.g. findChord().
+///
+/// Vertex indices must be smaller than 2^32 - 1.
+///
+template<class GRAPH>
+class EdgeIndex {
+public:
+    typedef GRAPH GraphType;
+
+    EdgeIndex();
+    EdgeIndex(const GraphType&);
+    void build(const GraphType&);
+    void insertEdge(const std::size_t, const std::size_t, const std::size_t);
+    std::pair<bool, std::size_t> findEdge(const std::size_t, const std::size_t) const;
+    std::size_t numberOfEdges() const;
+
+private:
+    struct Entry {
+        std::uint64_t key_;
+        std::size_t edge_;
+    };
+
+    static std::uint64_t emptyKey();
+    static std::uint64_t key(const std::size_t, const std::size_t);
+    std::size_t slot(const std::uint64_t) const;
+    void insert(const std::uint64_t, const std::size_t);
+    void rehash(const std::size_t);
+
+    std::vector<Entry> entries_;
+    std::size_t numberOfEdges_;
+    std::size_t shift_;
+};
+
+/// Construct an empty edge index.
+///
+template<class GRAPH>
+inline
+EdgeIndex<GRAPH>::EdgeIndex()
+:   entries_(),
+    numberOfEdges_(0),
+    shift_(64)
+{}
+
+/// Construct the edge index of a graph.
+///
+/// \param graph Graph.
+///
+template<class GRAPH>
+inline
+EdgeIndex<GRAPH>::EdgeIndex(
+    const GraphType& graph
+)
+:   entries_(),
+    numberOfEdges_(0),
+    shift_(64)
+{
+    build(graph);
+}
+
+/// Clear the edge index and build it for a graph.
+///
+/// \param graph Graph.
+///
+template<class GRAPH>
+inline void
+EdgeIndex<GRAPH>::build(
+    const GraphType& graph
+) {
+    entries_.clear();
+    numberOfEdges_ = 0;
+    std::size_t capacity = 2;
+    while(capacity < 2 * graph.numberOfEdges()) {
+        capacity *= 2;
+    }
+    rehash(capacity);
+
+    for(std::size_t edge = 0; edge < graph.numberOfEdges(); ++edge) {
+        insert(key(graph.vertexOfEdge(edge, 0), graph.vertexOfEdge(edge, 1)), edge);
+    }
+}
+
+/// Add an edge to the index, e.g. after it has been inserted into the graph.
+///
+/// If the index contains an edge between the same vertices already, that
+/// edge is kept.
+///
+/// \param vertex0 first vertex of the edge.
+/// \param vertex1 second vertex of the edge.
+/// \param edge Integer index of the edge.
+///
+template<class GRAPH>
+inline void
+EdgeIndex<GRAPH>::insertEdge(
+    const std::size_t vertex0,
+    const std::size_t vertex1,
+    const std::size_t edge
+) {
+    if(2 * (numberOfEdges_ + 1) > entries_.size()) {
+        rehash(entries_.size() < 2 ? 2 : 2 * entries_.size());
+    }
+    insert(key(vertex0, vertex1), edge);
+}
+
+/// Search for an edge (in constant expected time).
+///
+/// \param vertex0 first vertex of the edge.
+/// \param vertex1 second vertex of the edge.
+/// \return if an edge from vertex0 to vertex1 exists, pair.first is true
+///     and pair.second is the index of such an edge. if no edge from vertex0
+///     to vertex1 exists, pair.first is false and pair.second is undefined.
+///
+template<class GRAPH>
+inline std::pair<bool, std::size_t>
+EdgeIndex<GRAPH>::findEdge(
+    const std::size_t vertex0,
+    const std::size_t vertex1
+) const {
+    if(entries_.empty()) {
+        return std::make_pair(false, 0);
+    }
+    const std::uint64_t k = key(vertex0, vertex1);
+    const std::size_t mask = entries_.size() - 1;
+    for(std::size_t j = slot(k); ; j = (j + 1) & mask) {
+        const Entry& entry = entries_[j];
+        if(entry.key_ == k) {
+            return std::make_pair(true, entry.edge_);
+        }
+        if(entry.key_ == emptyKey()) {
+            return std::make_pair(false, 0);
+        }
+    }
+}
+
+/// Get the number of edges in the index.
+///
+/// Multiple edges between the same vertices are counted once.
+///
+template<class GRAPH>
+inline std::size_t
+EdgeIndex<GRAPH>::numberOfEdges() const {
+    return numberOfEdges_;
+}
+
+template<class GRAPH>
+inline std::uint64_t
+EdgeIndex<GRAPH>::emptyKey() {
+    return std::numeric_limits<std::uint64_t>::max();
+}
+
+template<class GRAPH>
+inline std::uint64_t
+EdgeIndex<GRAPH>::key(
+    const std::size_t vertex0,
+    const std::size_t vertex1
+) {
+    assert(static_cast<std::uint64_t>(vertex0) < (static_cast<std::uint64_t>(1) << 32) - 1);
+    assert(static_cast<std::uint64_t>(vertex1) < (static_cast<std::uint64_t>(1) << 32) - 1);
+
+    if(!detail::IsDirected<GRAPH>::value && vertex1 < vertex0) { // evaluated at compile time
+        return (static_cast<std::uint64_t>(vertex1) << 32) | static_cast<std::uint64_t>(vertex0);
+    }
+    return (static_cast<std::uint64_t>(vertex0) << 32) | static_cast<std::uint64_t>(vertex1);
+}
+
+// Fibonacci hashing: the upper bits of the product are well mixed.
+template<class GRAPH>
+inline std::size_t
+EdgeIndex<GRAPH>::slot(
+    const std::uint64_t k
+) const {
+    return static_cast<std::size_t>((k * 0x9E3779B97F4A7C15ull) >> shift_);
+}
+
+template<class GRAPH>
+inline void
+EdgeIndex<GRAPH>::insert(
+    const std::uint64_t k,
+    const std::size_t edge
+) {
+    const std::size_t mask = entries_.size() - 1;
+    for(std::size_t j = slot(k); ; j = (j + 1) & mask) {
+        Entry& entry = entries_[j];
+        if(entry.key_ == k) {
+            return;
+        }
+        if(entry.key_ == emptyKey()) {
+            entry.key_ = k;
+            entry.edge_ = edge;
+            ++numberOfEdges_;
+            return;
+        }
+    }
+}
+
+// capacity must be a power of two
+template<class GRAPH>
+inline void
+EdgeIndex<GRAPH>::rehash(
+    const std::size_t capacity
+) {
+    assert(capacity >= 2 && (capacity & (capacity - 1)) == 0);
+
+    std::vector<Entry> entries(capacity);
+    for(std::size_t j = 0; j < capacity; ++j) {
+        entries[j].key_ = emptyKey();
+    }
+    entries.swap(entries_);
+
+    shift_ = 64;
+    for(std::size_t c = capacity; c > 1; c /= 2) {
+        --shift_;
+    }
+
+    numberOfEdges_ = 0;
+    for(std::size_t j = 0; j < entries.size(); ++j) {
+        if(entries[j].key_ != emptyKey()) {
+            insert(entries[j].key_, entries[j].edge_);
+        }
+    }
+}
+
+} // namespace graph
+} // namespace andres
+
+#endif // #ifndef ANDRES_GRAPH_EDGE_INDEX_HXX
@@ -0,0 +1,107 @@
+#pragma once
+#ifndef ANDRES_GRAPH_FOR_EACH_HXX
+#define ANDRES_GRAPH_FOR_EACH_HXX
+
+#include <cstddef>
+
+namespace andres {
+namespace graph {
+
+// \cond SUPPRESS_DOXYGEN
+namespace detail {
+
+// graphs that provide the member function forEachAdjacency, e.g. GridGraph
+template<class GRAPH, class FUNCTION>
+inline auto
+forEachAdjacency(
+    const GRAPH& graph,
+    const std::size_t vertex,
+    FUNCTION& f,
+    int
+) -> decltype(graph.forEachAdjacency(vertex, f), void()) {
+    graph.forEachAdjacency(vertex, f);
+}
+
+template<class GRAPH, class FUNCTION>
+inline void
+forEachAdjacency(
+    const GRAPH& graph,
+    const std::size_t vertex,
+    FUNCTION& f,
+    long
+) {
+    for(auto it = graph.adjacenciesFromVertexBegin(vertex); it != graph.adjacenciesFromVertexEnd(vertex); ++it) {
+        f(*it);
+    }
+}
+
+// graphs that provide the member function forEachEdge, e.g. GridGraph
+template<class GRAPH, class FUNCTION>
+inline auto
+forEachEdge(
+    const GRAPH& graph,
+    FUNCTION& f,
+    int
+) -> decltype(graph.forEachEdge(f), void()) {
+    graph.forEachEdge(f);
+}
+
+template<class GRAPH, class FUNCTION>
+inline void
+forEachEdge(
+    const GRAPH& graph,
+    FUNCTION& f,
+    long
+) {
+    for(std::size_t edge = 0; edge < graph.numberOfEdges(); ++edge) {
+        f(edge, graph.vertexOfEdge(edge, 0), graph.vertexOfEdge(edge, 1));
+    }
+}
+
+} // namespace detail
+// \endcond
+
+/// Call a function for each adjacency from a vertex.
+///
+/// Graphs with a regular structure, e.g. GridGraph, provide a member
+/// function forEachAdjacency that is faster than iterating over the
+/// adjacencies. It is used if it exists. For all other graphs, the
+/// adjacencies are visited via adjacenciesFromVertexBegin() and
+/// adjacenciesFromVertexEnd().
+///
+/// \param graph Graph.
+/// \param vertex Integer index of a vertex.
+/// \param f Function that is called with each adjacency from the vertex.
+///
+template<class GRAPH, class FUNCTION>
+inline void
+forEachAdjacency(
+    const GRAPH& graph,
+    const std::size_t vertex,
+    FUNCTION f
+) {
+    detail::forEachAdjacency(graph, vertex, f, 0);
+}
+
+/// Call a function for each edge of a graph, in the order of edge indices.
+///
+/// The member function forEachEdge of the graph is used if it exists, e.g.
+/// for GridGraph where vertexOfEdge() is comparatively expensive.
+///
+/// \param graph Graph.
+/// \param f Function that is called with the integer index of each edge
+/// and the integer indices of its first and second vertex.
+///
+template<class GRAPH, class FUNCTION>
+inline void
+forEachEdge(
+    const GRAPH& graph,
+    FUNCTION f
+) {
+    detail::forEachEdge(graph, f, 0);
+}
+
+} // namespace graph
+} // namespace andres
+
+#endif // #ifndef ANDRES_GRAPH_FOR_EACH_HXX
@@ -8,8 +8,11 @@
 #include <vector>
 #include <set> 
 #include <iostream>
-#include <utility> // std::pair
-#include <algorithm> // std::fill
+#include <utility> // std::pair, std::move
+#include <algorithm> // std::sort
+#include <functional> // std::less
+#include <memory> // std::allocator, std::allocator_traits
+#include <limits> // std::numeric_limits
 
 #include "adjacency.hxx"
 #include "subgraph.hxx"
@@ -23,18 +26,31 @@ namespace andres {
 namespace graph {
 
 /// Undirected graph, implemented as an adjacency list.
-template<typename VISITOR = IdleGraphVisitor<std::size_t> >
+///
+/// The template parameter is either a visitor or an unsigned integer type.
+/// Indices of vertices and edges are stored in the integer type, or in the
+/// size_type of the visitor. E.g., Graph<std::uint32_t> halves the memory
+/// of adjacencies and edges for graphs with less than 2^32 vertices and
+/// edges. The interface uses std::size_t in either case.
+///
+template<typename VISITOR = IdleGraphVisitor<std::size_t>, class ALLOCATOR = std::allocator<std::size_t> >
 class Graph {
 public: 
-    typedef VISITOR Visitor;
-    typedef detail::VertexIterator VertexIterator;
-    typedef detail::EdgeIterator EdgeIterator;
-    typedef detail::Adjacencies::const_iterator AdjacencyIterator;    
+    typedef typename detail::GraphTraits<VISITOR>::Visitor Visitor;
+    typedef typename detail::GraphTraits<VISITOR>::size_type IndexType;
+    typedef typename std::allocator_traits<ALLOCATOR>::template rebind_alloc<Adjacency<IndexType> > Allocator;
+    typedef typename RandomAccessSet<Adjacency<IndexType>, std::less<Adjacency<IndexType> >, Allocator>::const_iterator AdjacencyIterator;
+    typedef detail::IteratorHelper<true, AdjacencyIterator> VertexIterator;
+    typedef detail::IteratorHelper<false, AdjacencyIterator> EdgeIterator;
     typedef typename AdjacencyIterator::value_type AdjacencyType;
 
     // construction
     Graph(const Visitor& = Visitor());
     Graph(const std::size_t, const Visitor& = Visitor());
+    Graph(const Graph&);
+    Graph(Graph&&) = default;
+    Graph& operator=(const Graph&);
+    Graph& operator=(Graph&&) = default;
     void assign(const Visitor& = Visitor());
     void assign(const std::size_t, const Visitor& = Visitor());
     void reserveVertices(const std::size_t);
@@ -68,22 +84,31 @@ public:
     const AdjacencyType& adjacencyToVertex(const std::size_t, const std::size_t) const;
     std::pair<bool, std::size_t> findEdge(const std::size_t, const std::size_t) const;
     bool multipleEdgesEnabled() const;
+    Allocator get_allocator() const;
 
     // manipulation
     std::size_t insertVertex();
     std::size_t insertVertices(const std::size_t);
     std::size_t insertEdge(const std::size_t, const std::size_t);
+    template<class ITERATOR>
+        std::size_t insertEdges(ITERATOR, ITERATOR);
     void eraseVertex(const std::size_t);
+    template<class MASK>
+        void eraseVertices(const MASK&);
     void eraseEdge(const std::size_t);
+    template<class MASK>
+        void eraseEdges(const MASK&);
     bool& multipleEdgesEnabled();
 
 private:
-    typedef detail::Adjacencies Vertex;
-    typedef detail::Edge<false> Edge;
+    typedef RandomAccessSet<AdjacencyType, std::less<AdjacencyType>, Allocator> Vertex;
+    typedef detail::Edge<false, IndexType> Edge;
 
     void insertAdjacenciesForEdge(const std::size_t);
+    void insertAdjacenciesForEdges(const std::size_t);
     void eraseAdjacenciesForEdge(const std::size_t);
 
+    Allocator allocator_;
     std::vector<Vertex> vertices_;
     std::vector<Edge> edges_;
     bool multipleEdgesEnabled_;
@@ -94,12 +119,13 @@ private:
 ///
 /// \param visitor Visitor to follow changes of integer indices of vertices and edges.
 ///
-template<typename VISITOR>
+template<typename VISITOR, class ALLOCATOR>
 inline 
-Graph<VISITOR>::Graph(
+Graph<VISITOR, ALLOCATOR>::Graph(
     const Visitor& visitor
 )
-:   vertices_(),
+:   allocator_(),
+    vertices_(),
     edges_(),
     multipleEdgesEnabled_(false),
     visitor_(visitor)
@@ -110,31 +136,81 @@ Graph<VISITOR>::Graph(
 /// \param numberOfVertices Number of vertices.
 /// \param visitor Visitor to follow changes of integer indices of vertices and edges.
 ///
-template<typename VISITOR>
+template<typename VISITOR, class ALLOCATOR>
 inline 
-Graph<VISITOR>::Graph(
+Graph<VISITOR, ALLOCATOR>::Graph(
     const std::size_t numberOfVertices,
     const Visitor& visitor
 )
-:   vertices_(numberOfVertices),
+:   allocator_(),
+    vertices_(),
     edges_(),
     multipleEdgesEnabled_(false),
     visitor_(visitor)
 {
+    // vertices are constructed one at a time because copies of a vertex
+    // would obtain an allocator from select_on_container_copy_construction()
+    vertices_.reserve(numberOfVertices);
+    for(std::size_t v = 0; v < numberOfVertices; ++v) {
+        vertices_.push_back(Vertex(std::less<AdjacencyType>(), allocator_));
+    }
     visitor_.insertVertices(0, numberOfVertices);
 }
 
+/// Copy a undirected graph.
+///
+/// The adjacencies of the copy are allocated by an allocator obtained from
+/// select_on_container_copy_construction(), so that a copy of a graph with
+/// an ArenaAllocator has an arena of its own.
+///
+/// \param other Graph to be copied.
+///
+template<typename VISITOR, class ALLOCATOR>
+inline
+Graph<VISITOR, ALLOCATOR>::Graph(
+    const Graph<VISITOR, ALLOCATOR>& other
+)
+:   allocator_(std::allocator_traits<Allocator>::select_on_container_copy_construction(other.allocator_)),
+    vertices_(),
+    edges_(other.edges_),
+    multipleEdgesEnabled_(other.multipleEdgesEnabled_),
+    visitor_(other.visitor_)
+{
+    vertices_.reserve(other.vertices_.size());
+    for(std::size_t v = 0; v < other.vertices_.size(); ++v) {
+        vertices_.push_back(Vertex(std::less<AdjacencyType>(), allocator_));
+        vertices_.back() = other.vertices_[v];
+    }
+}
+
+/// Assign a copy of a undirected graph.
+///
+/// \param other Graph to be copied.
+///
+template<typename VISITOR, class ALLOCATOR>
+inline Graph<VISITOR, ALLOCATOR>&
+Graph<VISITOR, ALLOCATOR>::operator=(
+    const Graph<VISITOR, ALLOCATOR>& other
+) {
+    if(this != &other) {
+        Graph<VISITOR, ALLOCATOR> copy(other);
+        *this = std::move(copy);
+    }
+    return *this;
+}
+
 /// Clear an undirected graph.
 ///
 /// \param visitor Visitor to follow changes of integer indices of vertices and edges.
 ///
-template<typename VISITOR>
+template<typename VISITOR, class ALLOCATOR>
 inline void
-Graph<VISITOR>::assign(
+Graph<VISITOR, ALLOCATOR>::assign(
     const Visitor& visitor
 ) {
     vertices_.clear();
     edges_.clear();
+    allocator_ = Allocator();
     multipleEdgesEnabled_ = false;
     visitor_ = visitor;
 }
@@ -144,15 +220,19 @@ Graph<VISITOR>::assign(
 /// \param numberOfVertices Number of vertices.
 /// \param visitor Visitor to follow changes of integer indices of vertices and edges.
 ///
-template<typename VISITOR>
+template<typename VISITOR, class ALLOCATOR>
 inline void
-Graph<VISITOR>::assign(
+Graph<VISITOR, ALLOCATOR>::assign(
     const std::size_t numberOfVertices,
     const Visitor& visitor
 ) {
-    vertices_.resize(numberOfVertices);
-    std::fill(vertices_.begin(), vertices_.end(), Vertex());
+    vertices_.clear();
     edges_.clear();
+    allocator_ = Allocator();
+    vertices_.reserve(numberOfVertices);
+    for(std::size_t v = 0; v < numberOfVertices; ++v) {
+        vertices_.push_back(Vertex(std::less<AdjacencyType>(), allocator_));
+    }
     multipleEdgesEnabled_ = false;
     visitor_ = visitor;
     visitor_.insertVertices(0, numberOfVertices);
@@ -160,17 +240,17 @@ Graph<VISITOR>::assign(
     
 /// Get the number of vertices.
 ///
-template<typename VISITOR>
+template<typename VISITOR, class ALLOCATOR>
 inline std::size_t
-Graph<VISITOR>::numberOfVertices() const { 
+Graph<VISITOR, ALLOCATOR>::numberOfVertices() const { 
     return vertices_.size(); 
 }
 
 /// Get the number of edges.
 ///
-template<typename VISITOR>
+template<typename VISITOR, class ALLOCATOR>
 inline std::size_t
-Graph<VISITOR>::numberOfEdges() const { 
+Graph<VISITOR, ALLOCATOR>::numberOfEdges() const { 
     return edges_.size(); 
 }
 
@@ -180,9 +260,9 @@ Graph<VISITOR>::numberOfEdges() const {
 ///
 /// \sa edgeFromVertex()
 ///
-template<typename VISITOR>
+template<typename VISITOR, class ALLOCATOR>
 inline std::size_t
-Graph<VISITOR>::numberOfEdgesFromVertex(
+Graph<VISITOR, ALLOCATOR>::numberOfEdgesFromVertex(
     const std::size_t vertex
 ) const { 
     return vertices_[vertex].size();
@@ -194,9 +274,9 @@ Graph<VISITOR>::numberOfEdgesFromVertex(
 ///
 /// \sa edgeToVertex()
 ///
-template<typename VISITOR>
+template<typename VISITOR, class ALLOCATOR>
 inline std::size_t
-Graph<VISITOR>::numberOfEdgesToVertex(
+Graph<VISITOR, ALLOCATOR>::numberOfEdgesToVertex(
     const std::size_t vertex
 ) const { 
     return vertices_[vertex].size();
@@ -207,9 +287,9 @@ Graph<VISITOR>::numberOfEdgesToVertex(
 /// \param edge Integer index of an edge.
 /// \param j Number of the vertex in the edge; either 0 or 1.
 ///
-template<typename VISITOR>
+template<typename VISITOR, class ALLOCATOR>
 inline std::size_t
-Graph<VISITOR>::vertexOfEdge(
+Graph<VISITOR, ALLOCATOR>::vertexOfEdge(
     const std::size_t edge,
     const std::size_t j
 ) const {
@@ -225,9 +305,9 @@ Graph<VISITOR>::vertexOfEdge(
 ///
 /// \sa numberOfEdgesFromVertex()
 ///
-template<typename VISITOR>
+template<typename VISITOR, class ALLOCATOR>
 inline std::size_t
-Graph<VISITOR>::edgeFromVertex(
+Graph<VISITOR, ALLOCATOR>::edgeFromVertex(
     const std::size_t vertex,
     const std::size_t j
 ) const {
@@ -241,9 +321,9 @@ Graph<VISITOR>::edgeFromVertex(
 ///
 /// \sa numberOfEdgesToVertex()
 ///
-template<typename VISITOR>
+template<typename VISITOR, class ALLOCATOR>
 inline std::size_t
-Graph<VISITOR>::edgeToVertex(
+Graph<VISITOR, ALLOCATOR>::edgeToVertex(
     const std::size_t vertex,
     const std::size_t j
 ) const {
@@ -257,9 +337,9 @@ Graph<VISITOR>::edgeToVertex(
 ///
 /// \sa numberOfEdgesFromVertex() 
 ///
-template<typename VISITOR>
+template<typename VISITOR, class ALLOCATOR>
 inline std::size_t
-Graph<VISITOR>::vertexFromVertex(
+Graph<VISITOR, ALLOCATOR>::vertexFromVertex(
     const std::size_t vertex,
     const std::size_t j
 ) const {
@@ -273,9 +353,9 @@ Graph<VISITOR>::vertexFromVertex(
 ///
 /// \sa numberOfEdgesFromVertex() 
 ///
-template<typename VISITOR>
+template<typename VISITOR, class ALLOCATOR>
 inline std::size_t
-Graph<VISITOR>::vertexToVertex(
+Graph<VISITOR, ALLOCATOR>::vertexToVertex(
     const std::size_t vertex,
     const std::size_t j
 ) const {
@@ -288,10 +368,12 @@ Graph<VISITOR>::vertexToVertex(
 ///
 /// \sa insertVertices()
 ///
-template<typename VISITOR>
+template<typename VISITOR, class ALLOCATOR>
 inline std::size_t
-Graph<VISITOR>::insertVertex() {
-    vertices_.push_back(Vertex());
+Graph<VISITOR, ALLOCATOR>::insertVertex() {
+    assert(vertices_.size() < static_cast<std::size_t>(std::numeric_limits<IndexType>::max()));
+
+    vertices_.push_back(Vertex(std::less<AdjacencyType>(), allocator_));
     visitor_.insertVertex(vertices_.size() - 1);
     return vertices_.size() - 1;
 }
@@ -303,13 +385,17 @@ Graph<VISITOR>::insertVertex() {
 ///
 /// \sa insertVertex()
 ///
-template<typename VISITOR>
+template<typename VISITOR, class ALLOCATOR>
 inline std::size_t
-Graph<VISITOR>::insertVertices(
+Graph<VISITOR, ALLOCATOR>::insertVertices(
     const std::size_t number
 ) {
+    assert(number <= static_cast<std::size_t>(std::numeric_limits<IndexType>::max()) - vertices_.size());
+
     std::size_t position = vertices_.size();
-    vertices_.insert(vertices_.end(), number, Vertex());
+    for(std::size_t v = 0; v < number; ++v) {
+        vertices_.push_back(Vertex(std::less<AdjacencyType>(), allocator_));
+    }
     visitor_.insertVertices(position, number);
     return position;
 }
@@ -320,9 +406,9 @@ Graph<VISITOR>::insertVertices(
 /// \param vertexIndex1 Integer index of the second vertex in the edge.
 /// \return Integer index of the newly inserted edge.
 /// 
-template<typename VISITOR>
+template<typename VISITOR, class ALLOCATOR>
 inline std::size_t
-Graph<VISITOR>::insertEdge(
+Graph<VISITOR, ALLOCATOR>::insertEdge(
     const std::size_t vertexIndex0,
     const std::size_t vertexIndex1
 ) {
@@ -331,6 +417,7 @@ Graph<VISITOR>::insertEdge(
     
     if(multipleEdgesEnabled()) {
 insertEdgeMark:
+        assert(edges_.size() < static_cast<std::size_t>(std::numeric_limits<IndexType>::max()));
         edges_.push_back(Edge(vertexIndex0, vertexIndex1));
         std::size_t edgeIndex = edges_.size() - 1;
         insertAdjacenciesForEdge(edgeIndex);
@@ -348,13 +435,79 @@ insertEdgeMark:
     }
 }
 
+/// Insert additional edges.
+///
+/// Inserting many edges at once is faster than calling insertEdge() for
+/// each edge. The adjacencies of all vertices are sorted and merged only
+/// once, in O(m log m) time for m edges, instead of one linear-time
+/// insertion per edge and vertex. Edges are inserted and reported to the
+/// visitor in the order of the sequence. If multiple edges are disabled,
+/// pairs of vertices that are connected already or that occur earlier in
+/// the sequence are skipped, as in insertEdge().
+///
+/// \param begin Iterator to the beginning of a sequence of pairs of integer
+///     indices of vertices, e.g. std::pair<std::size_t, std::size_t>.
+/// \param end Iterator to the end of the sequence.
+/// \return Integer index of the first newly inserted edge.
+///
+template<typename VISITOR, class ALLOCATOR>
+template<class ITERATOR>
+inline std::size_t
+Graph<VISITOR, ALLOCATOR>::insertEdges(
+    ITERATOR begin,
+    ITERATOR end
+) {
+    const std::size_t position = edges_.size();
+    for(; begin != end; ++begin) {
+        assert(static_cast<std::size_t>(begin->first) < numberOfVertices());
+        assert(static_cast<std::size_t>(begin->second) < numberOfVertices());
+        assert(edges_.size() < static_cast<std::size_t>(std::numeric_limits<IndexType>::max()));
+        edges_.push_back(Edge(begin->first, begin->second));
+    }
+
+    if(!multipleEdgesEnabled()) {
+        // sort pairs of vertices, keeping the position in the sequence
+        typedef std::pair<std::pair<std::size_t, std::size_t>, std::size_t> Entry;
+        std::vector<Entry> entries(edges_.size() - position);
+        for(std::size_t j = 0; j < entries.size(); ++j) {
+            const Edge& edge = edges_[position + j];
+            entries[j] = Entry(std::make_pair(edge[0], edge[1]), position + j);
+        }
+        std::sort(entries.begin(), entries.end());
+
+        // keep the first occurrence of each pair that is not connected already
+        std::vector<char> keep(entries.size(), 0);
+        for(std::size_t j = 0; j < entries.size(); ++j) {
+            if(j == 0 || entries[j].first != entries[j - 1].first) {
+                if(!findEdge(entries[j].first.first, entries[j].first.second).first) {
+                    keep[entries[j].second - position] = 1;
+                }
+            }
+        }
+        std::size_t edgeIndex = position;
+        for(std::size_t j = 0; j < keep.size(); ++j) {
+            if(keep[j]) {
+                edges_[edgeIndex] = edges_[position + j];
+                ++edgeIndex;
+            }
+        }
+        edges_.erase(edges_.begin() + edgeIndex, edges_.end());
+    }
+
+    insertAdjacenciesForEdges(position);
+    for(std::size_t edgeIndex = position; edgeIndex < edges_.size(); ++edgeIndex) {
+        visitor_.insertEdge(edgeIndex);
+    }
+    return position;
+}
+
 /// Erase a vertex and all edges connecting this vertex.
 ///
 /// \param vertexIndex Integer index of the vertex to be erased.
 /// 
-template<typename VISITOR>
+template<typename VISITOR, class ALLOCATOR>
 void 
-Graph<VISITOR>::eraseVertex(
+Graph<VISITOR, ALLOCATOR>::eraseVertex(
     const std::size_t vertexIndex
 ) {
     assert(vertexIndex < numberOfVertices()); 
@@ -374,7 +527,7 @@ Graph<VISITOR>::eraseVertex(
         // collect indices of edges affected by the move
         std::size_t movingVertexIndex = numberOfVertices() - 1;
         std::set<std::size_t> affectedEdgeIndices;
-        for(Vertex::const_iterator it = vertices_[movingVertexIndex].begin();
+        for(typename Vertex::const_iterator it = vertices_[movingVertexIndex].begin();
         it != vertices_[movingVertexIndex].end(); ++it) {
             affectedEdgeIndices.insert(it->edge());
         }
@@ -412,13 +565,79 @@ Graph<VISITOR>::eraseVertex(
     }
 }
 
+/// Erase all vertices selected by a mask and all edges connecting these vertices.
+///
+/// In contrast to calling eraseVertex() for each vertex, the remaining
+/// vertices and edges keep their relative order and are compacted in a
+/// single pass, in time linear in the size of the graph. Edges are erased
+/// first, as in eraseEdges(). Then, the visitor is notified for each
+/// vertex, in the order of the old indices, either via eraseVertex(old)
+/// or, if its index changes, via relabelVertex(old, new).
+///
+/// \param mask Random access sequence, e.g. std::vector<char>, such that
+///     mask[v] is true for every vertex v to be erased.
+///
+template<typename VISITOR, class ALLOCATOR>
+template<class MASK>
+inline void
+Graph<VISITOR, ALLOCATOR>::eraseVertices(
+    const MASK& mask
+) {
+    // erase edges connecting erased vertices
+    std::vector<char> edgeMask(numberOfEdges());
+    for(std::size_t e = 0; e < numberOfEdges(); ++e) {
+        edgeMask[e] = (mask[edges_[e][0]] || mask[edges_[e][1]]);
+    }
+    eraseEdges(edgeMask);
+
+    // compute new indices of vertices
+    std::vector<std::size_t> vertexIndices(numberOfVertices());
+    std::size_t numberOfRemainingVertices = 0;
+    for(std::size_t v = 0; v < numberOfVertices(); ++v) {
+        if(!mask[v]) {
+            vertexIndices[v] = numberOfRemainingVertices;
+            ++numberOfRemainingVertices;
+        }
+    }
+    if(numberOfRemainingVertices == numberOfVertices()) {
+        return;
+    }
+
+    // compact vertices and relabel their adjacencies; the relabeling preserves the order
+    for(std::size_t v = 0; v < numberOfVertices(); ++v) {
+        if(!mask[v]) {
+            Vertex& vertex = vertices_[v];
+            for(typename Vertex::iterator it = vertex.begin(); it != vertex.end(); ++it) {
+                it->vertex() = vertexIndices[it->vertex()];
+            }
+            if(vertexIndices[v] != v) {
+                std::swap(vertices_[vertexIndices[v]], vertex);
+            }
+        }
+    }
+    vertices_.erase(vertices_.begin() + numberOfRemainingVertices, vertices_.end());
+    for(std::size_t e = 0; e < numberOfEdges(); ++e) {
+        edges_[e][0] = vertexIndices[edges_[e][0]];
+        edges_[e][1] = vertexIndices[edges_[e][1]];
+    }
+
+    for(std::size_t v = 0; v < vertexIndices.size(); ++v) {
+        if(mask[v]) {
+            visitor_.eraseVertex(v);
+        }
+        else if(vertexIndices[v] != v) {
+            visitor_.relabelVertex(v, vertexIndices[v]);
+        }
+    }
+}
+
 /// Erase an edge.
 ///
 /// \param edgeIndex Integer index of the edge to be erased.
 /// 
-template<typename VISITOR>
+template<typename VISITOR, class ALLOCATOR>
 inline void 
-Graph<VISITOR>::eraseEdge(
+Graph<VISITOR, ALLOCATOR>::eraseEdge(
     const std::size_t edgeIndex
 ) {
     assert(edgeIndex < numberOfEdges()); 
@@ -439,6 +658,67 @@ Graph<VISITOR>::eraseEdge(
     }
 }
 
+/// Erase all edges selected by a mask.
+///
+/// In contrast to calling eraseEdge() for each edge, the remaining edges
+/// keep their relative order and are compacted in a single pass, in time
+/// linear in the size of the graph. The visitor is notified for each edge,
+/// in the order of the old indices, either via eraseEdge(old) or, if its
+/// index changes, via relabelEdge(old, new).
+///
+/// \param mask Random access sequence, e.g. std::vector<char>, such that
+///     mask[e] is true for every edge e to be erased.
+///
+template<typename VISITOR, class ALLOCATOR>
+template<class MASK>
+inline void
+Graph<VISITOR, ALLOCATOR>::eraseEdges(
+    const MASK& mask
+) {
+    // compute new indices of edges
+    std::vector<std::size_t> edgeIndices(numberOfEdges());
+    std::size_t numberOfRemainingEdges = 0;
+    for(std::size_t e = 0; e < numberOfEdges(); ++e) {
+        if(!mask[e]) {
+            edgeIndices[e] = numberOfRemainingEdges;
+            ++numberOfRemainingEdges;
+        }
+    }
+    if(numberOfRemainingEdges == numberOfEdges()) {
+        return;
+    }
+
+    // remove and relabel adjacencies; the relabeling preserves the order
+    for(std::size_t v = 0; v < numberOfVertices(); ++v) {
+        Vertex& vertex = vertices_[v];
+        typename Vertex::iterator target = vertex.begin();
+        for(typename Vertex::iterator it = vertex.begin(); it != vertex.end(); ++it) {
+            if(!mask[it->edge()]) {
+                *target = AdjacencyType(it->vertex(), edgeIndices[it->edge()]);
+                ++target;
+            }
+        }
+        vertex.erase(target, vertex.end());
+    }
+
+    // compact edges
+    for(std::size_t e = 0; e < edges_.size(); ++e) {
+        if(!mask[e]) {
+            edges_[edgeIndices[e]] = edges_[e];
+        }
+    }
+    edges_.erase(edges_.begin() + numberOfRemainingEdges, edges_.end());
+
+    for(std::size_t e = 0; e < edgeIndices.size(); ++e) {
+        if(mask[e]) {
+            visitor_.eraseEdge(e);
+        }
+        else if(edgeIndices[e] != e) {
+            visitor_.relabelEdge(e, edgeIndices[e]);
+        }
+    }
+}
+
 /// Get an iterator to the beginning of the sequence of vertices reachable from a given vertex via a single edge.
 ///
 /// \param vertex Integer index of the vertex.
@@ -446,9 +726,9 @@ Graph<VISITOR>::eraseEdge(
 /// 
 /// \sa verticesFromVertexEnd()
 ///
-template<typename VISITOR>
-inline typename Graph<VISITOR>::VertexIterator 
-Graph<VISITOR>::verticesFromVertexBegin(
+template<typename VISITOR, class ALLOCATOR>
+inline typename Graph<VISITOR, ALLOCATOR>::VertexIterator 
+Graph<VISITOR, ALLOCATOR>::verticesFromVertexBegin(
     const std::size_t vertex
 ) const { 
     return vertices_[vertex].begin(); 
@@ -461,9 +741,9 @@ Graph<VISITOR>::verticesFromVertexBegin(
 /// 
 /// \sa verticesFromVertexBegin()
 /// 
-template<typename VISITOR>
-inline typename Graph<VISITOR>::VertexIterator 
-Graph<VISITOR>::verticesFromVertexEnd(
+template<typename VISITOR, class ALLOCATOR>
+inline typename Graph<VISITOR, ALLOCATOR>::VertexIterator 
+Graph<VISITOR, ALLOCATOR>::verticesFromVertexEnd(
     const std::size_t vertex
 ) const { 
     return vertices_[vertex].end(); 
@@ -476,9 +756,9 @@ Graph<VISITOR>::verticesFromVertexEnd(
 /// 
 /// \sa verticesToVertexEnd()
 ///
-template<typename VISITOR>
-inline typename Graph<VISITOR>::VertexIterator 
-Graph<VISITOR>::verticesToVertexBegin(
+template<typename VISITOR, class ALLOCATOR>
+inline typename Graph<VISITOR, ALLOCATOR>::VertexIterator 
+Graph<VISITOR, ALLOCATOR>::verticesToVertexBegin(
     const std::size_t vertex
 ) const { 
     return vertices_[vertex].begin(); 
@@ -491,9 +771,9 @@ Graph<VISITOR>::verticesToVertexBegin(
 /// 
 /// \sa verticesToVertexBegin()
 ///
-template<typename VISITOR>
-inline typename Graph<VISITOR>::VertexIterator 
-Graph<VISITOR>::verticesToVertexEnd(
+template<typename VISITOR, class ALLOCATOR>
+inline typename Graph<VISITOR, ALLOCATOR>::VertexIterator 
+Graph<VISITOR, ALLOCATOR>::verticesToVertexEnd(
     const std::size_t vertex
 ) const { 
     return vertices_[vertex].end(); 
@@ -506,9 +786,9 @@ Graph<VISITOR>::verticesToVertexEnd(
 ///
 /// \sa edgesFromVertexEnd()
 ///
-template<typename VISITOR>
-inline typename Graph<VISITOR>::EdgeIterator 
-Graph<VISITOR>::edgesFromVertexBegin(
+template<typename VISITOR, class ALLOCATOR>
+inline typename Graph<VISITOR, ALLOCATOR>::EdgeIterator 
+Graph<VISITOR, ALLOCATOR>::edgesFromVertexBegin(
     const std::size_t vertex
 ) const { 
     return vertices_[vertex].begin(); 
@@ -521,9 +801,9 @@ Graph<VISITOR>::edgesFromVertexBegin(
 ///
 /// \sa edgesFromVertexBegin()
 ///
-template<typename VISITOR>
-inline typename Graph<VISITOR>::EdgeIterator 
-Graph<VISITOR>::edgesFromVertexEnd(
+template<typename VISITOR, class ALLOCATOR>
+inline typename Graph<VISITOR, ALLOCATOR>::EdgeIterator 
+Graph<VISITOR, ALLOCATOR>::edgesFromVertexEnd(
     const std::size_t vertex
 ) const { 
     return vertices_[vertex].end(); 
@@ -536,9 +816,9 @@ Graph<VISITOR>::edgesFromVertexEnd(
 ///
 /// \sa edgesToVertexEnd()
 ///
-template<typename VISITOR>
-inline typename Graph<VISITOR>::EdgeIterator 
-Graph<VISITOR>::edgesToVertexBegin(
+template<typename VISITOR, class ALLOCATOR>
+inline typename Graph<VISITOR, ALLOCATOR>::EdgeIterator 
+Graph<VISITOR, ALLOCATOR>::edgesToVertexBegin(
     const std::size_t vertex
 ) const { 
     return vertices_[vertex].begin(); 
@@ -551,9 +831,9 @@ Graph<VISITOR>::edgesToVertexBegin(
 ///
 /// \sa edgesToVertexBegin()
 ///
-template<typename VISITOR>
-inline typename Graph<VISITOR>::EdgeIterator 
-Graph<VISITOR>::edgesToVertexEnd(
+template<typename VISITOR, class ALLOCATOR>
+inline typename Graph<VISITOR, ALLOCATOR>::EdgeIterator 
+Graph<VISITOR, ALLOCATOR>::edgesToVertexEnd(
     const std::size_t vertex
 ) const { 
     return vertices_[vertex].end(); 
@@ -566,9 +846,9 @@ Graph<VISITOR>::edgesToVertexEnd(
 ///
 /// \sa adjacenciesFromVertexEnd()
 ///
-template<typename VISITOR>
-inline typename Graph<VISITOR>::AdjacencyIterator 
-Graph<VISITOR>::adjacenciesFromVertexBegin(
+template<typename VISITOR, class ALLOCATOR>
+inline typename Graph<VISITOR, ALLOCATOR>::AdjacencyIterator 
+Graph<VISITOR, ALLOCATOR>::adjacenciesFromVertexBegin(
     const std::size_t vertex
 ) const {
     return vertices_[vertex].begin();
@@ -581,9 +861,9 @@ Graph<VISITOR>::adjacenciesFromVertexBegin(
 ///
 /// \sa adjacenciesFromVertexBegin()
 ///
-template<typename VISITOR>
-inline typename Graph<VISITOR>::AdjacencyIterator 
-Graph<VISITOR>::adjacenciesFromVertexEnd(
+template<typename VISITOR, class ALLOCATOR>
+inline typename Graph<VISITOR, ALLOCATOR>::AdjacencyIterator 
+Graph<VISITOR, ALLOCATOR>::adjacenciesFromVertexEnd(
     const std::size_t vertex
 ) const {
     return vertices_[vertex].end();
@@ -596,9 +876,9 @@ Graph<VISITOR>::adjacenciesFromVertexEnd(
 ///
 /// \sa adjacenciesToVertexEnd()
 ///
-template<typename VISITOR>
-inline typename Graph<VISITOR>::AdjacencyIterator 
-Graph<VISITOR>::adjacenciesToVertexBegin(
+template<typename VISITOR, class ALLOCATOR>
+inline typename Graph<VISITOR, ALLOCATOR>::AdjacencyIterator 
+Graph<VISITOR, ALLOCATOR>::adjacenciesToVertexBegin(
     const std::size_t vertex
 ) const {
     return vertices_[vertex].begin();
@@ -611,9 +891,9 @@ Graph<VISITOR>::adjacenciesToVertexBegin(
 ///
 /// \sa adjacenciesToVertexBegin()
 ///
-template<typename VISITOR>
-inline typename Graph<VISITOR>::AdjacencyIterator 
-Graph<VISITOR>::adjacenciesToVertexEnd(
+template<typename VISITOR, class ALLOCATOR>
+inline typename Graph<VISITOR, ALLOCATOR>::AdjacencyIterator 
+Graph<VISITOR, ALLOCATOR>::adjacenciesToVertexEnd(
     const std::size_t vertex
 ) const {
     return vertices_[vertex].end();
@@ -623,9 +903,9 @@ Graph<VISITOR>::adjacenciesToVertexEnd(
 ///
 /// \param number Total number of vertices.
 ///
-template<typename VISITOR>
+template<typename VISITOR, class ALLOCATOR>
 inline void 
-Graph<VISITOR>::reserveVertices(
+Graph<VISITOR, ALLOCATOR>::reserveVertices(
     const std::size_t number
 ) {
     vertices_.reserve(number);
@@ -635,9 +915,9 @@ Graph<VISITOR>::reserveVertices(
 ///
 /// \param number Total number of edges.
 ///
-template<typename VISITOR>
+template<typename VISITOR, class ALLOCATOR>
 inline void 
-Graph<VISITOR>::reserveEdges(
+Graph<VISITOR, ALLOCATOR>::reserveEdges(
     const std::size_t number
 ) {
     edges_.reserve(number);
@@ -648,9 +928,9 @@ Graph<VISITOR>::reserveEdges(
 /// \param vertex Vertex.
 /// \param j Number of the adjacency.
 ///
-template<typename VISITOR>
-inline const typename Graph<VISITOR>::AdjacencyType&
-Graph<VISITOR>::adjacencyFromVertex(
+template<typename VISITOR, class ALLOCATOR>
+inline const typename Graph<VISITOR, ALLOCATOR>::AdjacencyType&
+Graph<VISITOR, ALLOCATOR>::adjacencyFromVertex(
     const std::size_t vertex,
     const std::size_t j
 ) const {
@@ -662,9 +942,9 @@ Graph<VISITOR>::adjacencyFromVertex(
 /// \param vertex Vertex.
 /// \param j Number of the adjacency.
 ///
-template<typename VISITOR>
-inline const typename Graph<VISITOR>::AdjacencyType&
-Graph<VISITOR>::adjacencyToVertex(
+template<typename VISITOR, class ALLOCATOR>
+inline const typename Graph<VISITOR, ALLOCATOR>::AdjacencyType&
+Graph<VISITOR, ALLOCATOR>::adjacencyToVertex(
     const std::size_t vertex,
     const std::size_t j
 ) const {
@@ -679,9 +959,9 @@ Graph<VISITOR>::adjacencyToVertex(
 ///     and pair.second is the index of such an edge. if no edge from vertex0
 ///     to vertex1 exists, pair.first is false and pair.second is undefined.
 ///
-template<typename VISITOR>
+template<typename VISITOR, class ALLOCATOR>
 inline std::pair<bool, std::size_t>
-Graph<VISITOR>::findEdge(
+Graph<VISITOR, ALLOCATOR>::findEdge(
     const std::size_t vertex0,
     const std::size_t vertex1
 ) const {
@@ -709,13 +989,21 @@ Graph<VISITOR>::findEdge(
     }
 }
 
+/// Get the allocator of the adjacencies of all vertices.
+///
+template<typename VISITOR, class ALLOCATOR>
+inline typename Graph<VISITOR, ALLOCATOR>::Allocator
+Graph<VISITOR, ALLOCATOR>::get_allocator() const {
+    return allocator_;
+}
+
 /// Indicate if multiple edges are enabled.
 ///
 /// \return true if multiple edges are enabled, false otherwise.
 ///
-template<typename VISITOR>
+template<typename VISITOR, class ALLOCATOR>
 inline bool
-Graph<VISITOR>::multipleEdgesEnabled() const {
+Graph<VISITOR, ALLOCATOR>::multipleEdgesEnabled() const {
     return multipleEdgesEnabled_;
 }
 
@@ -725,15 +1013,15 @@ Graph<VISITOR>::multipleEdgesEnabled() const {
 ///
 /// \return reference the a Boolean flag.
 ///
-template<typename VISITOR>
+template<typename VISITOR, class ALLOCATOR>
 inline bool&
-Graph<VISITOR>::multipleEdgesEnabled() {
+Graph<VISITOR, ALLOCATOR>::multipleEdgesEnabled() {
     return multipleEdgesEnabled_;
 }
 
-template<typename VISITOR>
+template<typename VISITOR, class ALLOCATOR>
 inline void 
-Graph<VISITOR>::insertAdjacenciesForEdge(
+Graph<VISITOR, ALLOCATOR>::insertAdjacenciesForEdge(
     const std::size_t edgeIndex
 ) {
     const Edge& edge = edges_[edgeIndex];
@@ -749,9 +1037,40 @@ Graph<VISITOR>::insertAdjacenciesForEdge(
     }
 }
 
-template<typename VISITOR>
+// inserts the adjacencies for all edges from the given index onwards,
+// merging the sorted adjacencies into the adjacencies of each vertex once.
+template<typename VISITOR, class ALLOCATOR>
+inline void 
+Graph<VISITOR, ALLOCATOR>::insertAdjacenciesForEdges(
+    const std::size_t edgeIndex
+) {
+    typedef std::pair<std::size_t, AdjacencyType> Entry;
+    std::vector<Entry> entries;
+    entries.reserve(2 * (edges_.size() - edgeIndex));
+    for(std::size_t e = edgeIndex; e < edges_.size(); ++e) {
+        const std::size_t vertexIndex0 = edges_[e][0];
+        const std::size_t vertexIndex1 = edges_[e][1];
+        entries.push_back(Entry(vertexIndex0, AdjacencyType(vertexIndex1, e)));
+        if(vertexIndex1 != vertexIndex0) {
+            entries.push_back(Entry(vertexIndex1, AdjacencyType(vertexIndex0, e)));
+        }
+    }
+    std::sort(entries.begin(), entries.end());
+
+    std::vector<AdjacencyType> adjacencies;
+    for(std::size_t j = 0; j < entries.size(); ) {
+        const std::size_t vertexIndex = entries[j].first;
+        adjacencies.clear();
+        for(; j < entries.size() && entries[j].first == vertexIndex; ++j) {
+            adjacencies.push_back(entries[j].second);
+        }
+        vertices_[vertexIndex].insert(adjacencies.begin(), adjacencies.end());
+    }
+}
+
+template<typename VISITOR, class ALLOCATOR>
 inline void 
-Graph<VISITOR>::eraseAdjacenciesForEdge(
+Graph<VISITOR, ALLOCATOR>::eraseAdjacenciesForEdge(
     const std::size_t edgeIndex
 ) {
     const Edge& edge = edges_[edgeIndex];
@@ -761,7 +1080,7 @@ Graph<VISITOR>::eraseAdjacenciesForEdge(
     Vertex& vertex1 = vertices_[vertexIndex1];
 
     AdjacencyType adj(vertexIndex1, edgeIndex);
-    RandomAccessSet<AdjacencyType>::iterator it = vertex0.find(adj);
+    typename Vertex::iterator it = vertex0.find(adj);
     assert(it != vertex0.end());
     if (it != vertex0.end())
         vertex0.erase(it);
@@ -195,15 +195,23 @@ public:
     size_type edge(const EdgeCoordinate&) const;
     void edge(size_type, EdgeCoordinate&) const;
 
+    // stencil access
+    template<class FUNCTION>
+        void forEachAdjacency(const size_type, FUNCTION) const;
+    template<class FUNCTION>
+        void forEachEdge(FUNCTION) const;
+
 private:
     size_type vertexFromVertex(const VertexCoordinate&, const size_type, size_type&, bool&) const;
     void adjacencyFromVertex(const VertexCoordinate&, const size_type, size_type&, size_type&) const;
+    size_type edgeOfPivot(const VertexCoordinate&, const size_type) const;
 
     // Member variables
     VertexCoordinate shape_;
     std::array<size_type, DIMENSION> edgeIndexOffsets_;
     std::array<size_type, DIMENSION> vertexIndexOffsets_;
     std::array<VertexCoordinate, DIMENSION> edgeShapes_;
+    std::array<VertexCoordinate, DIMENSION> edgeStrides_;
     size_type numberOfVertices_;
     const size_type& numberOfEdges_;
     Visitor visitor_;
@@ -313,6 +321,14 @@ GridGraph<D, VISITOR>::assign(
                 }
                 edgeIndexOffsets_[i] = (edgeIndexOffset += cumprod);
             }
+            {
+                // strides of the pivot coordinates in the edge index
+                size_type cumprod = 1;
+                for(size_type j = 0; j < DIMENSION; ++j) {
+                    edgeStrides_[i][j] = cumprod;
+                    cumprod *= edgeShape[j];
+                }
+            }
         }
     }
 }
@@ -1010,6 +1026,135 @@ GridGraph<D, VISITOR>::adjacencyFromVertex(
 
 }
 
+/// Call a function for each adjacency of a vertex.
+///
+/// The adjacencies are visited in the same order as by the
+/// AdjacencyIterator, but the coordinate of the vertex is computed only
+/// once. Neighbors are obtained by adding and subtracting vertex index
+/// offsets. The index of the edge along each dimension whose smaller
+/// endpoint is the vertex is computed once, as a dot product of the
+/// coordinate with the edge strides, and the index of the edge to the
+/// smaller neighbor is obtained from it by subtracting a stride. For
+/// vertices in the interior of the grid, all 2*D neighbors exist and no
+/// boundary checks are made. Loops run over the compile-time constant
+/// DIMENSION.
+///
+/// \param vertex Integer index of a vertex.
+/// \param f Function that is called with an AdjacencyType for each
+/// adjacency.
+///
+template<unsigned char D, class VISITOR>
+template<class FUNCTION>
+inline void
+GridGraph<D, VISITOR>::forEachAdjacency(
+    const size_type vertex,
+    FUNCTION f
+) const {
+    assert(vertex < numberOfVertices());
+    VertexCoordinate vertexCoordinate;
+    this->vertex(vertex, vertexCoordinate);
+
+    bool interior = true;
+    size_type edges[DIMENSION]; // edges along each dimension whose smaller endpoint is the vertex
+    for(size_type i = 0; i < DIMENSION; ++i) {
+        if(vertexCoordinate[i] == 0 || vertexCoordinate[i] + 1 >= shape_[i]) {
+            interior = false;
+        }
+        edges[i] = edgeOfPivot(vertexCoordinate, i);
+    }
+
+    if(interior) {
+        for(size_type i = DIMENSION; i > 0; --i) {
+            f(AdjacencyType(vertex - vertexIndexOffsets_[i - 1], edges[i - 1] - edgeStrides_[i - 1][i - 1]));
+        }
+        for(size_type i = 0; i < DIMENSION; ++i) {
+            f(AdjacencyType(vertex + vertexIndexOffsets_[i], edges[i]));
+        }
+    }
+    else {
+        for(size_type i = DIMENSION; i > 0; --i) {
+            if(vertexCoordinate[i - 1] > 0) {
+                f(AdjacencyType(vertex - vertexIndexOffsets_[i - 1], edges[i - 1] - edgeStrides_[i - 1][i - 1]));
+            }
+        }
+        for(size_type i = 0; i < DIMENSION; ++i) {
+            if(vertexCoordinate[i] + 1 < shape_[i]) {
+                f(AdjacencyType(vertex + vertexIndexOffsets_[i], edges[i]));
+            }
+        }
+    }
+}
+
+/// Call a function for each edge, in the order of edge indices.
+///
+/// Edges along one dimension are enumerated row by row, such that the
+/// vertices of consecutive edges are obtained by incrementing indices
+/// instead of decoding edge coordinates as in vertexOfEdge().
+///
+/// \param f Function that is called with the integer index of the edge and
+/// the integer indices of its first and second vertex, i.e.
+/// f(edge, vertexOfEdge(edge, 0), vertexOfEdge(edge, 1)).
+///
+template<unsigned char D, class VISITOR>
+template<class FUNCTION>
+inline void
+GridGraph<D, VISITOR>::forEachEdge(
+    FUNCTION f
+) const {
+    size_type edge = 0;
+    for(size_type i = 0; i < DIMENSION; ++i) {
+        const VertexCoordinate& edgeShape = edgeShapes_[i];
+        bool empty = false;
+        for(size_type j = 0; j < DIMENSION; ++j) {
+            if(edgeShape[j] == 0) {
+                empty = true;
+            }
+        }
+        if(empty) {
+            continue;
+        }
+
+        const size_type offset = vertexIndexOffsets_[i];
+        VertexCoordinate rowCoordinate = VertexCoordinate(); // coordinates 1, ..., D-1 of the row
+        size_type rowVertex = 0;
+        for(;;) {
+            for(size_type x = 0; x < edgeShape[0]; ++x, ++edge) {
+                f(edge, rowVertex + x, rowVertex + x + offset);
+            }
+
+            // advance to the next row
+            size_type j = 1;
+            for(; j < DIMENSION; ++j) {
+                ++rowCoordinate[j];
+                rowVertex += vertexIndexOffsets_[j];
+                if(rowCoordinate[j] < edgeShape[j]) {
+                    break;
+                }
+                rowVertex -= rowCoordinate[j] * vertexIndexOffsets_[j];
+                rowCoordinate[j] = 0;
+            }
+            if(j == DIMENSION) {
+                break;
+            }
+        }
+    }
+    assert(edge == numberOfEdges());
+}
+
+// index of the edge along a dimension whose smaller endpoint has the given coordinate
+template<unsigned char D, class VISITOR>
+inline typename GridGraph<D, VISITOR>::size_type
+GridGraph<D, VISITOR>::edgeOfPivot(
+    const VertexCoordinate& pivotCoordinate,
+    const size_type dimension
+) const {
+    size_type index = dimension > 0 ? edgeIndexOffsets_[dimension - 1] : 0;
+    for(size_type i = 0; i < DIMENSION; ++i) {
+        index += pivotCoordinate[i] * edgeStrides_[dimension][i];
+    }
+    return index;
+}
+
 /// Initialize an edge coordinate.
 /// \param pivotCoordinate coordinate of the reference vertex.
 /// \param dimension dimension along which the edge is drawn.
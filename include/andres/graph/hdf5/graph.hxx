@@ -2,6 +2,7 @@
 #ifndef ANDRES_GRAPH_GRAPH_HDF5_HXX
 #define ANDRES_GRAPH_GRAPH_HDF5_HXX
 
+#include <limits>
 #include <stdexcept>
 #include <string>
 #include <vector>
@@ -13,31 +14,31 @@ namespace andres {
 namespace graph {
 namespace hdf5 {
 
-template<class VISITOR>
-struct GraphTraitsHDF5<Graph<VISITOR> > {
+template<class VISITOR, class ALLOCATOR>
+struct GraphTraitsHDF5<Graph<VISITOR, ALLOCATOR> > {
     static const int ID;
 };
-template<class VISITOR>
-    const int GraphTraitsHDF5<Graph<VISITOR> >::ID = 10000;
+template<class VISITOR, class ALLOCATOR>
+    const int GraphTraitsHDF5<Graph<VISITOR, ALLOCATOR> >::ID = 10000;
 
-template <class VISITOR>
-void save(const hid_t, const std::string&, const Graph<VISITOR>&);
+template <class VISITOR, class ALLOCATOR>
+void save(const hid_t, const std::string&, const Graph<VISITOR, ALLOCATOR>&);
 
-template <class VISITOR>
-void load(const hid_t, const std::string&, Graph<VISITOR>&);
+template <class VISITOR, class ALLOCATOR>
+void load(const hid_t, const std::string&, Graph<VISITOR, ALLOCATOR>&);
 
-template <class VISITOR>
+template <class VISITOR, class ALLOCATOR>
 void
 save(
     const hid_t parentHandle,
     const std::string& graphName,
-    const Graph<VISITOR>& graph
+    const Graph<VISITOR, ALLOCATOR>& graph
 ) {
     HandleCheck<ANDRES_GRAPH_HDF5_DEBUG> handleCheck;
     hid_t groupHandle = openGroup(parentHandle, graphName, true);
 
     try {
-        save(groupHandle, "graph-type-id", GraphTraitsHDF5<Graph<VISITOR> >::ID);
+        save(groupHandle, "graph-type-id", GraphTraitsHDF5<Graph<VISITOR, ALLOCATOR> >::ID);
         save(groupHandle, "multiple-edges-enabled", static_cast<unsigned char>(graph.multipleEdgesEnabled()));
         save(groupHandle, "number-of-vertices", graph.numberOfVertices());
         save(groupHandle, "number-of-edges", graph.numberOfEdges());
@@ -60,12 +61,12 @@ save(
     closeGroup(groupHandle);
 }
 
-template <class VISITOR>
+template <class VISITOR, class ALLOCATOR>
 void
 load(
     const hid_t parentHandle,
     const std::string& graphName,
-    Graph<VISITOR>& graph
+    Graph<VISITOR, ALLOCATOR>& graph
 ) {
     HandleCheck<ANDRES_GRAPH_HDF5_DEBUG> handleCheck;
     hid_t groupHandle = openGroup(parentHandle, graphName);
@@ -75,7 +76,7 @@ load(
     try {
         int id = 0;
         load(groupHandle, "graph-type-id", id);
-        if(id != GraphTraitsHDF5<Graph<VISITOR> >::ID) {
+        if(id != GraphTraitsHDF5<Graph<VISITOR, ALLOCATOR> >::ID) {
             sError = "graph type id mismatch.";
             goto cleanup;
         }
@@ -86,6 +87,13 @@ load(
         std::size_t numberOfEdges = 0;
         load(groupHandle, "number-of-edges", numberOfEdges);
 
+        typedef typename Graph<VISITOR, ALLOCATOR>::IndexType IndexType;
+        if(numberOfVertices > static_cast<std::size_t>(std::numeric_limits<IndexType>::max())
+        || numberOfEdges > static_cast<std::size_t>(std::numeric_limits<IndexType>::max())) {
+            sError = "graph too large for the index type.";
+            goto cleanup;
+        }
+
         graph.assign(numberOfVertices);
 
         if(numberOfEdges != 0) {
@@ -112,6 +120,7 @@ load(
                 load(groupHandle, "multiple-edges-enabled", multipleEdgesEnabled);
                 graph.multipleEdgesEnabled() = static_cast<bool>(multipleEdgesEnabled);
             }
+            std::vector<std::pair<std::size_t, std::size_t> > edges(numberOfEdges);
             for(std::size_t i=0;i<numberOfEdges;++i) {
                 const std::size_t s = *(ptrI++);
                 const std::size_t t = *(ptrJ++);
@@ -119,8 +128,9 @@ load(
                     sError = "vertex index out of bounds.";
                     goto cleanup;
                 }
-                const std::size_t e = graph.insertEdge(s, t);
+                edges[i] = std::make_pair(s, t);
             }
+            graph.insertEdges(edges.begin(), edges.end());
         }
     } catch(std::exception& e) {
         sError = e.what();
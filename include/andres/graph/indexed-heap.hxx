@@ -0,0 +1,266 @@
+#pragma once
+#ifndef ANDRES_GRAPH_INDEXED_HEAP_HXX
+#define ANDRES_GRAPH_INDEXED_HEAP_HXX
+
+#include <cassert>
+#include <cstddef>
+#include <limits>
+#include <utility> // std::pair
+#include <vector>
+
+namespace andres {
+namespace graph {
+
+/// Min-heap of integer items with keys that can be decreased.
+///
+/// Each item 0, ..., n-1 is contained at most once. Its position in the heap
+/// is tracked, so that its key can be decreased in place instead of inserting
+/// the item another time. The heap therefore never holds more than n
+/// entries. Entries are stored in a flat array as a d-ary tree whose
+/// children of an entry are adjacent in memory.
+///
+/// Runtime complexity O(log_d(n)) for push, decreaseKey and pop, with pop
+/// costing d comparisons per level.
+///
+/// \tparam VALUE Type of keys.
+/// \tparam ARITY Number of children of each entry.
+///
+template<class VALUE, std::size_t ARITY = 4>
+class IndexedHeap {
+public:
+    typedef VALUE Value;
+
+    static const std::size_t NOT_IN_HEAP;
+
+    IndexedHeap(const std::size_t = 0);
+    void resize(const std::size_t);
+    void clear();
+    bool empty() const
+        { return entries_.empty(); }
+    std::size_t size() const
+        { return entries_.size(); }
+    std::size_t numberOfItems() const
+        { return positions_.size(); }
+    bool contains(const std::size_t item) const
+        { return positions_[item] != NOT_IN_HEAP; }
+    std::size_t top() const;
+    Value topKey() const;
+    Value key(const std::size_t) const;
+    void push(const std::size_t, const Value);
+    void decreaseKey(const std::size_t, const Value);
+    bool pushOrDecreaseKey(const std::size_t, const Value);
+    void pop();
+
+private:
+    typedef std::pair<Value, std::size_t> Entry;
+
+    void siftUp(std::size_t, const Entry&);
+    void siftDown(std::size_t, const Entry&);
+
+    std::vector<Entry> entries_; // key and item, in heap order
+    std::vector<std::size_t> positions_; // of each item in entries_
+};
+
+template<class VALUE, std::size_t ARITY>
+const std::size_t IndexedHeap<VALUE, ARITY>::NOT_IN_HEAP = std::numeric_limits<std::size_t>::max();
+
+/// Construct an empty heap.
+///
+/// \param numberOfItems Number of items that can be pushed.
+///
+template<class VALUE, std::size_t ARITY>
+inline
+IndexedHeap<VALUE, ARITY>::IndexedHeap(
+    const std::size_t numberOfItems
+)
+:   entries_(),
+    positions_(numberOfItems, NOT_IN_HEAP)
+{
+    static_assert(ARITY >= 2, "ARITY must be at least 2.");
+}
+
+/// Set the number of items that can be pushed.
+///
+/// Items that are dropped must not be contained in the heap.
+///
+/// \param numberOfItems Number of items.
+///
+template<class VALUE, std::size_t ARITY>
+inline void
+IndexedHeap<VALUE, ARITY>::resize(
+    const std::size_t numberOfItems
+) {
+    positions_.resize(numberOfItems, NOT_IN_HEAP);
+}
+
+/// Remove all items.
+///
+/// Runtime complexity O(size()), not O(numberOfItems()).
+///
+template<class VALUE, std::size_t ARITY>
+inline void
+IndexedHeap<VALUE, ARITY>::clear() {
+    for(std::size_t j = 0; j < entries_.size(); ++j) {
+        positions_[entries_[j].second] = NOT_IN_HEAP;
+    }
+    entries_.clear();
+}
+
+/// Get an item of smallest key.
+///
+template<class VALUE, std::size_t ARITY>
+inline std::size_t
+IndexedHeap<VALUE, ARITY>::top() const {
+    assert(!empty());
+    return entries_.front().second;
+}
+
+/// Get the smallest key.
+///
+template<class VALUE, std::size_t ARITY>
+inline typename IndexedHeap<VALUE, ARITY>::Value
+IndexedHeap<VALUE, ARITY>::topKey() const {
+    assert(!empty());
+    return entries_.front().first;
+}
+
+/// Get the key of a contained item.
+///
+/// \param item Item.
+///
+template<class VALUE, std::size_t ARITY>
+inline typename IndexedHeap<VALUE, ARITY>::Value
+IndexedHeap<VALUE, ARITY>::key(
+    const std::size_t item
+) const {
+    assert(contains(item));
+    return entries_[positions_[item]].first;
+}
+
+/// Insert an item that is not contained in the heap.
+///
+/// \param item Item.
+/// \param key Key.
+///
+template<class VALUE, std::size_t ARITY>
+inline void
+IndexedHeap<VALUE, ARITY>::push(
+    const std::size_t item,
+    const Value key
+) {
+    assert(item < numberOfItems());
+    assert(!contains(item));
+    entries_.push_back(Entry(key, item));
+    siftUp(entries_.size() - 1, Entry(key, item));
+}
+
+/// Decrease the key of a contained item.
+///
+/// \param item Item.
+/// \param key Key not greater than the current key of the item.
+///
+template<class VALUE, std::size_t ARITY>
+inline void
+IndexedHeap<VALUE, ARITY>::decreaseKey(
+    const std::size_t item,
+    const Value key
+) {
+    assert(contains(item));
+    assert(!(entries_[positions_[item]].first < key));
+    siftUp(positions_[item], Entry(key, item));
+}
+
+/// Insert an item or, if it is contained, decrease its key.
+///
+/// \param item Item.
+/// \param key Key.
+/// \return false if the item is contained with a key that is not greater.
+///
+template<class VALUE, std::size_t ARITY>
+inline bool
+IndexedHeap<VALUE, ARITY>::pushOrDecreaseKey(
+    const std::size_t item,
+    const Value key
+) {
+    if(!contains(item)) {
+        push(item, key);
+        return true;
+    }
+    else if(key < entries_[positions_[item]].first) {
+        decreaseKey(item, key);
+        return true;
+    }
+    else {
+        return false;
+    }
+}
+
+/// Remove an item of smallest key.
+///
+template<class VALUE, std::size_t ARITY>
+inline void
+IndexedHeap<VALUE, ARITY>::pop() {
+    assert(!empty());
+    positions_[entries_.front().second] = NOT_IN_HEAP;
+    const Entry last = entries_.back();
+    entries_.pop_back();
+    if(!entries_.empty()) {
+        siftDown(0, last);
+    }
+}
+
+// move the hole at a position up until an entry fits in
+template<class VALUE, std::size_t ARITY>
+inline void
+IndexedHeap<VALUE, ARITY>::siftUp(
+    std::size_t position,
+    const Entry& entry
+) {
+    while(position > 0) {
+        const std::size_t parent = (position - 1) / ARITY;
+        if(!(entry.first < entries_[parent].first)) {
+            break;
+        }
+        entries_[position] = entries_[parent];
+        positions_[entries_[position].second] = position;
+        position = parent;
+    }
+    entries_[position] = entry;
+    positions_[entry.second] = position;
+}
+
+// move the hole at a position down until an entry fits in
+template<class VALUE, std::size_t ARITY>
+inline void
+IndexedHeap<VALUE, ARITY>::siftDown(
+    std::size_t position,
+    const Entry& entry
+) {
+    const std::size_t size = entries_.size();
+    for(;;) {
+        const std::size_t firstChild = ARITY * position + 1;
+        if(firstChild >= size) {
+            break;
+        }
+        const std::size_t lastChild = firstChild + ARITY < size ? firstChild + ARITY : size;
+        std::size_t child = firstChild;
+        for(std::size_t j = firstChild + 1; j < lastChild; ++j) {
+            if(entries_[j].first < entries_[child].first) {
+                child = j;
+            }
+        }
+        if(!(entries_[child].first < entry.first)) {
+            break;
+        }
+        entries_[position] = entries_[child];
+        positions_[entries_[position].second] = position;
+        position = child;
+    }
+    entries_[position] = entry;
+    positions_[entry.second] = position;
+}
+
+} // namespace graph
+} // namespace andres
+
+#endif // #ifndef ANDRES_GRAPH_INDEXED_HEAP_HXX
@@ -0,0 +1,921 @@
+#pragma once
+#ifndef ANDRES_GRAPH_LIFTED_GRID_GRAPH_HXX
+#define ANDRES_GRAPH_LIFTED_GRID_GRAPH_HXX
+
+#include <cassert>
+#include <cstddef>
+#include <algorithm> // std::min, std::max, std::upper_bound
+#include <array>
+#include <iterator>
+#include <utility> // std::pair
+#include <vector>
+
+#include "adjacency.hxx"
+#include "grid-graph.hxx"
+#include "complete-graph.hxx" // detail::integerSquareRoot
+#include "lifting.hxx" // LiftingMetric
+
+namespace andres {
+namespace graph {
+
+/// Lifted graph of a two-dimensional grid graph whose edges are generated on
+/// the fly.
+///
+/// The vertices are those of the grid graph. Two distinct vertices are
+/// connected if their distance w.r.t. the LiftingMetric is greater than
+/// distanceLowerBound and at most distanceUpperBound. Vertices and edges are
+/// numbered exactly as in the Graph built by lift(), so edge costs computed
+/// for one can be used with the other.
+///
+/// Adjacencies and integer indices of edges are computed from the shape of
+/// the grid and the distance bounds. The index tables take
+/// O(shape(0) * distanceUpperBound + shape(1)) memory, compared to
+/// O(|V| * distanceUpperBound^2) for a lifted Graph. Adjacency iterators are
+/// forward iterators, and vertexOfEdge() takes logarithmic time. Algorithms
+/// that visit all edges should use forEachEdge().
+///
+/// LiftedGridGraph can be passed as the lifted graph to
+/// multicut_lifted::kernighanLin() and
+/// multicut_lifted::greedyAdditiveEdgeContraction().
+///
+class LiftedGridGraph {
+public:
+    typedef std::size_t size_type;
+    typedef Adjacency<> AdjacencyType;
+    typedef std::array<size_type, 2> VertexCoordinate;
+
+    // \cond SUPPRESS_DOXYGEN
+    class AdjacencyIterator
+    :   public std::iterator <
+            std::forward_iterator_tag,
+            const AdjacencyType
+        > {
+    public:
+        typedef LiftedGridGraph GraphType;
+        typedef std::iterator <
+                std::forward_iterator_tag,
+                const AdjacencyType
+            > Base;
+        typedef typename Base::difference_type difference_type;
+        typedef typename Base::pointer pointer;
+        typedef typename Base::reference reference;
+
+        AdjacencyIterator();
+        AdjacencyIterator(const GraphType&, const size_type, const bool);
+
+        // increment
+        AdjacencyIterator& operator++(); // prefix
+        AdjacencyIterator operator++(int); // postfix
+
+        // comparison
+        bool operator==(const AdjacencyIterator&) const;
+        bool operator!=(const AdjacencyIterator&) const;
+
+        // access
+        reference operator*();
+        pointer operator->();
+
+    protected:
+        void advanceToAdjacency();
+
+        const GraphType* graph_;
+        VertexCoordinate vertexCoordinate_;
+        std::ptrdiff_t row_; // relative to the row of the vertex
+        std::ptrdiff_t lastRow_;
+        std::size_t side_; // 0: left, 1: right
+        std::ptrdiff_t column_;
+        std::ptrdiff_t lastColumn_;
+        AdjacencyType adjacency_;
+    };
+
+    class VertexIterator
+    :   public AdjacencyIterator {
+    public:
+        typedef AdjacencyIterator Base;
+        typedef const size_type value_type;
+        typedef value_type* pointer;
+        typedef value_type& reference;
+
+        VertexIterator();
+        VertexIterator(const AdjacencyIterator&);
+
+        // access
+        value_type operator*() const;
+    private:
+        pointer operator->() const;
+    };
+
+    class EdgeIterator
+    :   public AdjacencyIterator {
+    public:
+        typedef AdjacencyIterator Base;
+        typedef const size_type value_type;
+        typedef value_type* pointer;
+        typedef value_type& reference;
+
+        EdgeIterator();
+        EdgeIterator(const AdjacencyIterator&);
+
+        // access
+        value_type operator*() const;
+    private:
+        pointer operator->() const;
+    };
+    // \endcond
+
+    // construction
+    LiftedGridGraph();
+    template<class VISITOR>
+        LiftedGridGraph(const GridGraph<2, VISITOR>&, const size_type, const size_type = 0, const LiftingMetric = LiftingMetric::PathLength);
+    void assign(const VertexCoordinate&, const size_type, const size_type = 0, const LiftingMetric = LiftingMetric::PathLength);
+
+    // iterator access
+    VertexIterator verticesFromVertexBegin(const size_type) const;
+    VertexIterator verticesFromVertexEnd(const size_type) const;
+    VertexIterator verticesToVertexBegin(const size_type) const;
+    VertexIterator verticesToVertexEnd(const size_type) const;
+    EdgeIterator edgesFromVertexBegin(const size_type) const;
+    EdgeIterator edgesFromVertexEnd(const size_type) const;
+    EdgeIterator edgesToVertexBegin(const size_type) const;
+    EdgeIterator edgesToVertexEnd(const size_type) const;
+    AdjacencyIterator adjacenciesFromVertexBegin(const size_type) const;
+    AdjacencyIterator adjacenciesFromVertexEnd(const size_type) const;
+    AdjacencyIterator adjacenciesToVertexBegin(const size_type) const;
+    AdjacencyIterator adjacenciesToVertexEnd(const size_type) const;
+
+    // access
+    size_type numberOfVertices() const;
+    size_type numberOfEdges() const;
+    size_type numberOfEdgesFromVertex(const size_type) const;
+    size_type numberOfEdgesToVertex(const size_type) const;
+    size_type vertexOfEdge(const size_type, const size_type) const;
+    std::pair<bool, size_type> findEdge(const size_type, const size_type) const;
+    bool multipleEdgesEnabled() const;
+
+    size_type shape(const size_type) const;
+    size_type distanceUpperBound() const;
+    size_type distanceLowerBound() const;
+    LiftingMetric metric() const;
+
+    size_type vertex(const VertexCoordinate&) const;
+    void vertex(size_type, VertexCoordinate&) const;
+
+    // stencil access
+    template<class FUNCTION>
+        void forEachAdjacency(const size_type, FUNCTION) const;
+    template<class FUNCTION>
+        void forEachEdge(FUNCTION) const;
+
+private:
+    void segment(const size_type, const size_type, const std::size_t, std::ptrdiff_t&, std::ptrdiff_t&) const;
+    size_type numberOfColumns(const size_type, const size_type, const std::size_t) const;
+    size_type firstEdgeOfVertex(const size_type, const size_type) const;
+    size_type edgeOfVertices(const size_type, const size_type, const size_type, const size_type) const;
+
+    VertexCoordinate shape_;
+    size_type distanceUpperBound_;
+    size_type distanceLowerBound_;
+    LiftingMetric metric_;
+    size_type numberOfRelativeRows_; // rows below a vertex that can contain neighbors, plus one
+
+    // for each relative row, the largest horizontal offset of a neighbor and
+    // the largest horizontal offset excluded by the lower bound (-1 if none)
+    std::vector<std::ptrdiff_t> outerOffsets_;
+    std::vector<std::ptrdiff_t> innerOffsets_;
+
+    // for each column, the number of edges to larger vertices in the rows
+    // before a relative row
+    std::vector<size_type> columnEdgeOffsets_;
+
+    // for each number of relative rows below a vertex, the number of edges to
+    // larger vertices from the vertices before a column of the grid row
+    std::vector<size_type> rowEdgeOffsets_;
+
+    // the number of edges to larger vertices from the vertices before a row
+    std::vector<size_type> edgeOffsets_;
+};
+
+/// Construct an empty lifted grid graph.
+///
+inline
+LiftedGridGraph::LiftedGridGraph() {
+    assign(VertexCoordinate({{0, 0}}), 0);
+}
+
+/// Construct the lifted graph of a grid graph.
+///
+/// \param gridGraph Grid graph.
+/// \param distanceUpperBound Largest distance of connected vertices.
+/// \param distanceLowerBound Vertices at this or a smaller distance are not
+/// connected.
+/// \param metric Metric w.r.t. which distances are measured.
+///
+template<class VISITOR>
+inline
+LiftedGridGraph::LiftedGridGraph(
+    const GridGraph<2, VISITOR>& gridGraph,
+    const size_type distanceUpperBound,
+    const size_type distanceLowerBound,
+    const LiftingMetric metric
+) {
+    assign(VertexCoordinate({{gridGraph.shape(0), gridGraph.shape(1)}}), distanceUpperBound, distanceLowerBound, metric);
+}
+
+/// Clear the lifted grid graph and assign a new shape and new distance bounds.
+///
+/// \param shape Shape of the grid.
+/// \param distanceUpperBound Largest distance of connected vertices.
+/// \param distanceLowerBound Vertices at this or a smaller distance are not
+/// connected.
+/// \param metric Metric w.r.t. which distances are measured.
+///
+inline void
+LiftedGridGraph::assign(
+    const VertexCoordinate& shape,
+    const size_type distanceUpperBound,
+    const size_type distanceLowerBound,
+    const LiftingMetric metric
+) {
+    shape_ = shape;
+    distanceUpperBound_ = distanceUpperBound;
+    distanceLowerBound_ = distanceLowerBound;
+    metric_ = metric;
+
+    // rows further below than the grid is high contain no neighbors
+    numberOfRelativeRows_ = shape_[1] == 0 ? 1 : std::min(distanceUpperBound, shape_[1] - 1) + 1;
+
+    outerOffsets_.resize(numberOfRelativeRows_);
+    innerOffsets_.resize(numberOfRelativeRows_);
+    for(size_type row = 0; row < numberOfRelativeRows_; ++row) {
+        if(metric == LiftingMetric::PathLength) {
+            outerOffsets_[row] = distanceUpperBound - row;
+            innerOffsets_[row] = row <= distanceLowerBound ? static_cast<std::ptrdiff_t>(distanceLowerBound - row) : -1;
+        }
+        else {
+            outerOffsets_[row] = detail::integerSquareRoot(distanceUpperBound * distanceUpperBound - row * row);
+            innerOffsets_[row] = row <= distanceLowerBound ?
+                static_cast<std::ptrdiff_t>(detail::integerSquareRoot(distanceLowerBound * distanceLowerBound - row * row)) : -1;
+        }
+    }
+
+    columnEdgeOffsets_.assign(shape_[0] * (numberOfRelativeRows_ + 1), 0);
+    for(size_type column = 0; column < shape_[0]; ++column) {
+        size_type* offsets = columnEdgeOffsets_.data() + column * (numberOfRelativeRows_ + 1);
+        for(size_type row = 0; row < numberOfRelativeRows_; ++row) {
+            offsets[row + 1] = offsets[row] + numberOfColumns(column, row, 1);
+            if(row > 0) {
+                offsets[row + 1] += numberOfColumns(column, row, 0);
+            }
+        }
+    }
+
+    rowEdgeOffsets_.assign(numberOfRelativeRows_ * (shape_[0] + 1), 0);
+    for(size_type rows = 0; rows < numberOfRelativeRows_; ++rows) {
+        size_type* offsets = rowEdgeOffsets_.data() + rows * (shape_[0] + 1);
+        for(size_type column = 0; column < shape_[0]; ++column) {
+            offsets[column + 1] = offsets[column] + columnEdgeOffsets_[column * (numberOfRelativeRows_ + 1) + rows + 1];
+        }
+    }
+
+    edgeOffsets_.assign(shape_[1] + 1, 0);
+    for(size_type row = 0; row < shape_[1]; ++row) {
+        const size_type rows = std::min(numberOfRelativeRows_ - 1, shape_[1] - 1 - row);
+        edgeOffsets_[row + 1] = edgeOffsets_[row] + rowEdgeOffsets_[rows * (shape_[0] + 1) + shape_[0]];
+    }
+}
+
+/// Get an iterator to the beginning of the sequence of vertices reachable
+/// from a given vertex via a single edge.
+///
+/// \param vertex Integer index of the vertex.
+/// \return VertexIterator.
+///
+inline LiftedGridGraph::VertexIterator
+LiftedGridGraph::verticesFromVertexBegin(
+    const size_type vertex
+) const {
+    return VertexIterator(adjacenciesFromVertexBegin(vertex));
+}
+
+/// Get an iterator to the end of the sequence of vertices reachable from
+/// a given vertex via a single edge.
+///
+/// \param vertex Integer index of the vertex.
+/// \return VertexIterator.
+///
+inline LiftedGridGraph::VertexIterator
+LiftedGridGraph::verticesFromVertexEnd(
+    const size_type vertex
+) const {
+    return VertexIterator(adjacenciesFromVertexEnd(vertex));
+}
+
+/// Get an iterator to the beginning of the sequence of vertices from which
+/// a given vertex is reachable via a single edge.
+///
+/// \param vertex Integer index of the vertex.
+/// \return VertexIterator.
+///
+inline LiftedGridGraph::VertexIterator
+LiftedGridGraph::verticesToVertexBegin(
+    const size_type vertex
+) const {
+    return verticesFromVertexBegin(vertex);
+}
+
+/// Get an iterator to the end of the sequence of vertices from which a
+/// given vertex is reachable via a single edge.
+///
+/// \param vertex Integer index of the vertex.
+/// \return VertexIterator.
+///
+inline LiftedGridGraph::VertexIterator
+LiftedGridGraph::verticesToVertexEnd(
+    const size_type vertex
+) const {
+    return verticesFromVertexEnd(vertex);
+}
+
+/// Get an iterator to the beginning of the sequence of edges that start
+/// at a given vertex.
+///
+/// \param vertex Integer index of the vertex.
+/// \return EdgeIterator.
+///
+inline LiftedGridGraph::EdgeIterator
+LiftedGridGraph::edgesFromVertexBegin(
+    const size_type vertex
+) const {
+    return EdgeIterator(adjacenciesFromVertexBegin(vertex));
+}
+
+/// Get an iterator to the end of the sequence of edges that start at a
+/// given vertex.
+///
+/// \param vertex Integer index of the vertex.
+/// \return EdgeIterator.
+///
+inline LiftedGridGraph::EdgeIterator
+LiftedGridGraph::edgesFromVertexEnd(
+    const size_type vertex
+) const {
+    return EdgeIterator(adjacenciesFromVertexEnd(vertex));
+}
+
+/// Get an iterator to the beginning of the sequence of edges that end at
+/// a given vertex.
+///
+/// \param vertex Integer index of the vertex.
+/// \return EdgeIterator.
+///
+inline LiftedGridGraph::EdgeIterator
+LiftedGridGraph::edgesToVertexBegin(
+    const size_type vertex
+) const {
+    return edgesFromVertexBegin(vertex);
+}
+
+/// Get an iterator to the end of the sequence of edges that end at a
+/// given vertex.
+///
+/// \param vertex Integer index of the vertex.
+/// \return EdgeIterator.
+///
+inline LiftedGridGraph::EdgeIterator
+LiftedGridGraph::edgesToVertexEnd(
+    const size_type vertex
+) const {
+    return edgesFromVertexEnd(vertex);
+}
+
+/// Get an iterator to the beginning of the sequence of adjacencies that
+/// start at a given vertex. Adjacencies are ordered by the integer index of
+/// the adjacent vertex.
+///
+/// \param vertex Integer index of the vertex.
+/// \return AdjacencyIterator.
+///
+inline LiftedGridGraph::AdjacencyIterator
+LiftedGridGraph::adjacenciesFromVertexBegin(
+    const size_type vertex
+) const {
+    return AdjacencyIterator(*this, vertex, true);
+}
+
+/// Get an iterator to the end of the sequence of adjacencies that start
+/// at a given vertex.
+///
+/// \param vertex Integer index of the vertex.
+/// \return AdjacencyIterator.
+///
+inline LiftedGridGraph::AdjacencyIterator
+LiftedGridGraph::adjacenciesFromVertexEnd(
+    const size_type vertex
+) const {
+    return AdjacencyIterator(*this, vertex, false);
+}
+
+/// Get an iterator to the beginning of the sequence of adjacencies that
+/// end at a given vertex.
+///
+/// \param vertex Integer index of the vertex.
+/// \return AdjacencyIterator.
+///
+inline LiftedGridGraph::AdjacencyIterator
+LiftedGridGraph::adjacenciesToVertexBegin(
+    const size_type vertex
+) const {
+    return adjacenciesFromVertexBegin(vertex);
+}
+
+/// Get an iterator to the end of the sequence of adjacencies that end at
+/// a given vertex.
+///
+/// \param vertex Integer index of the vertex.
+/// \return AdjacencyIterator.
+///
+inline LiftedGridGraph::AdjacencyIterator
+LiftedGridGraph::adjacenciesToVertexEnd(
+    const size_type vertex
+) const {
+    return adjacenciesFromVertexEnd(vertex);
+}
+
+/// Get the number of vertices.
+///
+inline LiftedGridGraph::size_type
+LiftedGridGraph::numberOfVertices() const {
+    return shape_[0] * shape_[1];
+}
+
+/// Get the number of edges.
+///
+inline LiftedGridGraph::size_type
+LiftedGridGraph::numberOfEdges() const {
+    return edgeOffsets_.back();
+}
+
+/// Get the number of edges that start at a given vertex.
+///
+/// \param vertex Integer index of a vertex.
+///
+/// Runtime complexity O(distanceUpperBound).
+///
+inline LiftedGridGraph::size_type
+LiftedGridGraph::numberOfEdgesFromVertex(
+    const size_type vertex
+) const {
+    VertexCoordinate cv;
+    this->vertex(vertex, cv);
+    const size_type rowsAbove = std::min(numberOfRelativeRows_ - 1, cv[1]);
+    const size_type rowsBelow = std::min(numberOfRelativeRows_ - 1, shape_[1] - 1 - cv[1]);
+
+    // the neighborhood is symmetric, except for the clipping of rows
+    const size_type* offsets = columnEdgeOffsets_.data() + cv[0] * (numberOfRelativeRows_ + 1);
+    return offsets[rowsBelow + 1] + (offsets[rowsAbove + 1] - offsets[1]) + numberOfColumns(cv[0], 0, 0);
+}
+
+/// Get the number of edges that end at a given vertex.
+///
+/// \param vertex Integer index of a vertex.
+///
+inline LiftedGridGraph::size_type
+LiftedGridGraph::numberOfEdgesToVertex(
+    const size_type vertex
+) const {
+    return numberOfEdgesFromVertex(vertex);
+}
+
+/// Get the integer index of a vertex of an edge.
+///
+/// \param edge Integer index of an edge.
+/// \param j Number of the vertex in the edge; either 0 or 1. Vertex 0 is the
+/// one with the smaller integer index.
+///
+/// Runtime complexity O(log(shape(0) * shape(1) * distanceUpperBound)).
+///
+inline LiftedGridGraph::size_type
+LiftedGridGraph::vertexOfEdge(
+    const size_type edge,
+    const size_type j
+) const {
+    assert(edge < numberOfEdges());
+    assert(j < 2);
+
+    const size_type row = (std::upper_bound(edgeOffsets_.begin(), edgeOffsets_.end(), edge) - edgeOffsets_.begin()) - 1;
+    const size_type rows = std::min(numberOfRelativeRows_ - 1, shape_[1] - 1 - row);
+    const size_type* rowOffsets = rowEdgeOffsets_.data() + rows * (shape_[0] + 1);
+    const size_type edgeInRow = edge - edgeOffsets_[row];
+    const size_type column = (std::upper_bound(rowOffsets, rowOffsets + shape_[0] + 1, edgeInRow) - rowOffsets) - 1;
+    if(j == 0) {
+        return row * shape_[0] + column;
+    }
+
+    const size_type* columnOffsets = columnEdgeOffsets_.data() + column * (numberOfRelativeRows_ + 1);
+    const size_type edgeInColumn = edgeInRow - rowOffsets[column];
+    const size_type relativeRow = (std::upper_bound(columnOffsets, columnOffsets + rows + 2, edgeInColumn) - columnOffsets) - 1;
+    size_type index = edgeInColumn - columnOffsets[relativeRow];
+
+    std::ptrdiff_t first;
+    std::ptrdiff_t last;
+    if(relativeRow > 0) {
+        const size_type numberOfLeftColumns = numberOfColumns(column, relativeRow, 0);
+        if(index < numberOfLeftColumns) {
+            segment(column, relativeRow, 0, first, last);
+            return (row + relativeRow) * shape_[0] + first + index;
+        }
+        index -= numberOfLeftColumns;
+    }
+    segment(column, relativeRow, 1, first, last);
+    return (row + relativeRow) * shape_[0] + first + index;
+}
+
+/// Search for an edge in constant time.
+///
+/// \param vertex0 first vertex of the edge.
+/// \param vertex1 second vertex of the edge.
+/// \retval pair an \c std::pair. If an edge was found, \c pair.first
+/// is \c true and the value of \c pair.second is the index of the edge.
+/// If no edge was found, \c pair.first is \c false and the value of
+/// \c pair.second is undefined.
+///
+inline std::pair<bool, LiftedGridGraph::size_type>
+LiftedGridGraph::findEdge(
+    const size_type vertex0,
+    const size_type vertex1
+) const {
+    assert(vertex0 < numberOfVertices());
+    assert(vertex1 < numberOfVertices());
+
+    if(vertex0 == vertex1) {
+        return std::make_pair(false, 0);
+    }
+    VertexCoordinate cv;
+    VertexCoordinate cw;
+    vertex(std::min(vertex0, vertex1), cv);
+    vertex(std::max(vertex0, vertex1), cw);
+
+    const size_type relativeRow = cw[1] - cv[1];
+    if(relativeRow >= numberOfRelativeRows_) {
+        return std::make_pair(false, 0);
+    }
+    for(std::size_t side = (relativeRow == 0 ? 1 : 0); side < 2; ++side) {
+        std::ptrdiff_t first;
+        std::ptrdiff_t last;
+        segment(cv[0], relativeRow, side, first, last);
+        if(static_cast<std::ptrdiff_t>(cw[0]) >= first && static_cast<std::ptrdiff_t>(cw[0]) <= last) {
+            return std::make_pair(true, edgeOfVertices(cv[0], cv[1], cw[0], cw[1]));
+        }
+    }
+    return std::make_pair(false, 0);
+}
+
+/// Indicate if multiple edges are enabled.
+///
+/// \return false
+///
+inline bool
+LiftedGridGraph::multipleEdgesEnabled() const {
+    return false;
+}
+
+/// Get the size of the grid in one dimension.
+///
+/// \param dimension Either 0 or 1.
+///
+inline LiftedGridGraph::size_type
+LiftedGridGraph::shape(
+    const size_type dimension
+) const {
+    return shape_[dimension];
+}
+
+/// Get the largest distance of connected vertices.
+///
+inline LiftedGridGraph::size_type
+LiftedGridGraph::distanceUpperBound() const {
+    return distanceUpperBound_;
+}
+
+/// Get the largest distance of vertices that are not connected.
+///
+inline LiftedGridGraph::size_type
+LiftedGridGraph::distanceLowerBound() const {
+    return distanceLowerBound_;
+}
+
+/// Get the metric w.r.t. which distances are measured.
+///
+inline LiftingMetric
+LiftedGridGraph::metric() const {
+    return metric_;
+}
+
+/// Get the integer index of a vertex from its coordinate.
+///
+/// \param vertexCoordinate Coordinate of the vertex.
+///
+inline LiftedGridGraph::size_type
+LiftedGridGraph::vertex(
+    const VertexCoordinate& vertexCoordinate
+) const {
+    return vertexCoordinate[1] * shape_[0] + vertexCoordinate[0];
+}
+
+/// Get the coordinate of a vertex from its integer index.
+///
+/// \param vertex Integer index of the vertex.
+/// \param[out] vertexCoordinate Coordinate of the vertex.
+///
+inline void
+LiftedGridGraph::vertex(
+    size_type vertex,
+    VertexCoordinate& vertexCoordinate
+) const {
+    assert(vertex < numberOfVertices());
+    vertexCoordinate[0] = vertex % shape_[0];
+    vertexCoordinate[1] = vertex / shape_[0];
+}
+
+/// Call a function for each adjacency from a vertex, in the order of the
+/// integer indices of the adjacent vertices.
+///
+/// \param vertex Integer index of the vertex.
+/// \param f Function that is called with an AdjacencyType for each
+/// adjacency.
+///
+template<class FUNCTION>
+inline void
+LiftedGridGraph::forEachAdjacency(
+    const size_type vertex,
+    FUNCTION f
+) const {
+    for(AdjacencyIterator it = adjacenciesFromVertexBegin(vertex); it != adjacenciesFromVertexEnd(vertex); ++it) {
+        f(*it);
+    }
+}
+
+/// Call a function for each edge, in the order of edge indices.
+///
+/// Edges are generated row by row, without the searches of vertexOfEdge().
+///
+/// \param f Function that is called with the integer index of each edge
+/// and the integer indices of its first and second vertex.
+///
+template<class FUNCTION>
+inline void
+LiftedGridGraph::forEachEdge(
+    FUNCTION f
+) const {
+    size_type edge = 0;
+    for(size_type y = 0; y < shape_[1]; ++y)
+    for(size_type x = 0; x < shape_[0]; ++x) {
+        const size_type v = y * shape_[0] + x;
+        const size_type rows = std::min(numberOfRelativeRows_ - 1, shape_[1] - 1 - y);
+        for(size_type relativeRow = 0; relativeRow <= rows; ++relativeRow)
+        for(std::size_t side = (relativeRow == 0 ? 1 : 0); side < 2; ++side) {
+            std::ptrdiff_t first;
+            std::ptrdiff_t last;
+            segment(x, relativeRow, side, first, last);
+            for(std::ptrdiff_t column = first; column <= last; ++column, ++edge) {
+                f(edge, v, (y + relativeRow) * shape_[0] + column);
+            }
+        }
+    }
+    assert(edge == numberOfEdges());
+}
+
+// columns of the neighbors of a vertex in the given column, in a row at the
+// given vertical distance, either left (side 0) or right (side 1) of the
+// columns excluded by the lower bound. the segment is empty if first > last.
+inline void
+LiftedGridGraph::segment(
+    const size_type column,
+    const size_type relativeRow,
+    const std::size_t side,
+    std::ptrdiff_t& first,
+    std::ptrdiff_t& last
+) const {
+    const std::ptrdiff_t x = static_cast<std::ptrdiff_t>(column);
+    const std::ptrdiff_t outer = outerOffsets_[relativeRow];
+    const std::ptrdiff_t inner = innerOffsets_[relativeRow];
+    if(side == 0) {
+        first = std::max<std::ptrdiff_t>(0, x - outer);
+        last = std::min<std::ptrdiff_t>(shape_[0] - 1, x - inner - 1);
+    }
+    else {
+        first = std::max<std::ptrdiff_t>(0, x + std::max(inner + 1, -inner));
+        last = std::min<std::ptrdiff_t>(shape_[0] - 1, x + outer);
+    }
+}
+
+inline LiftedGridGraph::size_type
+LiftedGridGraph::numberOfColumns(
+    const size_type column,
+    const size_type relativeRow,
+    const std::size_t side
+) const {
+    std::ptrdiff_t first;
+    std::ptrdiff_t last;
+    segment(column, relativeRow, side, first, last);
+    return first <= last ? last - first + 1 : 0;
+}
+
+// integer index of the first edge to a larger vertex
+inline LiftedGridGraph::size_type
+LiftedGridGraph::firstEdgeOfVertex(
+    const size_type column,
+    const size_type row
+) const {
+    const size_type rows = std::min(numberOfRelativeRows_ - 1, shape_[1] - 1 - row);
+    return edgeOffsets_[row] + rowEdgeOffsets_[rows * (shape_[0] + 1) + column];
+}
+
+// integer index of the edge between the vertex (column0, row0) and the
+// larger vertex (column1, row1)
+inline LiftedGridGraph::size_type
+LiftedGridGraph::edgeOfVertices(
+    const size_type column0,
+    const size_type row0,
+    const size_type column1,
+    const size_type row1
+) const {
+    const size_type relativeRow = row1 - row0;
+    size_type edge = firstEdgeOfVertex(column0, row0)
+        + columnEdgeOffsets_[column0 * (numberOfRelativeRows_ + 1) + relativeRow];
+
+    std::ptrdiff_t first;
+    std::ptrdiff_t last;
+    if(relativeRow > 0) {
+        segment(column0, relativeRow, 0, first, last);
+        if(static_cast<std::ptrdiff_t>(column1) <= last) {
+            return edge + (column1 - first);
+        }
+        edge += numberOfColumns(column0, relativeRow, 0);
+    }
+    segment(column0, relativeRow, 1, first, last);
+    return edge + (column1 - first);
+}
+
+// \cond SUPPRESS_DOXYGEN
+
+// implementation of AdjacencyIterator
+
+inline
+LiftedGridGraph::AdjacencyIterator::AdjacencyIterator()
+:   graph_(0),
+    vertexCoordinate_({{0, 0}}),
+    row_(0),
+    lastRow_(0),
+    side_(0),
+    column_(0),
+    lastColumn_(0),
+    adjacency_()
+{}
+
+// relative rows run from the topmost to the bottommost row that can contain
+// neighbors. the end iterator is one row past the bottommost row.
+inline
+LiftedGridGraph::AdjacencyIterator::AdjacencyIterator(
+    const GraphType& graph,
+    const size_type vertex,
+    const bool begin
+)
+:   graph_(&graph),
+    side_(0),
+    column_(0),
+    lastColumn_(0),
+    adjacency_()
+{
+    graph.vertex(vertex, vertexCoordinate_);
+    const size_type rowsAbove = std::min(graph.numberOfRelativeRows_ - 1, vertexCoordinate_[1]);
+    const size_type rowsBelow = std::min(graph.numberOfRelativeRows_ - 1, graph.shape_[1] - 1 - vertexCoordinate_[1]);
+    lastRow_ = static_cast<std::ptrdiff_t>(rowsBelow);
+    if(begin) {
+        row_ = -static_cast<std::ptrdiff_t>(rowsAbove);
+        graph.segment(vertexCoordinate_[0], rowsAbove, side_, column_, lastColumn_);
+        advanceToAdjacency();
+    }
+    else {
+        row_ = lastRow_ + 1;
+    }
+}
+
+// moves forward to the next segment that is not empty, unless the current
+// column is in the current segment, and updates the adjacency
+inline void
+LiftedGridGraph::AdjacencyIterator::advanceToAdjacency() {
+    while(column_ > lastColumn_) {
+        if(side_ == 0) {
+            side_ = 1;
+        }
+        else {
+            side_ = 0;
+            ++row_;
+        }
+        if(row_ > lastRow_) {
+            side_ = 0;
+            column_ = 0;
+            return;
+        }
+        const size_type relativeRow = static_cast<size_type>(row_ < 0 ? -row_ : row_);
+        graph_->segment(vertexCoordinate_[0], relativeRow, side_, column_, lastColumn_);
+    }
+
+    const size_type row = static_cast<size_type>(static_cast<std::ptrdiff_t>(vertexCoordinate_[1]) + row_);
+    const size_type column = static_cast<size_type>(column_);
+    const size_type vertex = row * graph_->shape_[0] + column;
+    const bool larger = row_ > 0 || (row_ == 0 && side_ == 1);
+    const size_type edge = larger ?
+        graph_->edgeOfVertices(vertexCoordinate_[0], vertexCoordinate_[1], column, row) :
+        graph_->edgeOfVertices(column, row, vertexCoordinate_[0], vertexCoordinate_[1]);
+    adjacency_ = AdjacencyType(vertex, edge);
+}
+
+inline LiftedGridGraph::AdjacencyIterator&
+LiftedGridGraph::AdjacencyIterator::operator++() {
+    assert(row_ <= lastRow_);
+    ++column_;
+    advanceToAdjacency();
+    return *this;
+}
+
+inline LiftedGridGraph::AdjacencyIterator
+LiftedGridGraph::AdjacencyIterator::operator++(int) {
+    AdjacencyIterator copy = *this;
+    ++*this;
+    return copy;
+}
+
+inline bool
+LiftedGridGraph::AdjacencyIterator::operator==(
+    const AdjacencyIterator& other
+) const {
+    return row_ == other.row_
+        && side_ == other.side_
+        && column_ == other.column_
+        && vertexCoordinate_ == other.vertexCoordinate_
+        && graph_ == other.graph_;
+}
+
+inline bool
+LiftedGridGraph::AdjacencyIterator::operator!=(
+    const AdjacencyIterator& other
+) const {
+    return !(*this == other);
+}
+
+inline LiftedGridGraph::AdjacencyIterator::reference
+LiftedGridGraph::AdjacencyIterator::operator*() {
+    return adjacency_;
+}
+
+inline LiftedGridGraph::AdjacencyIterator::pointer
+LiftedGridGraph::AdjacencyIterator::operator->() {
+    return &adjacency_;
+}
+
+// implementation of VertexIterator
+
+inline
+LiftedGridGraph::VertexIterator::VertexIterator()
+:   Base()
+{}
+
+inline
+LiftedGridGraph::VertexIterator::VertexIterator(
+    const AdjacencyIterator& it
+)
+:   Base(it)
+{}
+
+inline LiftedGridGraph::VertexIterator::value_type
+LiftedGridGraph::VertexIterator::operator*() const {
+    return Base::adjacency_.vertex();
+}
+
+// implementation of EdgeIterator
+
+inline
+LiftedGridGraph::EdgeIterator::EdgeIterator()
+:   Base()
+{}
+
+inline
+LiftedGridGraph::EdgeIterator::EdgeIterator(
+    const AdjacencyIterator& it
+)
+:   Base(it)
+{}
+
+inline LiftedGridGraph::EdgeIterator::value_type
+LiftedGridGraph::EdgeIterator::operator*() const {
+    return Base::adjacency_.edge();
+}
+
+// \endcond
+
+} // namespace graph
+} // namespace andres
+
+#endif // #ifndef ANDRES_GRAPH_LIFTED_GRID_GRAPH_HXX
@@ -10,8 +10,10 @@
 #include <iterator> // std::iterator_traits
 #include <algorithm> // std::fill
 #include <vector>
+#include <utility> // std::pair
 
 #include "grid-graph.hxx"
+#include "edge-index.hxx" // detail::IsDirected
 #include "bfs.hxx"
 
 
@@ -20,7 +22,82 @@ namespace graph {
 
 enum class LiftingMetric { PathLength, L2 };
 
+// \cond SUPPRESS_DOXYGEN
+namespace detail {
+
+// graphs that insert edges in bulk, e.g. Graph and Digraph. The search for
+// duplicates is skipped if the sequence of edges is free of duplicates.
+template<class GRAPH, class ITERATOR>
+inline auto
+insertLiftedEdges(
+    GRAPH& graph,
+    const std::size_t numberOfVertices,
+    ITERATOR begin,
+    ITERATOR end,
+    const bool unique,
+    int
+) -> decltype(graph.insertEdges(begin, end), void()) {
+    graph.insertVertices(numberOfVertices);
+    if(unique && !graph.multipleEdgesEnabled()) {
+        graph.multipleEdgesEnabled() = true;
+        graph.insertEdges(begin, end);
+        graph.multipleEdgesEnabled() = false;
+    }
+    else {
+        graph.insertEdges(begin, end);
+    }
+}
+
+// graphs that are built at once, e.g. StaticGraph
+template<class GRAPH, class ITERATOR>
+inline void
+insertLiftedEdges(
+    GRAPH& graph,
+    const std::size_t numberOfVertices,
+    ITERATOR begin,
+    ITERATOR end,
+    const bool unique,
+    long
+) {
+    if(!unique)
+        throw std::runtime_error("lifting a directed graph into this type of undirected graph is not supported.");
+    graph.assign(numberOfVertices, begin, end);
+}
+
+template<class EDGE>
+inline void
+concatenateLiftedEdges(
+    std::vector<std::vector<EDGE> >& parts,
+    std::vector<EDGE>& edges
+) {
+    std::size_t numberOfEdges = 0;
+    for(std::size_t j = 0; j < parts.size(); ++j)
+        numberOfEdges += parts[j].size();
+
+    edges.reserve(numberOfEdges);
+    for(std::size_t j = 0; j < parts.size(); ++j) {
+        edges.insert(edges.end(), parts[j].begin(), parts[j].end());
+        std::vector<EDGE>().swap(parts[j]); // free memory early
+    }
+}
+
+} // namespace detail
+// \endcond
+
 /// Lift a graph.
+///
+/// Every pair of distinct vertices whose distance in the input graph is
+/// greater than distanceLowerBound and at most distanceUpperBound is
+/// connected by an edge in the output graph. Edges are numbered in the
+/// order of their first and then second vertex, independent of the number
+/// of threads.
+///
+/// Sources are searched in parallel if OpenMP is enabled. Each thread keeps
+/// one MultiSourceBreadthFirstSearchData, i.e. memory linear in the number
+/// of vertices. The lifted edges are collected per batch of sources, merged
+/// in the order of batches and inserted into the output graph at once.
+/// The output graph can be a Graph, a Digraph or a StaticGraph.
+///
 template<class INPUT_GRAPH, class OUTPUT_GRAPH>
 inline void
 lift(
@@ -30,57 +107,68 @@ lift(
     const std::size_t distanceLowerBound = 0
 ) {
     typedef std::size_t size_type;
+    typedef std::pair<size_type, size_type> EdgeType;
 
     if(outputGraph.numberOfVertices() != 0)
         throw std::runtime_error("output graph is not empty.");
 
-    outputGraph.insertVertices(inputGraph.numberOfVertices());
-
-    BreadthFirstSearchData<size_type> breadthFirstSearchData(inputGraph.numberOfVertices());
-    std::vector<std::size_t> visited;
-    std::vector<std::size_t> vertices;
+    // for undirected graphs, the edge to a smaller vertex is a duplicate of
+    // an edge found from that vertex before
+    const bool onlyLargerVertices = !detail::IsDirected<INPUT_GRAPH>::value
+        && !detail::IsDirected<OUTPUT_GRAPH>::value;
+    const bool unique = !detail::IsDirected<INPUT_GRAPH>::value
+        || detail::IsDirected<OUTPUT_GRAPH>::value;
 
+    // sources are searched in batches of consecutive vertices whose
+    // neighborhoods tend to overlap
+    std::vector<size_type> sources(inputGraph.numberOfVertices());
     for (size_type v = 0; v < inputGraph.numberOfVertices(); ++v)
-    {
-        breadthFirstSearch(
-            inputGraph,
-            v,
-            [&](size_type w, size_type depth, bool& proceed, bool& add)
-            {
-                proceed = true;
-                add = false;
+        sources[v] = v;
 
-                if (depth <= distanceUpperBound)
-                {
-                    if (depth + 1 <= distanceUpperBound)
-                    {
-                        add = true;
-                        visited.push_back(w);
-                    }
-
-                    if (depth > distanceLowerBound)
-                        vertices.push_back(w);
-                }
-            },
-            breadthFirstSearchData
-            );
-
-        std::sort(vertices.begin(), vertices.end());
-
-        for (auto w : vertices)
-            outputGraph.insertEdge(v, w);
-
-        vertices.clear();
+    const size_type batchSize = MultiSourceBreadthFirstSearchData<size_type>::BATCH_SIZE;
+    const std::ptrdiff_t numberOfBatches = (inputGraph.numberOfVertices() + batchSize - 1) / batchSize;
+    std::vector<std::vector<EdgeType> > batchEdges(numberOfBatches);
 
-        breadthFirstSearchData.depth(v) = BreadthFirstSearchData<size_type>::NOT_VISITED;
-        for (auto w : visited)
-            breadthFirstSearchData.depth(w) = BreadthFirstSearchData<size_type>::NOT_VISITED;
+#pragma omp parallel
+    {
+        MultiSourceBreadthFirstSearchData<size_type> multiSourceBreadthFirstSearchData(inputGraph.numberOfVertices());
 
-        visited.clear();
+#pragma omp for schedule(dynamic)
+        for (std::ptrdiff_t batch = 0; batch < numberOfBatches; ++batch)
+        {
+            const size_type first = batch * batchSize;
+            const size_type last = std::min(first + batchSize, inputGraph.numberOfVertices());
+            std::vector<EdgeType>& edges = batchEdges[batch];
+
+            multiSourceBreadthFirstSearch(
+                inputGraph,
+                sources.begin() + first,
+                sources.begin() + last,
+                distanceUpperBound,
+                [&](size_type v, size_type w, size_type depth)
+                {
+                    if (depth > distanceLowerBound && (!onlyLargerVertices || w > v))
+                        edges.push_back(EdgeType(v, w));
+                },
+                multiSourceBreadthFirstSearchData
+                );
+
+            // edges are inserted in the order of their first and then second vertex
+            std::sort(edges.begin(), edges.end());
+        }
     }
+
+    std::vector<EdgeType> edges;
+    detail::concatenateLiftedEdges(batchEdges, edges);
+    detail::insertLiftedEdges(outputGraph, inputGraph.numberOfVertices(), edges.begin(), edges.end(), unique, 0);
 }
 
 /// Lift a grid graph - a faster implementation using the grid structure.
+///
+/// Rows of the grid are lifted in parallel if OpenMP is enabled. Edges are
+/// numbered in the same order as by the generic lift(), independent of the
+/// number of threads.
+///
 template<class INPUT_GRAPH_VISITOR, class OUTPUT_GRAPH>
 inline void
 lift(
@@ -93,6 +181,7 @@ lift(
     typedef GridGraph<2, INPUT_GRAPH_VISITOR> INPUT_GRAPH;
 
     typedef std::size_t size_type;
+    typedef std::pair<size_type, size_type> EdgeType;
     typedef typename INPUT_GRAPH::VertexCoordinate VertexCoordinate;
 
     const size_type distanceUpperBoundSquared = distanceUpperBound * distanceUpperBound;
@@ -101,15 +190,23 @@ lift(
     if(outputGraph.numberOfVertices() != 0)
         throw std::runtime_error("output graph is not empty.");
 
-    outputGraph.insertVertices(inputGraph.numberOfVertices());
+    // for undirected output graphs, the above portion of the window and the
+    // left half of the middle line are duplicates of edges found before
+    const bool onlyLargerVertices = !detail::IsDirected<OUTPUT_GRAPH>::value;
 
-    VertexCoordinate cv;
-    for (size_type v = 0; v < inputGraph.numberOfVertices(); ++v)
+    const std::ptrdiff_t numberOfRows = inputGraph.shape(1);
+    std::vector<std::vector<EdgeType> > rowEdges(numberOfRows);
+
+#pragma omp parallel for schedule(dynamic)
+    for (std::ptrdiff_t row = 0; row < numberOfRows; ++row)
+    for (size_type column = 0; column < inputGraph.shape(0); ++column)
     {
-        inputGraph.vertex(v, cv);
+        std::vector<EdgeType>& edges = rowEdges[row];
+        const VertexCoordinate cv = {{column, static_cast<size_type>(row)}};
+        const size_type v = inputGraph.vertex(cv);
 
         // fill above portion of the window
-        if (cv[1] > 0)
+        if (cv[1] > 0 && !onlyLargerVertices)
         {
             const std::size_t row0 = cv[1] < distanceUpperBound ? 0 : cv[1] - distanceUpperBound;
             std::size_t offsetY = 1;
@@ -136,7 +233,7 @@ lift(
                         if (distance > distanceLowerBound)
                         {
                             const size_type w = inputGraph.vertex({{x, yPlus - 1}});
-                            outputGraph.insertEdge(v, w);
+                            edges.push_back(EdgeType(v, w));
                         }
                     }
                     else
@@ -146,7 +243,7 @@ lift(
                         if (sqaredDistance > distanceLowerBoundSquared)
                         {
                             const size_type w = inputGraph.vertex({{x, yPlus - 1}});
-                            outputGraph.insertEdge(v, w);
+                            edges.push_back(EdgeType(v, w));
                         }
                     }
                 }
@@ -163,17 +260,17 @@ lift(
             if (colN > inputGraph.shape(0) - 1)
                 colN = inputGraph.shape(0) - 1;
 
-            if (cv[0] > distanceLowerBound)
+            if (cv[0] > distanceLowerBound && !onlyLargerVertices)
                 for (std::size_t x = col0; x <= cv[0] - distanceLowerBound - 1; ++x)
                 {
                     const size_type& w = inputGraph.vertex({{x, y}});
-                    outputGraph.insertEdge(v, w);
+                    edges.push_back(EdgeType(v, w));
                 }
 
             for (std::size_t x = cv[0] + distanceLowerBound + 1; x <= colN; ++x)
             {
                 const size_type& w = inputGraph.vertex({{x, y}});
-                outputGraph.insertEdge(v, w);
+                edges.push_back(EdgeType(v, w));
             }
         }
 
@@ -208,7 +305,7 @@ lift(
                         if (distance > distanceLowerBound)
                         {
                             const size_type w = inputGraph.vertex({{x, y}});
-                            outputGraph.insertEdge(v, w);
+                            edges.push_back(EdgeType(v, w));
                         }
                     }
                     else
@@ -218,13 +315,17 @@ lift(
                         if (sqaredDistance > distanceLowerBoundSquared)
                         {
                             const size_type w = inputGraph.vertex({{x, y}});
-                            outputGraph.insertEdge(v, w);
+                            edges.push_back(EdgeType(v, w));
                         }
                     }
                 }
             }
         }
     }
+
+    std::vector<EdgeType> edges;
+    detail::concatenateLiftedEdges(rowEdges, edges);
+    detail::insertLiftedEdges(outputGraph, inputGraph.numberOfVertices(), edges.begin(), edges.end(), true, 0);
 }
 
 } // namespace graph
@@ -258,9 +258,9 @@ MaxFlowPushRelabel<GRAPH, FLOW>::operator()(
     // first, push as much flow as possible from the source to all adjacent vertices
     for(EdgeIterator it = graph.edgesFromVertexBegin(sourceVertexIndex); it != graph.edgesFromVertexEnd(sourceVertexIndex); ++it) {
         const std::size_t edgeIndex = *it;
-        if (mask.edge(edgeIndex)) {
+        if (detail::isEdgeInSubgraph(mask, edgeIndex)) {
             const std::size_t v = graph.vertexOfEdge(edgeIndex, 1);
-            if (mask.vertex(v)) {
+            if (detail::isVertexInSubgraph(mask, v)) {
                 push(graph, edgeWeightIterator, edgeIndex);
             }
         }
@@ -353,9 +353,9 @@ MaxFlowPushRelabel<GRAPH, FLOW>::relabel(
     const std::size_t oldHeight = height_[u];
     for(EdgeIterator it = graph.edgesFromVertexBegin(u); it != graph.edgesFromVertexEnd(u); ++it) {
         const std::size_t edgeIndex = *it;
-        if (mask.edge(edgeIndex)) {
+        if (detail::isEdgeInSubgraph(mask, edgeIndex)) {
             const std::size_t v = graph.vertexOfEdge(edgeIndex, 1); // edge is (u, v)
-            if (mask.vertex(v)) {
+            if (detail::isVertexInSubgraph(mask, v)) {
                 if(edgeWeightIterator[edgeIndex] - flow_[edgeIndex] > 0) {
                     minHeight = std::min(minHeight, height_[v]);
                 }
@@ -364,9 +364,9 @@ MaxFlowPushRelabel<GRAPH, FLOW>::relabel(
     }
     for(EdgeIterator it = graph.edgesToVertexBegin(u); it != graph.edgesToVertexEnd(u); ++it) {
         const std::size_t edgeIndex = *it;
-        if (mask.edge(edgeIndex)) {
+        if (detail::isEdgeInSubgraph(mask, edgeIndex)) {
             const std::size_t v = graph.vertexOfEdge(edgeIndex, 0); // edge is (v, u)
-            if (mask.vertex(v)) {
+            if (detail::isVertexInSubgraph(mask, v)) {
                 if(flow_[edgeIndex] > 0) {
                     minHeight = std::min(minHeight, height_[v]);
                 }
@@ -407,9 +407,9 @@ MaxFlowPushRelabel<GRAPH, FLOW>::discharge(
     while(excess_[u] > 0) {
         for(EdgeIterator it = graph.edgesFromVertexBegin(u); it != graph.edgesFromVertexEnd(u); ++it) {
             const std::size_t edgeIndex = *it;
-            if (mask.edge(edgeIndex)) {
+            if (detail::isEdgeInSubgraph(mask, edgeIndex)) {
                 const std::size_t v = graph.vertexOfEdge(edgeIndex, 1); // edge is the pair (u, v)
-                if (mask.vertex(v)) {
+                if (detail::isVertexInSubgraph(mask, v)) {
                     if(edgeWeightIterator[edgeIndex] - flow_[edgeIndex] > 0 && height_[u] > height_[v]) {
                         push(graph, edgeWeightIterator, edgeIndex);
                     }
@@ -418,9 +418,9 @@ MaxFlowPushRelabel<GRAPH, FLOW>::discharge(
         }
         for(EdgeIterator it = graph.edgesToVertexBegin(u); it != graph.edgesToVertexEnd(u); ++it) {
             const std::size_t edgeIndex = *it;
-            if (mask.edge(edgeIndex)) {
+            if (detail::isEdgeInSubgraph(mask, edgeIndex)) {
                 const std::size_t v = graph.vertexOfEdge(edgeIndex, 0); // edge is the pair (v, u)
-                if (mask.vertex(v)) {
+                if (detail::isVertexInSubgraph(mask, v)) {
                     if(flow_[edgeIndex] > 0 && height_[u] > height_[v]) {
                         pushBack(graph, edgeWeightIterator, edgeIndex);
                     }
@@ -2,12 +2,13 @@
 #ifndef ANDRES_GRAPH_MINIMUM_SPANNING_TREE_HXX
 #define ANDRES_GRAPH_MINIMUM_SPANNING_TREE_HXX
 
-#include <queue>
 #include <stdexcept>
 #include <vector>
+#include <limits>
 
 #include "andres/functional.hxx"
 #include "subgraph.hxx"
+#include "indexed-heap.hxx"
 
 namespace andres {
 namespace graph {
@@ -158,27 +159,13 @@ findMSTPrim(
 {
     typedef typename ECA::value_type value_type;
 
-    struct element
-    {
-        element(value_type weight, std::size_t vertex_index) :
-            weight_(weight), vertex_index_(vertex_index)
-        {}
-
-        bool operator<(const element& other) const
-        {
-            // as std::priority_queue is a max heap, invert comparison's logic
-            return weight_ > other.weight_;
-        }
-
-        value_type weight_;
-        std::size_t vertex_index_;
-    };
-
     std::vector<value_type> min_edge(graph.numberOfVertices(), std::numeric_limits<value_type>::max());
     std::vector<char> visited(graph.numberOfVertices());
 
-    std::priority_queue<element> Q;
-    Q.push(element(value_type(), starting_vertex));
+    // each vertex is contained at most once, with the weight of the
+    // lightest edge connecting it to the tree
+    IndexedHeap<value_type> Q(graph.numberOfVertices());
+    Q.push(starting_vertex, value_type());
 
     predecessor[starting_vertex] = graph.numberOfEdges();
 
@@ -187,26 +174,23 @@ findMSTPrim(
     while (!Q.empty())
     {
         auto v = Q.top();
+        mst_value += Q.topKey();
         Q.pop();
 
-        if (visited[v.vertex_index_])
-            continue;
-
-        visited[v.vertex_index_] = 1;
-        mst_value += v.weight_;
+        visited[v] = 1;
 
-        auto e = graph.edgesFromVertexBegin(v.vertex_index_);
-        for (auto w = graph.verticesFromVertexBegin(v.vertex_index_); w != graph.verticesFromVertexEnd(v.vertex_index_); ++w, ++e)
+        auto e = graph.edgesFromVertexBegin(v);
+        for (auto w = graph.verticesFromVertexBegin(v); w != graph.verticesFromVertexEnd(v); ++w, ++e)
             if (subgraph_mask.vertex(*w) &&
                 subgraph_mask.edge(*e) &&
                 !visited[*w] &&
-                *w != v.vertex_index_ &&
+                *w != v &&
                 f(edge_weights[*e]) < min_edge[*w]
                 )
             {
                 min_edge[*w] = f(edge_weights[*e]);
                 predecessor[*w] = *e;
-                Q.push(element(f(edge_weights[*e]), *w));
+                Q.pushOrDecreaseKey(*w, f(edge_weights[*e]));
             }
     }
 
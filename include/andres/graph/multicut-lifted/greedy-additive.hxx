@@ -8,8 +8,10 @@
 #include <algorithm>
 #include <map>
 #include <queue>
+#include <limits>
 
 #include "andres/partition.hxx"
+#include "../for-each.hxx"
 
 namespace andres {
 namespace graph {
@@ -94,19 +96,13 @@ std::vector<size_t> greedyAdditiveEdgeContraction(
     DynamicGraph lifted_graph_cp(original_graph.numberOfVertices());
     std::priority_queue<Edge> Q;
 
-    for (size_t i = 0; i < original_graph.numberOfEdges(); ++i)
+    forEachEdge(original_graph, [&](size_t, size_t a, size_t b)
     {
-        auto const a = original_graph.vertexOfEdge(i, 0);
-        auto const b = original_graph.vertexOfEdge(i, 1);
-        
         original_graph_cp.setEdgeWeight(a, b, 1.);
-    }
+    });
 
-    for (size_t i = 0; i < lifted_graph.numberOfEdges(); ++i)
+    forEachEdge(lifted_graph, [&](size_t i, size_t a, size_t b)
     {
-        auto const a = lifted_graph.vertexOfEdge(i, 0);
-        auto const b = lifted_graph.vertexOfEdge(i, 1);
-
         lifted_graph_cp.setEdgeWeight(a, b, edge_costs[i]);
         
         if (original_graph_cp.edgeExists(a, b))
@@ -116,7 +112,7 @@ std::vector<size_t> greedyAdditiveEdgeContraction(
 
             Q.push(e);
         }
-    }
+    });
 
     andres::Partition<size_t> partition(original_graph.numberOfVertices());
     while (!Q.empty() && partition.numberOfSets() > number_of_clusters_lower_bound)
@@ -200,13 +196,10 @@ void greedyAdditiveEdgeContraction(
 {
     auto vertex_labels = greedyAdditiveEdgeContraction(original_graph, lifted_graph, edge_costs);
 
-    for (size_t e = 0; e < lifted_graph.numberOfEdges(); ++e)
+    forEachEdge(lifted_graph, [&](size_t e, size_t v0, size_t v1)
     {
-        auto const v0 = lifted_graph.vertexOfEdge(e, 0);
-        auto const v1 = lifted_graph.vertexOfEdge(e, 1);
-
         edge_labels[e] = (vertex_labels[v0] != vertex_labels[v1]) ? 1 : 0;
-    }
+    });
 }
 
 } // namespace multicut_lifted 
@@ -7,6 +7,7 @@
 #include <stack>
 #include <algorithm>
 #include <iomanip>
+#include <limits>
 
 #include <andres/graph/paths.hxx>
 #include <andres/graph/components.hxx>
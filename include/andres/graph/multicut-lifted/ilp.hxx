@@ -7,10 +7,12 @@
 #include <stack>
 #include <algorithm>
 #include <iomanip>
+#include <limits>
 
 #include <andres/graph/paths.hxx>
 #include <andres/graph/components.hxx>
 #include <andres/graph/shortest-paths.hxx>
+#include <andres/graph/search-workspace.hxx>
 
 
 namespace andres {
@@ -57,7 +59,7 @@ void ilp(ORIGGRAPH const& original_graph, LIFTGRAPH const& lifted_graph, ECA con
 
     std::vector<double> coefficients(lifted_graph.numberOfEdges());
     ComponentsBySearch<ORIGGRAPH> components;
-    std::vector<ptrdiff_t> buffer;
+    SearchWorkspace<> workspace(original_graph);
     std::vector<size_t> edge_in_lifted_graph(original_graph.numberOfEdges());
     std::deque<size_t> path;
     std::vector<size_t> variables(lifted_graph.numberOfEdges());
@@ -82,7 +84,7 @@ void ilp(ORIGGRAPH const& original_graph, LIFTGRAPH const& lifted_graph, ECA con
                 // if cycle/path inequality is violated
 
                 // search for shortest path that contains only non-lifted edges
-                spsp(original_graph, SubgraphWithCut(ilp, edge_in_lifted_graph), lv0, lv1, path, buffer);
+                spsp(original_graph, SubgraphWithCut(ilp, edge_in_lifted_graph), lv0, lv1, path, workspace);
 
                 bool chordless = true;
                 for (auto it1 = path.begin(); it1 != path.end() - 2 && chordless; ++it1)
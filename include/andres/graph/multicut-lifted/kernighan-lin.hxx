@@ -8,6 +8,9 @@
 #include <set>
 #include <vector>
 #include <stack>
+#include <limits>
+
+#include "../for-each.hxx"
 
 
 
@@ -281,14 +284,11 @@ auto kernighanLin(
     {
         double obj_value = .0;
 
-        for (size_t i = 0; i < lifted_graph.numberOfEdges(); ++i)
+        forEachEdge(lifted_graph, [&](size_t i, size_t v0, size_t v1)
         {
-            auto const v0 = lifted_graph.vertexOfEdge(i, 0);
-            auto const v1 = lifted_graph.vertexOfEdge(i, 1);
-
             if (vertex_labels[v0] != vertex_labels[v1])
                 obj_value += edge_costs[i];
-        }
+        });
 
         return obj_value;
     };
@@ -420,14 +420,14 @@ auto kernighanLin(
             changed = mark_partitions_that_changed_shape(vertex_labels_for_changed_thing, buffer.vertex_labels);
 
         std::vector<std::set<size_t>> edges(partitions.size());
-        for (size_t e = 0; e < original_graph.numberOfEdges(); ++e)
+        forEachEdge(original_graph, [&](size_t, size_t w0, size_t w1)
         {
-            auto const v0 = buffer.vertex_labels[original_graph.vertexOfEdge(e, 0)];
-            auto const v1 = buffer.vertex_labels[original_graph.vertexOfEdge(e, 1)];
+            auto const v0 = buffer.vertex_labels[w0];
+            auto const v1 = buffer.vertex_labels[w1];
 
             if (v0 != v1)
                 edges[std::min(v0, v1)].insert(std::max(v0, v1));
-        }
+        });
 
         for (size_t i = 0; i < partitions.size(); ++i)
             if (!partitions[i].empty())
@@ -487,16 +487,13 @@ auto kernighanLin(
             break;
 
         bool didnt_change = true;
-        for (size_t i = 0; i < lifted_graph.numberOfEdges(); ++i)
+        forEachEdge(lifted_graph, [&](size_t, size_t v0, size_t v1)
         {
-            auto v0 = lifted_graph.vertexOfEdge(i, 0);
-            auto v1 = lifted_graph.vertexOfEdge(i, 1);
-
             auto edge_label = buffer.vertex_labels[v0] == buffer.vertex_labels[v1] ? 0 : 1;
 
             if (static_cast<bool>(edge_label) != (last_good_vertex_labels[v0] != last_good_vertex_labels[v1]))
                 didnt_change = false;
-        }
+        });
 
         if (didnt_change)
             break;
@@ -570,13 +567,10 @@ void kernighanLin(const ORIGINAL_GRAPH& original_graph, const LIFTED_GRAPH& lift
 
     vertex_labels = kernighanLin(original_graph, lifted_graph, edge_costs, vertex_labels, visitor, settings);
 
-    for (size_t e = 0; e < lifted_graph.numberOfEdges(); ++e)
+    forEachEdge(lifted_graph, [&](size_t e, size_t v0, size_t v1)
     {
-        auto const v0 = lifted_graph.vertexOfEdge(e, 0);
-        auto const v1 = lifted_graph.vertexOfEdge(e, 1);
-
         output_edge_labels[e] = (vertex_labels[v0] != vertex_labels[v1]) ? 1 : 0;
-    }
+    });
 }
 
 }
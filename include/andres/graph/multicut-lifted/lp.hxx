@@ -6,8 +6,10 @@
 #include <deque>
 #include <algorithm>
 #include <stack>
+#include <limits>
 
 #include <andres/graph/shortest-paths.hxx>
+#include <andres/graph/search-workspace.hxx>
 
 
 namespace andres {
@@ -186,9 +188,8 @@ std::vector<double> lp(ORIGGRAPH const& original_graph, LIFTGRAPH const& lifted_
     LP lp;
     
     std::vector<double> coefficients(lifted_graph.numberOfEdges());
-    std::vector<double> distances(lifted_graph.numberOfVertices()); 
     std::vector<size_t> edge_in_lifted_graph(original_graph.numberOfEdges());
-    std::vector<size_t> parents(lifted_graph.numberOfVertices());
+    SearchWorkspace<double> workspace(original_graph);
     std::deque<size_t> path;
     std::vector<double> vars(original_graph.numberOfEdges());
     std::vector<size_t> variables(lifted_graph.numberOfEdges());
@@ -222,7 +223,7 @@ std::vector<double> lp(ORIGGRAPH const& original_graph, LIFTGRAPH const& lifted_
 
             // search for shortest path
             double distance;
-            spsp(original_graph, DefaultSubgraphMask<>(), lv0, lv1, vars.begin(), path, distance, distances.begin(), parents.begin());
+            spsp(original_graph, DefaultSubgraphMask<>(), lv0, lv1, vars.begin(), path, distance, workspace);
 
             bool chordless = true;
             for (auto it1 = path.begin(); it1 != path.end() - 2 && chordless; ++it1)
@@ -232,7 +233,7 @@ std::vector<double> lp(ORIGGRAPH const& original_graph, LIFTGRAPH const& lifted_
                         continue;
 
                     auto const e = lifted_graph.findEdge(*it1, *it2);
-                    if (e.first && std::min(std::max(.0, lp.variableValue(e.second)), 1.0) > distances[*it2] - distances[*it1] + tolerance)
+                    if (e.first && std::min(std::max(.0, lp.variableValue(e.second)), 1.0) > workspace.distance(*it2) - workspace.distance(*it1) + tolerance)
                     {
                         chordless = false;
                         break;
@@ -4,16 +4,40 @@
 
 #include <deque>
 #include <algorithm>
+#include <limits>
 
-#include "andres/graph/components.hxx"
+#include "andres/graph/dynamic-connectivity.hxx"
 #include "andres/graph/shortest-paths.hxx"
+#include "andres/graph/search-workspace.hxx"
 #include "andres/graph/graph.hxx"
+#include "andres/graph/edge-index.hxx"
 
 namespace andres {
 namespace graph {
 namespace multicut {
 
 
+// Subgraph mask that hides edges which are marked for removal
+struct CyclePackingSubgraph
+{
+    CyclePackingSubgraph(std::vector<char> const& removed) :
+        removed_(removed)
+    {}
+
+    bool vertex(size_t) const
+    {
+        return true;
+    }
+
+    bool edge(size_t e) const
+    {
+        return !removed_[e];
+    }
+
+    std::vector<char> const& removed_;
+};
+
+
 // Copyright (c) Jan-Hendrik Lange 2018
 //
 // Heuristic algorithm that computes a dual lower bound
@@ -33,6 +57,9 @@ iterativeCyclePacking(GRAPH const& graph_orig, ECA const& edgeCosts, bool verbos
     double lower_bound = 0;
     double const tolerance = std::numeric_limits<double>::epsilon();
 
+    // constant-time lookup of edges in the original graph
+    EdgeIndex<GRAPH> edge_index(graph_orig);
+
     // copy attraction subgraph
     andres::graph::Graph<> graph(graph_orig.numberOfVertices());
     graph.reserveEdges(graph_orig.numberOfEdges());
@@ -58,12 +85,31 @@ iterativeCyclePacking(GRAPH const& graph_orig, ECA const& edgeCosts, bool verbos
         std::cout << "Trivial bound: " << trivial_bound << std::endl;
     }
 
-    ComponentsBySearch<andres::graph::Graph<>> components;
+    // connectivity of the attraction graph, updated whenever an edge is removed
+    DynamicConnectivity<andres::graph::Graph<>> connectivity;
+    connectivity.build(graph);
+
+    // edge of the connectivity structure for each edge of the attraction graph
+    std::vector<size_t> connectivity_edges(graph.numberOfEdges());
+    for (size_t e = 0; e < graph.numberOfEdges(); e++)
+        connectivity_edges[e] = e;
+
+    // edges of negligible weight are masked and erased periodically in one pass
+    std::vector<char> removed(graph.numberOfEdges());
+    auto eraseRemovedEdges = [&] ()
+    {
+        size_t j = 0;
+        for (size_t e = 0; e < graph.numberOfEdges(); e++)
+            if (!removed[e])
+                connectivity_edges[j++] = connectivity_edges[e];
+        connectivity_edges.resize(j);
+
+        graph.eraseEdges(removed);
+        removed.assign(graph.numberOfEdges(), 0);
+    };
 
     std::deque<size_t> path;
-    std::vector<ptrdiff_t> parents(graph.numberOfVertices());
-    std::vector<size_t> labels(graph.numberOfVertices());
-    size_t seen_label = 0;
+    SearchWorkspace<> workspace(graph);
 
     size_t nCycles = 0;
 
@@ -77,8 +123,7 @@ iterativeCyclePacking(GRAPH const& graph_orig, ECA const& edgeCosts, bool verbos
         if (verbose)
             std::cout << "Round " << cycle_length-3 << ", L = " << lower_bound << std::endl;
 
-        // update component labeling
-        components.build(graph);
+        eraseRemovedEdges();
 
         size_t progress = 0;
 
@@ -91,39 +136,33 @@ iterativeCyclePacking(GRAPH const& graph_orig, ECA const& edgeCosts, bool verbos
         // iterate over repulsive edges
         for (auto p : repulsive_edges)
         {
-            // periodically update component labeling for speed-up
+            // periodically erase removed edges to speed up the search for cycles
             progress++;
             if (progress > 0.1 * repulsive_edges.size())
             {
-                components.build(graph);
+                eraseRemovedEdges();
                 progress = 0;
             }
 
             auto v0 = p.first;
             auto v1 = p.second;
-            size_t f = graph_orig.findEdge(v0, v1).second;
+            size_t f = edge_index.findEdge(v0, v1).second;
             
             // check if conflicted cycle exists
-            if (!components.areConnected(v0, v1))
+            if (!connectivity.areConnected(v0, v1))
                 continue;
 
             // pack short cycles as long as available and positive weight left
             while (edge_costs[f] < -tolerance)
             {
-                seen_label++;
-                if (seen_label == 0)
-                {
-                    std::fill(labels.begin(), labels.end(), 0);
-                    seen_label++;
-                }
-                if (!spsp(graph, DefaultSubgraphMask<>(), v0, v1, path, parents, labels, seen_label, cycle_length-1))
+                if (!spsp(graph, CyclePackingSubgraph(removed), v0, v1, path, workspace, cycle_length-1))
                     break;
                 
                 // find minimum weight edge in cycle
                 double min_weight = -edge_costs[f];
                 for (size_t j = 0; j < path.size() - 1; ++j)
                 {
-                    auto e = graph_orig.findEdge(path[j], path[j + 1]).second;
+                    auto e = edge_index.findEdge(path[j], path[j + 1]).second;
                     if (edge_costs[e] < min_weight)
                         min_weight = edge_costs[e];
                 }
@@ -131,10 +170,17 @@ iterativeCyclePacking(GRAPH const& graph_orig, ECA const& edgeCosts, bool verbos
                 edge_costs[f] += min_weight;
                 for (size_t j = 0; j < path.size() - 1; ++j)
                 {
-                    auto e = graph_orig.findEdge(path[j], path[j + 1]).second;
+                    auto e = edge_index.findEdge(path[j], path[j + 1]).second;
                     edge_costs[e] -= min_weight;
                     if (edge_costs[e] < tolerance)
-                        graph.eraseEdge(graph.findEdge(path[j], path[j+1]).second);
+                    {
+                        auto g = graph.findEdge(path[j], path[j+1]).second;
+                        if (!removed[g])
+                        {
+                            removed[g] = 1;
+                            connectivity.eraseEdge(connectivity_edges[g]);
+                        }
+                    }
                 }
                 // update lower bound
                 lower_bound += min_weight;
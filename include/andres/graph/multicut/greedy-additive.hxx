@@ -10,6 +10,7 @@
 #include <queue>
 
 #include "andres/partition.hxx"
+#include "../for-each.hxx"
 
 
 namespace andres {
@@ -93,18 +94,15 @@ void greedyAdditiveEdgeContraction(
     DynamicGraph original_graph_cp(graph.numberOfVertices());
     std::priority_queue<Edge> Q;
 
-    for (size_t i = 0; i < graph.numberOfEdges(); ++i)
+    forEachEdge(graph, [&](size_t i, size_t a, size_t b)
     {
-        auto a = graph.vertexOfEdge(i, 0);
-        auto b = graph.vertexOfEdge(i, 1);
-
         original_graph_cp.updateEdgeWeight(a, b, edge_values[i]);
 
         auto e = Edge(a, b, edge_values[i]);
         e.edition = ++edge_editions[e.a][e.b];
         
         Q.push(e);
-    }
+    });
 
     andres::Partition<size_t> partition(graph.numberOfVertices());
 
@@ -143,8 +141,10 @@ void greedyAdditiveEdgeContraction(
         original_graph_cp.removeVertex(merge_vertex);
     }
 
-    for (size_t i = 0; i < graph.numberOfEdges(); ++i)
-        edge_labels[i] = partition.find(graph.vertexOfEdge(i, 0)) == partition.find(graph.vertexOfEdge(i, 1)) ? 0 : 1;
+    forEachEdge(graph, [&](size_t i, size_t a, size_t b)
+    {
+        edge_labels[i] = partition.find(a) == partition.find(b) ? 0 : 1;
+    });
 }
 
 } // namespace multicut
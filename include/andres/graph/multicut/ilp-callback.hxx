@@ -6,11 +6,14 @@
 #include <deque>
 #include <array>
 #include <algorithm> // std::copy
+#include <limits>
 
 #include "andres/graph/complete-graph.hxx"
 #include "andres/graph/components.hxx"
+#include "andres/graph/edge-index.hxx"
 #include "andres/graph/paths.hxx"
 #include "andres/graph/shortest-paths.hxx"
+#include "andres/graph/search-workspace.hxx"
 
 
 namespace andres {
@@ -70,18 +73,21 @@ void ilp_callback(GRAPH const& graph, ECA const& edgeCosts, ELA const& inputLabe
     {
     public:
         Callback(ILP& solver, GRAPH const& graph) :
-            ILP::Callback(solver), graph_(graph)
+            ILP::Callback(solver), graph_(graph), edge_index_(graph)
         {}
 
         void separateAndAddLazyConstraints() override
         {
-            ComponentsBySearch<GRAPH> components;
+            ComponentsByParallelUnionFind<GRAPH> components;
             std::deque<size_t> path;
-            std::vector<ptrdiff_t> buffer;
+            SearchWorkspace<> workspace(graph_);
             std::vector<double> variables(graph_.numberOfEdges());
             std::vector<double> coefficients(graph_.numberOfEdges());
 
-            components.build(graph_, SubgraphWithCut(*this));
+            // evaluate the labels once instead of on every edge visit
+            BitsetSubgraphMask<> subgraph(graph_, SubgraphWithCut(*this));
+
+            components.build(graph_, subgraph);
 
             // search for violated non-chordal cycles and add corresp. inequalities
             for (size_t edge = 0; edge < graph_.numberOfEdges(); ++edge) 
@@ -93,16 +99,16 @@ void ilp_callback(GRAPH const& graph, ECA const& edgeCosts, ELA const& inputLabe
                     if (components.areConnected(v0, v1))
                     { 
                         // search for shortest path
-                        spsp(graph_, SubgraphWithCut(*this), v0, v1, path, buffer);
+                        spsp(graph_, subgraph, v0, v1, path, workspace);
                         
                         // skip chordal paths
-                        if (findChord(graph_, path.begin(), path.end(), true).first)
+                        if (findChord(edge_index_, path.begin(), path.end(), true).first)
                             continue;
 
                         // add inequality
                         for (size_t j = 0; j < path.size() - 1; ++j)
                         {
-                            variables[j] = static_cast<double>(graph_.findEdge(path[j], path[j + 1]).second);
+                            variables[j] = static_cast<double>(edge_index_.findEdge(path[j], path[j + 1]).second);
                             coefficients[j] = 1.0;
                         }
 
@@ -134,6 +140,7 @@ void ilp_callback(GRAPH const& graph, ECA const& edgeCosts, ELA const& inputLabe
         };
 
         GRAPH const& graph_;
+        EdgeIndex<GRAPH> edge_index_;
     };
 
     ILP ilp;
@@ -148,7 +155,7 @@ void ilp_callback(GRAPH const& graph, ECA const& edgeCosts, ELA const& inputLabe
 
     ilp.optimize();
 
-    ComponentsBySearch<GRAPH> components;
+    ComponentsByParallelUnionFind<GRAPH> components;
     components.build(graph, SubgraphWithCut(ilp));
 
     for (size_t edge = 0; edge < graph.numberOfEdges(); ++edge)
@@ -209,14 +216,12 @@ void ilp_callback(CompleteGraph<GRAPH_VISITOR> const& graph, ECA const& edgeCost
             std::array<double, 3> variables;
             std::array<double, 3> coefficients;
 
-            for (size_t edge = 0; edge < graph_.numberOfEdges(); ++edge) 
+            graph_.forEachEdge([&](size_t edge, size_t v0, size_t v1)
+            {
                 if (this->label(edge) > .5)
                 {
                     variables[2] = edge;
 
-                    auto const v0 = graph_.vertexOfEdge(edge, 0);
-                    auto const v1 = graph_.vertexOfEdge(edge, 1);
-
                     for (size_t i = 0; i < graph_.numberOfVertices(); ++i)
                     {
                         if (i == v0 || i == v1)
@@ -235,6 +240,7 @@ void ilp_callback(CompleteGraph<GRAPH_VISITOR> const& graph, ECA const& edgeCost
                         }
                     }
                 }
+            });
         }
     private:
         CompleteGraph<GRAPH_VISITOR> const& graph_;
@@ -252,16 +258,13 @@ void ilp_callback(CompleteGraph<GRAPH_VISITOR> const& graph, ECA const& edgeCost
 
     ilp.optimize();
 
-    ComponentsBySearch<CompleteGraph<GRAPH_VISITOR>> components;
+    ComponentsByParallelUnionFind<CompleteGraph<GRAPH_VISITOR>> components;
     components.build(graph, SubgraphWithCut(ilp));
 
-    for (size_t edge = 0; edge < graph.numberOfEdges(); ++edge)
+    graph.forEachEdge([&](size_t edge, size_t v0, size_t v1)
     {
-        auto const v0 = graph.vertexOfEdge(edge, 0);
-        auto const v1 = graph.vertexOfEdge(edge, 1);
-
         outputLabels[edge] = components.areConnected(v0, v1) ? 0 : 1;
-    }
+    });
 }
 
 } // namespace multicut
@@ -6,11 +6,13 @@
 #include <deque>
 #include <array>
 #include <algorithm>
+#include <limits>
 
 #include <andres/graph/complete-graph.hxx>
 #include <andres/graph/components.hxx>
 #include <andres/graph/paths.hxx>
 #include <andres/graph/shortest-paths.hxx>
+#include <andres/graph/search-workspace.hxx>
 
 namespace andres {
 namespace graph {
@@ -69,10 +71,10 @@ ilp(
         ILP const& ilp_;
     };
 
-    ComponentsBySearch<GRAPH> components;
+    ComponentsByParallelUnionFind<GRAPH> components;
     ILP ilp;
     std::deque<size_t> path;
-    std::vector<ptrdiff_t> buffer;
+    SearchWorkspace<> workspace(graph);
     std::vector<size_t> variables(graph.numberOfEdges());
     std::vector<double> coefficients(graph.numberOfEdges());
 
@@ -92,7 +94,7 @@ ilp(
                 if (components.areConnected(v0, v1))
                 { 
                     // search for shortest path
-                    spsp(graph, SubgraphWithCut(ilp), v0, v1, path, buffer);
+                    spsp(graph, SubgraphWithCut(ilp), v0, v1, path, workspace);
                     
                     // skip chordal paths
                     if (findChord(graph, path.begin(), path.end(), true).first)
@@ -197,14 +199,12 @@ ilp(
     {
         size_t nCycle = 0;
 
-        for (size_t edge = 0; edge < graph.numberOfEdges(); ++edge) 
+        graph.forEachEdge([&](size_t edge, size_t v0, size_t v1)
+        {
             if (ilp.label(edge) > .5)
             {
                 variables[2] = edge;
 
-                auto const v0 = graph.vertexOfEdge(edge, 0);
-                auto const v1 = graph.vertexOfEdge(edge, 1);
-
                 for (size_t i = 0; i < graph.numberOfVertices(); ++i)
                 {
                     if (i == v0 || i == v1)
@@ -225,6 +225,7 @@ ilp(
                     }
                 }
             }
+        });
 
         return nCycle;
     };
@@ -240,16 +241,13 @@ ilp(
             break;
     }
 
-    ComponentsBySearch<CompleteGraph<GRAPH_VISITOR>> components;
+    ComponentsByParallelUnionFind<CompleteGraph<GRAPH_VISITOR>> components;
     components.build(graph, SubgraphWithCut(ilp));
 
-    for (size_t edge = 0; edge < graph.numberOfEdges(); ++edge)
+    graph.forEachEdge([&](size_t edge, size_t v0, size_t v1)
     {
-        auto const v0 = graph.vertexOfEdge(edge, 0);
-        auto const v1 = graph.vertexOfEdge(edge, 1);
-
         outputLabels[edge] = components.areConnected(v0, v1) ? 0 : 1;
-    }
+    });
 }
 
 } // namespace multicut
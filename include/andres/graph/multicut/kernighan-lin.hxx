@@ -7,8 +7,10 @@
 #include <stdexcept>
 #include <set>
 #include <vector>
+#include <limits>
 
 #include "../complete-graph.hxx"
+#include "../for-each.hxx"
 
 
 
@@ -79,18 +81,18 @@ auto kernighanLin(const GRAPH& graph, const ECA& edge_costs, const VERTEXLABELS&
                 double diffInt = .0;
                 size_t ref_cnt = 0;
 
-                for (auto it = graph.adjacenciesFromVertexBegin(A[i]); it != graph.adjacenciesFromVertexEnd(A[i]); ++it)
+                forEachAdjacency(graph, A[i], [&](const typename GRAPH::AdjacencyType& a)
                 {
-                    const auto lbl = buffer.vertex_labels[it->vertex()];
+                    const auto lbl = buffer.vertex_labels[a.vertex()];
 
                     if (lbl == label_A)
-                        diffInt += edge_costs[it->edge()];
+                        diffInt += edge_costs[a.edge()];
                     else if (lbl == label_B)
                     {
-                        diffExt += edge_costs[it->edge()];
+                        diffExt += edge_costs[a.edge()];
                         ++ref_cnt;
                     }
-                }
+                });
 
                 buffer.differences[A[i]] = diffExt - diffInt;
                 buffer.referenced_by[A[i]] = ref_cnt;
@@ -170,29 +172,29 @@ auto kernighanLin(const GRAPH& graph, const ECA& edge_costs, const VERTEXLABELS&
                 m.new_label = label_A;
 
             // update differences and references
-            for (auto it = graph.adjacenciesFromVertexBegin(m.v); it != graph.adjacenciesFromVertexEnd(m.v); ++it)
+            forEachAdjacency(graph, m.v, [&](const typename GRAPH::AdjacencyType& a)
             {
-                if (buffer.is_moved[it->vertex()])
-                    continue;
+                if (buffer.is_moved[a.vertex()])
+                    return;
 
-                const auto lbl = buffer.vertex_labels[it->vertex()];
+                const auto lbl = buffer.vertex_labels[a.vertex()];
                 // edge to an element of the new set
                 if (lbl == m.new_label)
                 {
-                    buffer.differences[it->vertex()] -= 2.0*edge_costs[it->edge()];
-                    --buffer.referenced_by[it->vertex()];
+                    buffer.differences[a.vertex()] -= 2.0*edge_costs[a.edge()];
+                    --buffer.referenced_by[a.vertex()];
 
                 }
                 // edge to an element of the old set
                 else if (lbl == old_label)
                 {
-                    buffer.differences[it->vertex()] += 2.0*edge_costs[it->edge()];
-                    ++buffer.referenced_by[it->vertex()];
+                    buffer.differences[a.vertex()] += 2.0*edge_costs[a.edge()];
+                    ++buffer.referenced_by[a.vertex()];
 
-                    if (buffer.referenced_by[it->vertex()] == 1)
-                        buffer.border.push_back(it->vertex());
+                    if (buffer.referenced_by[a.vertex()] == 1)
+                        buffer.border.push_back(a.vertex());
                 }
-            }
+            });
 
             buffer.vertex_labels[m.v] = m.new_label;
             buffer.referenced_by[m.v] = 0;
@@ -261,14 +263,11 @@ auto kernighanLin(const GRAPH& graph, const ECA& edge_costs, const VERTEXLABELS&
     double starting_energy = .0;
 
     // check if the input multicut labeling is valid
-    for(size_t edge = 0; edge < graph.numberOfEdges(); ++edge)
+    forEachEdge(graph, [&](size_t edge, size_t v0, size_t v1)
     {
-        auto v0 = graph.vertexOfEdge(edge, 0);
-        auto v1 = graph.vertexOfEdge(edge, 1);
-
         if (input_vertex_labels[v0] != input_vertex_labels[v1])
             starting_energy += edge_costs[edge];
-    }
+    });
 
     auto numberOfComponents = *std::max_element(input_vertex_labels.begin(), input_vertex_labels.end()) + 1;
 
@@ -303,14 +302,14 @@ auto kernighanLin(const GRAPH& graph, const ECA& edge_costs, const VERTEXLABELS&
         auto energy_decrease = .0;
 
         std::vector<std::set<size_t>> edges(numberOfComponents);
-        for (size_t e = 0; e < graph.numberOfEdges(); ++e)
+        forEachEdge(graph, [&](size_t e, size_t w0, size_t w1)
         {
-            auto const v0 = buffer.vertex_labels[graph.vertexOfEdge(e, 0)];
-            auto const v1 = buffer.vertex_labels[graph.vertexOfEdge(e, 1)];
+            auto const v0 = buffer.vertex_labels[w0];
+            auto const v1 = buffer.vertex_labels[w1];
 
             if (v0 != v1)
                 edges[std::min(v0, v1)].insert(std::max(v0, v1));
-        }
+        });
 
         for (size_t i = 0; i < numberOfComponents; ++i)
             if (!partitions[i].empty())
@@ -402,16 +401,13 @@ auto kernighanLin(const GRAPH& graph, const ECA& edge_costs, const VERTEXLABELS&
         buffer.max_not_used_label = numberOfComponents;
 
         bool didnt_change = true;
-        for (size_t i = 0; i < graph.numberOfEdges(); ++i)
+        forEachEdge(graph, [&](size_t i, size_t v0, size_t v1)
         {
-            auto const v0 = graph.vertexOfEdge(i, 0);
-            auto const v1 = graph.vertexOfEdge(i, 1);
-
             auto edge_label = buffer.vertex_labels[v0] == buffer.vertex_labels[v1] ? 0 : 1;
 
             if (static_cast<bool>(edge_label) != (last_good_vertex_labels[v0] != last_good_vertex_labels[v1]))
                 didnt_change = false;
-        }
+        });
 
         if (didnt_change)
             break;
@@ -636,14 +632,11 @@ auto kernighanLin(const CompleteGraph<GraphVisitor>& graph, const ECA& edge_cost
     double starting_energy = .0;
 
     // check if the input multicut labeling is valid
-    for(size_t edge = 0; edge < graph.numberOfEdges(); ++edge)
+    graph.forEachEdge([&](size_t edge, size_t v0, size_t v1)
     {
-        auto v0 = graph.vertexOfEdge(edge, 0);
-        auto v1 = graph.vertexOfEdge(edge, 1);
-
         if (input_vertex_labels[v0] != input_vertex_labels[v1])
             starting_energy += edge_costs[edge];
-    }
+    });
 
     auto numberOfComponents = *std::max_element(input_vertex_labels.begin(), input_vertex_labels.end()) + 1;
 
@@ -754,13 +747,10 @@ void kernighanLin(const GRAPH& graph, const ECA& edge_costs, const ELA& input_ed
 
     vertex_labels = kernighanLin(graph, edge_costs, vertex_labels, visitor, settings);
 
-    for (size_t e = 0; e < graph.numberOfEdges(); ++e)
+    forEachEdge(graph, [&](size_t e, size_t v0, size_t v1)
     {
-        auto const v0 = graph.vertexOfEdge(e, 0);
-        auto const v1 = graph.vertexOfEdge(e, 1);
-
         output_edge_labels[e] = (vertex_labels[v0] != vertex_labels[v1]) ? 1 : 0;
-    }
+    });
 }
 
 template<typename GraphVisitor, typename ECA, typename ELA>
@@ -812,13 +802,10 @@ void kernighanLin(const CompleteGraph<GraphVisitor>& graph, const ECA& edge_cost
 
     vertex_labels = kernighanLin(graph, edge_costs, vertex_labels, visitor, settings);
 
-    for (size_t e = 0; e < graph.numberOfEdges(); ++e)
+    graph.forEachEdge([&](size_t e, size_t v0, size_t v1)
     {
-        auto const v0 = graph.vertexOfEdge(e, 0);
-        auto const v1 = graph.vertexOfEdge(e, 1);
-
         output_edge_labels[e] = (vertex_labels[v0] != vertex_labels[v1]) ? 1 : 0;
-    }
+    });
 }
 
 } // of multicut
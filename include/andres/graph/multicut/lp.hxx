@@ -5,8 +5,11 @@
 #include <vector>
 #include <deque>
 #include <algorithm>
+#include <limits>
 
 #include <andres/graph/shortest-paths.hxx>
+#include <andres/graph/search-workspace.hxx>
+#include <andres/graph/edge-index.hxx>
 
 
 namespace andres {
@@ -45,12 +48,10 @@ std::vector<double> lp(CompleteGraph<VISITOR> const& graph, ECA const& edgeCosts
             vars[i] = std::min(std::max(.0, lp.variableValue(i)), 1.0);
 
         size_t nTriangle = 0;
-        for (size_t edge = 0; edge < graph.numberOfEdges(); ++edge) 
+        graph.forEachEdge([&](size_t edge, size_t v0, size_t v1)
+        {
             if (vars[edge] > 0)
             {
-                auto const v0 = graph.vertexOfEdge(edge, 0);
-                auto const v1 = graph.vertexOfEdge(edge, 1);
-
                 for (size_t v = 0; v < graph.numberOfVertices(); ++v)
                 {
                     if (v == v0 || v == v1)
@@ -75,6 +76,7 @@ std::vector<double> lp(CompleteGraph<VISITOR> const& graph, ECA const& edgeCosts
                     }
                 }
             }
+        });
 
         std::cout << "Triangles added: " << nTriangle << std::endl;
 
@@ -120,11 +122,11 @@ std::vector<double> lp(GRAPH const& graph, ECA const& edgeCosts, VIS& visitor, s
     LP lp;
 
     std::vector<double> coefficients(graph.numberOfEdges());
-    std::vector<double> distances(graph.numberOfVertices());
-    std::vector<size_t> parents(graph.numberOfVertices());
+    SearchWorkspace<double> workspace(graph);
     std::deque<size_t> path;
     std::vector<size_t> variables(graph.numberOfEdges());
     std::vector<double> vars(graph.numberOfEdges());
+    EdgeIndex<GRAPH> edge_index(graph);
 
     auto addCycleInequalities = [&] ()
     {
@@ -142,7 +144,7 @@ std::vector<double> lp(GRAPH const& graph, ECA const& edgeCosts, VIS& visitor, s
 
             // search for shortest path
             double distance;
-            spsp(graph, DefaultSubgraphMask<>(), v0, v1, vars.begin(), path, distance, distances.begin(), parents.begin());
+            spsp(graph, DefaultSubgraphMask<>(), v0, v1, vars.begin(), path, distance, workspace);
 
             bool chordless = true;
             for (auto it1 = path.begin(); it1 != path.end() - 2 && chordless; ++it1)
@@ -151,8 +153,8 @@ std::vector<double> lp(GRAPH const& graph, ECA const& edgeCosts, VIS& visitor, s
                     if (it1 == path.begin() && it2 == path.end() - 1)
                         continue;
 
-                    auto const e = graph.findEdge(*it1, *it2);
-                    if (e.first && std::min(std::max(.0, lp.variableValue(e.second)), 1.0) > distances[*it2] - distances[*it1] + tolerance)
+                    auto const e = edge_index.findEdge(*it1, *it2);
+                    if (e.first && std::min(std::max(.0, lp.variableValue(e.second)), 1.0) > workspace.distance(*it2) - workspace.distance(*it1) + tolerance)
                     {
                         chordless = false;
                         break;
@@ -168,7 +170,7 @@ std::vector<double> lp(GRAPH const& graph, ECA const& edgeCosts, VIS& visitor, s
                 for (size_t j = 0; j < path.size() - 1; ++j)
                 {
                     coefficients[j] = 1.0;
-                    variables[j] = graph.findEdge(path[j], path[j + 1]).second;
+                    variables[j] = edge_index.findEdge(path[j], path[j + 1]).second;
                 }
 
                 coefficients[path.size() - 1] = -1.0;
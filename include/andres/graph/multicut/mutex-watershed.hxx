@@ -6,6 +6,7 @@
 #include <cmath>
 
 #include "andres/partition.hxx"
+#include "../for-each.hxx"
 
 namespace andres {
 namespace graph {
@@ -84,8 +85,10 @@ void mutexWatershed(GRAPH const& graph, ECA const& edge_costs, ELA& output_label
     }
 
     // determine output labels
-    for (size_t e = 0; e < graph.numberOfEdges(); e++)
-        output_labels[e] = partition.find(graph.vertexOfEdge(e, 0)) != partition.find(graph.vertexOfEdge(e, 1));
+    forEachEdge(graph, [&](size_t e, size_t u, size_t v)
+    {
+        output_labels[e] = partition.find(u) != partition.find(v);
+    });
 }
 
 } // namespace multicut
@@ -3,9 +3,11 @@
 #define ANDRES_GRAPH_MULTICUT_PREPROCESSING_HXX
 
 #include <cmath>
+#include <limits>
 
 #include "andres/graph/components.hxx"
-#include "andres/graph/bridges.hxx"
+#include "andres/graph/biconnected-components.hxx"
+#include "andres/graph/edge-index.hxx"
 
 namespace andres {
 namespace graph {
@@ -15,19 +17,26 @@ namespace multicut {
 // Edge contraction operation by masking
 // First vertex of given node pair stays in the graph, the other one is removed (masked)
 // Flags affected vertices in optional flag pointer
+// Looks up edges in the optional edge index, which is kept up to date with inserted edges
 void contract(andres::graph::Graph<> & graph, std::vector<double> & edge_costs, 
     std::vector<char> & emask, std::vector<char> & vmask, std::vector<size_t> pair,
-    std::vector<std::pair<std::pair<size_t,size_t>, char>> & constr, std::vector<char> * flag = NULL)
+    std::vector<std::pair<std::pair<size_t,size_t>, char>> & constr, std::vector<char> * flag = NULL,
+    EdgeIndex<andres::graph::Graph<>> * edge_index = NULL)
 {
     double const tolerance = std::numeric_limits<double>::epsilon();
+    auto findEdge = [&] (size_t v0, size_t v1)
+    {
+        return edge_index ? edge_index->findEdge(v0, v1) : graph.findEdge(v0, v1);
+    };
     auto u = pair[0];
     auto v = pair[1];
-    if (!graph.findEdge(u,v).first)
+    auto const uv = findEdge(u, v);
+    if (!uv.first)
     {
         std::cout << "ERROR (edge contraction): Given pair of vertices is not an edge." << std::endl;
         return;
     }
-    auto edge = graph.findEdge(u, v).second;
+    auto edge = uv.second;
     if (emask[edge])
     {
         std::cout << "ERROR (edge contraction): Given edge is masked." << std::endl;
@@ -51,9 +60,10 @@ void contract(andres::graph::Graph<> & graph, std::vector<double> & edge_costs,
         if (flag)
             flag->at(w) = 1;
         size_t f;
-        if (graph.findEdge(u,w).first)
+        auto const uw = findEdge(u, w);
+        if (uw.first)
         {
-            f = graph.findEdge(u,w).second;
+            f = uw.second;
             // make sure edge is not masked
             if (emask[f])
             {
@@ -64,6 +74,8 @@ void contract(andres::graph::Graph<> & graph, std::vector<double> & edge_costs,
         else
         {
             f = graph.insertEdge(u,w);
+            if (edge_index)
+                edge_index->insertEdge(u, w, f);
             edge_costs.push_back(0.0);
             emask.push_back(0);
         }
@@ -74,6 +86,22 @@ void contract(andres::graph::Graph<> & graph, std::vector<double> & edge_costs,
 }
 
 
+// Erase isolated vertices in a single pass, keeping the map to original vertices in sync
+inline void eraseIsolatedVertices(andres::graph::Graph<> & graph, std::vector<size_t> & vorig)
+{
+    std::vector<char> isolated(graph.numberOfVertices());
+    size_t n = 0;
+    for (size_t v = 0; v < graph.numberOfVertices(); v++)
+    {
+        isolated[v] = (graph.numberOfEdgesFromVertex(v) == 0);
+        if (!isolated[v])
+            vorig[n++] = vorig[v];
+    }
+    vorig.resize(n);
+    graph.eraseVertices(isolated);
+}
+
+
 // Create reduced graph that omits removed edges/vertices
 void createReducedGraph(andres::graph::Graph<> & graph, std::vector<double> & edge_costs,
  std::vector<char> & emask, std::vector<char> & vmask, std::vector<size_t> & vorig)
@@ -113,18 +141,11 @@ void createReducedGraph(andres::graph::Graph<> & graph, std::vector<double> & ed
         // perform checks
         assert(v0 < graph_reduced.numberOfVertices());
         assert(v1 < graph_reduced.numberOfVertices());
-        assert(e_new == graph_reduced.size()-1);
+        assert(e_new == graph_reduced.numberOfEdges()-1);
     }
 
     // delete isolated vertices
-    for (size_t v = 0; v < graph_reduced.numberOfVertices(); v++)
-        if (graph_reduced.numberOfEdgesFromVertex(v) == 0)
-        {
-            vorig_reduced[v] = vorig_reduced[vorig_reduced.size()-1];
-            vorig_reduced.pop_back(); 
-            graph_reduced.eraseVertex(v);
-            v--;
-        }
+    eraseIsolatedVertices(graph_reduced, vorig_reduced);
 
     // set return values
     graph = graph_reduced;
@@ -195,14 +216,7 @@ double extractIsolatedComponents(andres::graph::Graph<> & graph, std::vector<dou
     }
 
     // delete isolated vertices
-    for (size_t v = 0; v < graph_reduced.numberOfVertices(); v++)
-        if (graph_reduced.numberOfEdgesFromVertex(v) == 0)
-        {
-            vorig[v] = vorig[vorig.size()-1];
-            vorig.pop_back();
-            graph_reduced.eraseVertex(v);
-            v--;
-        }
+    eraseIsolatedVertices(graph_reduced, vorig);
 
     // set return values
     graph = graph_reduced;
@@ -213,12 +227,15 @@ double extractIsolatedComponents(andres::graph::Graph<> & graph, std::vector<dou
 
 
 // Remove all bridges from the graph.
+// Uses the buffers of the optional biconnected components, e.g. across repeated calls
 double removeBridges(andres::graph::Graph<> & graph, std::vector<double> & edge_costs,
-    std::vector<std::pair<std::pair<size_t,size_t>, char>> & constr, std::vector<size_t> & vorig)
+    std::vector<std::pair<std::pair<size_t,size_t>, char>> & constr, std::vector<size_t> & vorig,
+    BiconnectedComponents<andres::graph::Graph<>> * biconnected_components = NULL)
 {
-    std::vector<char> is_bridge(graph.numberOfEdges());
+    BiconnectedComponents<andres::graph::Graph<>> own_biconnected_components;
+    auto & components = biconnected_components ? *biconnected_components : own_biconnected_components;
+    components.build(graph);
     double cost_offset = 0;
-    findBridges(graph, is_bridge);
     
     // create reduced graph
     andres::graph::Graph<> graph_reduced;
@@ -235,7 +252,7 @@ double removeBridges(andres::graph::Graph<> & graph, std::vector<double> & edge_
         auto u = graph.vertexOfEdge(e, 0);
         auto v = graph.vertexOfEdge(e, 1);
 
-        if (is_bridge[e])
+        if (components.isBridge(e))
         {
             if (edge_costs[e] < 0)
             {
@@ -253,14 +270,7 @@ double removeBridges(andres::graph::Graph<> & graph, std::vector<double> & edge_
     }
 
     // delete isolated vertices
-    for (size_t v = 0; v < graph_reduced.numberOfVertices(); v++)
-        if (graph_reduced.numberOfEdgesFromVertex(v) == 0)
-        {
-            vorig[v] = vorig[vorig.size()-1];
-            vorig.pop_back();
-            graph_reduced.eraseVertex(v);
-            v--;
-        }
+    eraseIsolatedVertices(graph_reduced, vorig);
 
     // set return values
     graph = graph_reduced;
@@ -270,6 +280,60 @@ double removeBridges(andres::graph::Graph<> & graph, std::vector<double> & edge_
 }
 
 
+// Split the graph into its blocks (biconnected components). Every cycle lies in a
+// single block, so a multicut of the graph is the union of multicuts of its blocks,
+// and the blocks can be solved independently.
+// For each block, outputs the subgraph of its edges, their costs in the same order
+// and, for each vertex of the block, the entry of vorig of the vertex.
+// Uses the buffers of the biconnected components, e.g. across repeated calls
+// Returns the number of blocks
+inline size_t splitIntoBlocks(andres::graph::Graph<> const& graph, std::vector<double> const& edge_costs,
+    std::vector<size_t> const& vorig, std::vector<andres::graph::Graph<>> & block_graphs,
+    std::vector<std::vector<double>> & block_edge_costs, std::vector<std::vector<size_t>> & block_vorig,
+    BiconnectedComponents<andres::graph::Graph<>> & components)
+{
+    auto const number_of_blocks = components.build(graph);
+    block_graphs.resize(number_of_blocks);
+    block_edge_costs.resize(number_of_blocks);
+    block_vorig.resize(number_of_blocks);
+
+    // vertex of the current block, valid if the block was the last to see the vertex
+    std::vector<size_t> block_vertex(graph.numberOfVertices());
+    std::vector<size_t> last_block(graph.numberOfVertices(), std::numeric_limits<size_t>::max());
+    std::vector<std::pair<size_t, size_t>> edges;
+
+    for (size_t b = 0; b < number_of_blocks; b++)
+    {
+        block_edge_costs[b].clear();
+        block_vorig[b].clear();
+        edges.clear();
+        for (auto it = components.edgesOfBlockBegin(b); it != components.edgesOfBlockEnd(b); it++)
+        {
+            size_t ends[2];
+            for (size_t j = 0; j < 2; j++)
+            {
+                auto const v = graph.vertexOfEdge(*it, j);
+                if (last_block[v] != b)
+                {
+                    last_block[v] = b;
+                    block_vertex[v] = block_vorig[b].size();
+                    block_vorig[b].push_back(vorig[v]);
+                }
+                ends[j] = block_vertex[v];
+            }
+            edges.emplace_back(ends[0], ends[1]);
+            block_edge_costs[b].push_back(edge_costs[*it]);
+        }
+
+        block_graphs[b].assign(block_vorig[b].size());
+        block_graphs[b].insertEdges(edges.begin(), edges.end());
+        assert(block_graphs[b].numberOfEdges() == block_edge_costs[b].size());
+    }
+
+    return number_of_blocks;
+}
+
+
 // Repeatedly check single node cuts for dominant edges
 double checkSingleNodeCuts(andres::graph::Graph<> & graph, std::vector<double> & edge_costs,
     std::vector<std::pair<std::pair<size_t,size_t>, char>> & constr, std::vector<size_t> & vorig)
@@ -280,6 +344,7 @@ double checkSingleNodeCuts(andres::graph::Graph<> & graph, std::vector<double> &
     bool repeat = true;
 
     std::vector<char> flag(graph.numberOfVertices(), 1);
+    EdgeIndex<andres::graph::Graph<>> edge_index(graph);
 
     while (repeat)
     {
@@ -356,7 +421,7 @@ double checkSingleNodeCuts(andres::graph::Graph<> & graph, std::vector<double> &
                         cost_offset += edge_costs[min_edge] + edge_costs[max_edge];
                         edge_costs[min_edge] = -edge_costs[min_edge];
                         edge_costs[max_edge] = -edge_costs[max_edge];
-                        contract(graph, edge_costs, emask, vmask, std::vector<size_t>{u, v}, constr, &flag);
+                        contract(graph, edge_costs, emask, vmask, std::vector<size_t>{u, v}, constr, &flag, &edge_index);
                         repeat = true;
                         constr.emplace_back(std::make_pair(vorig[u],vorig[v]), 1);
                     }
@@ -386,7 +451,7 @@ double checkSingleNodeCuts(andres::graph::Graph<> & graph, std::vector<double> &
             // check if attractive edge is dominant
             else if (edge_costs[max_edge] > 0 && max_abs_cost >= sum_pos_costs - sum_neg_costs - max_abs_cost)
             {
-                contract(graph, edge_costs, emask, vmask, std::vector<size_t>{u, v}, constr, &flag);
+                contract(graph, edge_costs, emask, vmask, std::vector<size_t>{u, v}, constr, &flag, &edge_index);
                 repeat = true;
                 constr.emplace_back(std::make_pair(vorig[u],vorig[v]), 0);
             }
@@ -430,11 +495,11 @@ preprocessing(GRAPH const& graph_orig, ECA const& edgeCosts, size_t timeLimitSec
     andres::graph::Graph<> graph;
     graph.insertVertices(graph_orig.numberOfVertices());
     graph.reserveEdges(graph_orig.numberOfEdges());
-    for (size_t e = 0; e < graph_orig.numberOfEdges(); e++)
     {
-        auto v0 = graph_orig.vertexOfEdge(e, 0);
-        auto v1 = graph_orig.vertexOfEdge(e, 1);
-        graph.insertEdge(v0,v1);
+        std::vector<std::pair<size_t, size_t>> edges(graph_orig.numberOfEdges());
+        for (size_t e = 0; e < graph_orig.numberOfEdges(); e++)
+            edges[e] = std::make_pair(graph_orig.vertexOfEdge(e, 0), graph_orig.vertexOfEdge(e, 1));
+        graph.insertEdges(edges.begin(), edges.end());
     }
     // copy edge costs
     std::vector<double> edge_costs(edgeCosts);
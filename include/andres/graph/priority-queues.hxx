@@ -0,0 +1,49 @@
+#pragma once
+#ifndef ANDRES_GRAPH_PRIORITY_QUEUES_HXX
+#define ANDRES_GRAPH_PRIORITY_QUEUES_HXX
+
+#include "indexed-heap.hxx"
+#include "bucket-queue.hxx"
+#include "radix-heap.hxx"
+
+namespace andres {
+namespace graph {
+
+/// Tag selecting IndexedHeap as the queue of Dijkstra's algorithm.
+struct IndexedHeapTag {};
+
+/// Tag selecting BucketQueue (Dial's algorithm) as the queue of Dijkstra's
+/// algorithm, for small integral edge weights. Keys must be monotone.
+struct BucketQueueTag {};
+
+/// Tag selecting RadixHeap as the queue of Dijkstra's algorithm, for
+/// integral edge weights. Keys must be monotone.
+struct RadixHeapTag {};
+
+/// Type of the priority queue selected by a tag for distances of a type.
+///
+/// All queues have the same interface, that of IndexedHeap, except that
+/// BucketQueue and RadixHeap are monotone.
+///
+template<class QUEUE_TAG, class VALUE>
+struct PriorityQueueType;
+
+template<class VALUE>
+struct PriorityQueueType<IndexedHeapTag, VALUE> {
+    typedef IndexedHeap<VALUE> type;
+};
+
+template<class VALUE>
+struct PriorityQueueType<BucketQueueTag, VALUE> {
+    typedef BucketQueue<VALUE> type;
+};
+
+template<class VALUE>
+struct PriorityQueueType<RadixHeapTag, VALUE> {
+    typedef RadixHeap<VALUE> type;
+};
+
+} // namespace graph
+} // namespace andres
+
+#endif // #ifndef ANDRES_GRAPH_PRIORITY_QUEUES_HXX
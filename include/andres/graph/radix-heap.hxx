@@ -0,0 +1,362 @@
+#pragma once
+#ifndef ANDRES_GRAPH_RADIX_HEAP_HXX
+#define ANDRES_GRAPH_RADIX_HEAP_HXX
+
+#include <cassert>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+namespace andres {
+namespace graph {
+
+/// Monotone priority queue of integer items with integral keys.
+///
+/// Ahuja R. K., Mehlhorn K., Orlin J. B. and Tarjan R. E. (1990). Faster
+/// algorithms for the shortest path problem. Journal of the ACM
+/// 37(2):213-223.
+///
+/// Items are kept in one bucket per bit of the key type. An item is in
+/// bucket 0 if its key equals the last key that has been at the top and
+/// otherwise in bucket i > 0 if the most significant bit in which the two
+/// keys differ is bit i-1. Whenever bucket 0 runs empty, the items of the
+/// first non-empty bucket are distributed to buckets of lower index. Each
+/// item thus moves at most once per bit.
+///
+/// The queue is monotone: No key may be smaller than the last key returned
+/// by top() or topKey() or, before the first such call after construction
+/// or clear(), than the first key pushed. Therefore, and because they
+/// reorganize the buckets, top() and topKey() are not const.
+///
+/// Runtime complexity O(1) for push and decreaseKey and amortized
+/// O(log C) for pop, where C is the largest difference between keys
+/// contained at the same time, independent of the number of items.
+///
+/// \tparam VALUE Integral type of keys.
+///
+template<class VALUE>
+class RadixHeap {
+public:
+    typedef VALUE Value;
+
+    static const std::size_t NOT_IN_QUEUE;
+
+    RadixHeap(const std::size_t = 0);
+    void resize(const std::size_t);
+    void clear();
+    bool empty() const
+        { return size_ == 0; }
+    std::size_t size() const
+        { return size_; }
+    std::size_t numberOfItems() const
+        { return keys_.size(); }
+    bool contains(const std::size_t item) const
+        { return previous_[item] != NOT_IN_QUEUE; }
+    std::size_t top();
+    Value topKey();
+    Value key(const std::size_t) const;
+    void push(const std::size_t, const Value);
+    void decreaseKey(const std::size_t, const Value);
+    bool pushOrDecreaseKey(const std::size_t, const Value);
+    void pop();
+
+private:
+    typedef typename std::make_unsigned<Value>::type Bits;
+
+    static const std::size_t NUMBER_OF_BUCKETS = std::numeric_limits<Bits>::digits + 1;
+    static const std::size_t HEAD; // previous_ of the first item in a bucket
+
+    static Bits bits(const Value);
+    std::size_t bucketIndex(const Value) const;
+    void link(const std::size_t, const std::size_t);
+    void unlink(const std::size_t);
+    void redistribute();
+
+    std::vector<Value> keys_;
+    std::vector<std::size_t> next_; // in the same bucket
+    std::vector<std::size_t> previous_; // in the same bucket
+    std::vector<unsigned char> bucketIndices_;
+    std::size_t buckets_[NUMBER_OF_BUCKETS]; // first item
+    std::size_t size_;
+    bool started_; // last_ is set
+    Value last_; // no key is smaller
+};
+
+template<class VALUE>
+const std::size_t RadixHeap<VALUE>::NOT_IN_QUEUE = std::numeric_limits<std::size_t>::max();
+
+template<class VALUE>
+const std::size_t RadixHeap<VALUE>::HEAD = std::numeric_limits<std::size_t>::max() - 1;
+
+/// Construct an empty queue.
+///
+/// \param numberOfItems Number of items that can be pushed.
+///
+template<class VALUE>
+inline
+RadixHeap<VALUE>::RadixHeap(
+    const std::size_t numberOfItems
+)
+:   keys_(numberOfItems),
+    next_(numberOfItems),
+    previous_(numberOfItems, NOT_IN_QUEUE),
+    bucketIndices_(numberOfItems),
+    size_(0),
+    started_(false),
+    last_()
+{
+    static_assert(std::is_integral<VALUE>::value, "RadixHeap requires integral keys.");
+    for(std::size_t j = 0; j < NUMBER_OF_BUCKETS; ++j) {
+        buckets_[j] = NOT_IN_QUEUE;
+    }
+}
+
+/// Set the number of items that can be pushed.
+///
+/// Items that are dropped must not be contained in the queue.
+///
+/// \param numberOfItems Number of items.
+///
+template<class VALUE>
+inline void
+RadixHeap<VALUE>::resize(
+    const std::size_t numberOfItems
+) {
+    keys_.resize(numberOfItems);
+    next_.resize(numberOfItems);
+    previous_.resize(numberOfItems, NOT_IN_QUEUE);
+    bucketIndices_.resize(numberOfItems);
+}
+
+/// Remove all items and forget the last key at the top.
+///
+/// Runtime complexity O(size()).
+///
+template<class VALUE>
+inline void
+RadixHeap<VALUE>::clear() {
+    if(size_ != 0) {
+        for(std::size_t j = 0; j < NUMBER_OF_BUCKETS; ++j) {
+            for(std::size_t item = buckets_[j]; item != NOT_IN_QUEUE; item = next_[item]) {
+                previous_[item] = NOT_IN_QUEUE;
+            }
+            buckets_[j] = NOT_IN_QUEUE;
+        }
+        size_ = 0;
+    }
+    started_ = false;
+}
+
+/// Get an item of smallest key.
+///
+template<class VALUE>
+inline std::size_t
+RadixHeap<VALUE>::top() {
+    assert(!empty());
+    if(buckets_[0] == NOT_IN_QUEUE) {
+        redistribute();
+    }
+    return buckets_[0];
+}
+
+/// Get the smallest key.
+///
+template<class VALUE>
+inline typename RadixHeap<VALUE>::Value
+RadixHeap<VALUE>::topKey() {
+    assert(!empty());
+    if(buckets_[0] == NOT_IN_QUEUE) {
+        redistribute();
+    }
+    return last_;
+}
+
+/// Get the key of a contained item.
+///
+/// \param item Item.
+///
+template<class VALUE>
+inline typename RadixHeap<VALUE>::Value
+RadixHeap<VALUE>::key(
+    const std::size_t item
+) const {
+    assert(contains(item));
+    return keys_[item];
+}
+
+/// Insert an item that is not contained in the queue.
+///
+/// \param item Item.
+/// \param key Key not smaller than the last key at the top.
+///
+template<class VALUE>
+inline void
+RadixHeap<VALUE>::push(
+    const std::size_t item,
+    const Value key
+) {
+    assert(item < numberOfItems());
+    assert(!contains(item));
+    if(!started_) {
+        last_ = key;
+        started_ = true;
+    }
+    assert(!(key < last_));
+    keys_[item] = key;
+    link(item, bucketIndex(key));
+    ++size_;
+}
+
+/// Decrease the key of a contained item.
+///
+/// \param item Item.
+/// \param key Key not greater than the current key of the item and not
+///     smaller than the last key at the top.
+///
+template<class VALUE>
+inline void
+RadixHeap<VALUE>::decreaseKey(
+    const std::size_t item,
+    const Value key
+) {
+    assert(contains(item));
+    assert(!(keys_[item] < key));
+    assert(!(key < last_));
+    keys_[item] = key;
+    const std::size_t j = bucketIndex(key);
+    if(j != bucketIndices_[item]) {
+        unlink(item);
+        link(item, j);
+    }
+}
+
+/// Insert an item or, if it is contained, decrease its key.
+///
+/// \param item Item.
+/// \param key Key.
+/// \return false if the item is contained with a key that is not greater.
+///
+template<class VALUE>
+inline bool
+RadixHeap<VALUE>::pushOrDecreaseKey(
+    const std::size_t item,
+    const Value key
+) {
+    if(!contains(item)) {
+        push(item, key);
+        return true;
+    }
+    else if(key < keys_[item]) {
+        decreaseKey(item, key);
+        return true;
+    }
+    else {
+        return false;
+    }
+}
+
+/// Remove an item of smallest key.
+///
+template<class VALUE>
+inline void
+RadixHeap<VALUE>::pop() {
+    unlink(top());
+    --size_;
+}
+
+// order-preserving map of keys to unsigned integers
+template<class VALUE>
+inline typename RadixHeap<VALUE>::Bits
+RadixHeap<VALUE>::bits(
+    const Value key
+) {
+    return std::numeric_limits<Value>::is_signed
+        ? static_cast<Bits>(key) ^ (static_cast<Bits>(1) << (std::numeric_limits<Bits>::digits - 1))
+        : static_cast<Bits>(key);
+}
+
+// 0 if the key equals last_, otherwise 1 + the index of the most
+// significant bit in which the key differs from last_
+template<class VALUE>
+inline std::size_t
+RadixHeap<VALUE>::bucketIndex(
+    const Value key
+) const {
+    Bits difference = bits(key) ^ bits(last_);
+#if defined(__GNUC__)
+    return difference == 0 ? 0 : static_cast<std::size_t>(
+        std::numeric_limits<unsigned long long>::digits - __builtin_clzll(static_cast<unsigned long long>(difference))
+    );
+#else
+    std::size_t j = 0;
+    while(difference != 0) {
+        difference >>= 1;
+        ++j;
+    }
+    return j;
+#endif
+}
+
+template<class VALUE>
+inline void
+RadixHeap<VALUE>::link(
+    const std::size_t item,
+    const std::size_t j
+) {
+    bucketIndices_[item] = static_cast<unsigned char>(j);
+    next_[item] = buckets_[j];
+    previous_[item] = HEAD;
+    if(buckets_[j] != NOT_IN_QUEUE) {
+        previous_[buckets_[j]] = item;
+    }
+    buckets_[j] = item;
+}
+
+template<class VALUE>
+inline void
+RadixHeap<VALUE>::unlink(
+    const std::size_t item
+) {
+    if(previous_[item] == HEAD) {
+        buckets_[bucketIndices_[item]] = next_[item];
+    }
+    else {
+        next_[previous_[item]] = next_[item];
+    }
+    if(next_[item] != NOT_IN_QUEUE) {
+        previous_[next_[item]] = previous_[item];
+    }
+    previous_[item] = NOT_IN_QUEUE;
+}
+
+// make the smallest key in the first non-empty bucket the new last_ and
+// distribute the items of this bucket, all of which now fall into buckets
+// of lower index
+template<class VALUE>
+inline void
+RadixHeap<VALUE>::redistribute() {
+    std::size_t j = 1;
+    while(buckets_[j] == NOT_IN_QUEUE) {
+        ++j;
+    }
+    std::size_t item = buckets_[j];
+    last_ = keys_[item];
+    for(item = next_[item]; item != NOT_IN_QUEUE; item = next_[item]) {
+        if(keys_[item] < last_) {
+            last_ = keys_[item];
+        }
+    }
+    item = buckets_[j];
+    buckets_[j] = NOT_IN_QUEUE;
+    while(item != NOT_IN_QUEUE) {
+        const std::size_t next = next_[item];
+        link(item, bucketIndex(keys_[item]));
+        item = next;
+    }
+}
+
+} // namespace graph
+} // namespace andres
+
+#endif // #ifndef ANDRES_GRAPH_RADIX_HEAP_HXX
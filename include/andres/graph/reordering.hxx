@@ -0,0 +1,481 @@
+#pragma once
+#ifndef ANDRES_GRAPH_REORDERING_HXX
+#define ANDRES_GRAPH_REORDERING_HXX
+
+#include <cassert>
+#include <cstddef>
+#include <algorithm> // std::sort, std::stable_sort, std::reverse
+#include <iterator> // std::distance
+#include <stdexcept>
+#include <utility> // std::pair
+#include <vector>
+
+#include "for-each.hxx"
+
+namespace andres {
+namespace graph {
+
+/// Maps between the integer indices of vertices and edges of a graph and
+/// those of a reordered copy of the graph.
+///
+/// A reordering is built by reorder(). Its helpers copy values associated
+/// with vertices or edges, e.g. edge costs and vertex labels, from one
+/// numbering to the other.
+///
+class Reordering {
+public:
+    Reordering();
+    std::size_t numberOfVertices() const;
+    std::size_t numberOfEdges() const;
+    std::size_t newVertex(const std::size_t) const;
+    std::size_t oldVertex(const std::size_t) const;
+    std::size_t newEdge(const std::size_t) const;
+    std::size_t oldEdge(const std::size_t) const;
+
+    template<class INPUT_ITERATOR, class OUTPUT_ITERATOR>
+        void permuteVertexValues(INPUT_ITERATOR, OUTPUT_ITERATOR) const;
+    template<class INPUT_ITERATOR, class OUTPUT_ITERATOR>
+        void restoreVertexValues(INPUT_ITERATOR, OUTPUT_ITERATOR) const;
+    template<class INPUT_ITERATOR, class OUTPUT_ITERATOR>
+        void permuteEdgeValues(INPUT_ITERATOR, OUTPUT_ITERATOR) const;
+    template<class INPUT_ITERATOR, class OUTPUT_ITERATOR>
+        void restoreEdgeValues(INPUT_ITERATOR, OUTPUT_ITERATOR) const;
+
+private:
+    std::vector<std::size_t> newVertices_; // indexed by old vertex
+    std::vector<std::size_t> oldVertices_; // indexed by new vertex
+    std::vector<std::size_t> newEdges_; // indexed by old edge
+    std::vector<std::size_t> oldEdges_; // indexed by new edge
+
+template<class GRAPH, class REORDERED_GRAPH>
+friend void reorder(const GRAPH&, const std::vector<std::size_t>&, REORDERED_GRAPH&, Reordering&);
+};
+
+// \cond SUPPRESS_DOXYGEN
+namespace detail {
+
+// graphs that are built by insertEdges(), e.g. Graph and Digraph
+template<class GRAPH, class ITERATOR>
+inline auto
+assignFromEdges(
+    GRAPH& graph,
+    const std::size_t numberOfVertices,
+    const bool multipleEdgesEnabled,
+    ITERATOR begin,
+    ITERATOR end,
+    int
+) -> decltype(graph.insertEdges(begin, end), void()) {
+    graph.assign(numberOfVertices);
+    graph.multipleEdgesEnabled() = multipleEdgesEnabled;
+    graph.insertEdges(begin, end);
+}
+
+// graphs that are built from an edge list at once, e.g. StaticGraph
+template<class GRAPH, class ITERATOR>
+inline void
+assignFromEdges(
+    GRAPH& graph,
+    const std::size_t numberOfVertices,
+    const bool,
+    ITERATOR begin,
+    ITERATOR end,
+    long
+) {
+    graph.assign(numberOfVertices, begin, end);
+}
+
+// vertices in ascending order of their degree
+template<class GRAPH>
+inline void
+verticesByDegree(
+    const GRAPH& graph,
+    std::vector<std::size_t>& vertices
+) {
+    vertices.resize(graph.numberOfVertices());
+    for(std::size_t v = 0; v < vertices.size(); ++v) {
+        vertices[v] = v;
+    }
+    std::stable_sort(vertices.begin(), vertices.end(), [&](const std::size_t v, const std::size_t w) {
+        return graph.numberOfEdgesFromVertex(v) < graph.numberOfEdgesFromVertex(w);
+    });
+}
+
+// breadth-first search from each unvisited vertex in the given sequence.
+// the neighbors of a vertex are enqueued in ascending order of their
+// degree if sortByDegree is true and in the order of adjacencies otherwise.
+template<class GRAPH>
+inline void
+breadthFirstOrder(
+    const GRAPH& graph,
+    const std::vector<std::size_t>& roots,
+    const bool sortByDegree,
+    std::vector<std::size_t>& order
+) {
+    typedef typename GRAPH::AdjacencyType AdjacencyType;
+
+    std::vector<char> visited(graph.numberOfVertices(), 0);
+    std::vector<std::size_t> neighbors;
+    order.clear();
+    order.reserve(graph.numberOfVertices());
+    for(std::size_t j = 0; j < roots.size(); ++j) {
+        if(visited[roots[j]]) {
+            continue;
+        }
+        visited[roots[j]] = 1;
+        std::size_t head = order.size();
+        order.push_back(roots[j]);
+        for(; head < order.size(); ++head) {
+            neighbors.clear();
+            forEachAdjacency(graph, order[head], [&](const AdjacencyType& a) {
+                if(!visited[a.vertex()]) {
+                    visited[a.vertex()] = 1;
+                    neighbors.push_back(a.vertex());
+                }
+            });
+            if(sortByDegree) {
+                std::stable_sort(neighbors.begin(), neighbors.end(), [&](const std::size_t v, const std::size_t w) {
+                    return graph.numberOfEdgesFromVertex(v) < graph.numberOfEdgesFromVertex(w);
+                });
+            }
+            order.insert(order.end(), neighbors.begin(), neighbors.end());
+        }
+    }
+    assert(order.size() == graph.numberOfVertices());
+}
+
+} // namespace detail
+// \endcond
+
+/// Order the vertices of a graph by breadth-first search.
+///
+/// Each connected component is searched from its vertex with the smallest
+/// integer index. Vertices that are adjacent in the graph are close to one
+/// another in the order.
+///
+/// \param graph Graph.
+/// \param[out] order Integer indices of the vertices in the new order.
+///
+template<class GRAPH>
+inline void
+breadthFirstOrder(
+    const GRAPH& graph,
+    std::vector<std::size_t>& order
+) {
+    std::vector<std::size_t> roots(graph.numberOfVertices());
+    for(std::size_t v = 0; v < roots.size(); ++v) {
+        roots[v] = v;
+    }
+    detail::breadthFirstOrder(graph, roots, false, order);
+}
+
+/// Order the vertices of a graph by the reverse Cuthill-McKee algorithm.
+///
+/// Each connected component is searched breadth-first from a vertex of
+/// minimum degree, enqueueing the neighbors of each vertex in ascending
+/// order of their degree. The resulting order is reversed. This tends to
+/// minimize the bandwidth of the adjacency matrix, i.e. the largest
+/// difference between the indices of adjacent vertices.
+///
+/// E. Cuthill and J. McKee. Reducing the Bandwidth of Sparse Symmetric
+/// Matrices. In: Proc. 24th National Conference of the ACM, 157-172, 1969
+///
+/// \param graph Graph.
+/// \param[out] order Integer indices of the vertices in the new order.
+///
+template<class GRAPH>
+inline void
+reverseCuthillMcKeeOrder(
+    const GRAPH& graph,
+    std::vector<std::size_t>& order
+) {
+    std::vector<std::size_t> roots;
+    detail::verticesByDegree(graph, roots);
+    detail::breadthFirstOrder(graph, roots, true, order);
+    std::reverse(order.begin(), order.end());
+}
+
+/// Order the vertices of a graph by descending degree.
+///
+/// Vertices of equal degree keep their relative order. Vertices of high
+/// degree, which are accessed most often by most algorithms, are stored
+/// together.
+///
+/// \param graph Graph.
+/// \param[out] order Integer indices of the vertices in the new order.
+///
+template<class GRAPH>
+inline void
+degreeOrder(
+    const GRAPH& graph,
+    std::vector<std::size_t>& order
+) {
+    detail::verticesByDegree(graph, order);
+    std::stable_sort(order.begin(), order.end(), [&](const std::size_t v, const std::size_t w) {
+        return graph.numberOfEdgesFromVertex(v) > graph.numberOfEdgesFromVertex(w);
+    });
+}
+
+/// Order vertices with integer coordinates along a Morton (Z-order) curve.
+///
+/// This is a hint for graphs whose vertices correspond to positions in an
+/// image or volume, e.g. region adjacency graphs of superpixels, for which
+/// vertices that are close in space are likely to be adjacent. Points are
+/// compared by the dimension in which their coordinates differ in the most
+/// significant bit, without computing interleaved keys. Of two dimensions
+/// that differ in the same bit, the first is more significant.
+///
+/// \param coordinatesBegin Iterator to the beginning of a sequence of
+///     coordinates, one for each vertex, e.g. std::array<std::size_t, 2>.
+///     All coordinates must have the same size and unsigned integer entries.
+/// \param coordinatesEnd Iterator to the end of the sequence.
+/// \param[out] order Integer indices of the vertices in the new order.
+///
+template<class ITERATOR>
+inline void
+mortonOrder(
+    ITERATOR coordinatesBegin,
+    ITERATOR coordinatesEnd,
+    std::vector<std::size_t>& order
+) {
+    order.resize(std::distance(coordinatesBegin, coordinatesEnd));
+    for(std::size_t v = 0; v < order.size(); ++v) {
+        order[v] = v;
+    }
+    std::stable_sort(order.begin(), order.end(), [&](const std::size_t v, const std::size_t w) {
+        const auto& p = *(coordinatesBegin + v);
+        const auto& q = *(coordinatesBegin + w);
+        assert(p.size() == q.size());
+        std::size_t dimension = 0;
+        std::size_t mostSignificantDifference = 0;
+        for(std::size_t j = 0; j < p.size(); ++j) {
+            const std::size_t difference = static_cast<std::size_t>(p[j] ^ q[j]);
+            // mostSignificantDifference has a less significant highest bit
+            if(mostSignificantDifference < difference && mostSignificantDifference < (mostSignificantDifference ^ difference)) {
+                dimension = j;
+                mostSignificantDifference = difference;
+            }
+        }
+        return p[dimension] < q[dimension];
+    });
+}
+
+/// Build a copy of a graph whose vertices are numbered in a given order.
+///
+/// Edges of the reordered graph are sorted by their smaller and then their
+/// larger new vertex index, so that the edges of each vertex are close to
+/// one another as well. For directed graphs, the orientation of edges is
+/// preserved.
+///
+/// Edge values and vertex values such as costs and labelings can be copied
+/// between the two numberings by the helpers of Reordering. For graphs on the
+/// same vertices, e.g. the original and lifted graph of a lifted multicut
+/// problem, call reorder() for each graph with the same order.
+///
+/// \param graph Graph, e.g. Graph or Digraph.
+/// \param order Integer indices of the vertices of graph in the new order,
+///     e.g. as computed by reverseCuthillMcKeeOrder().
+/// \param[out] reorderedGraph Graph built by insertEdges(), e.g. Graph, or
+///     from an edge list, e.g. StaticGraph.
+/// \param[out] reordering Maps between old and new indices.
+///
+template<class GRAPH, class REORDERED_GRAPH>
+inline void
+reorder(
+    const GRAPH& graph,
+    const std::vector<std::size_t>& order,
+    REORDERED_GRAPH& reorderedGraph,
+    Reordering& reordering
+) {
+    typedef std::pair<std::size_t, std::size_t> Pair;
+
+    const std::size_t numberOfVertices = graph.numberOfVertices();
+    if(order.size() != numberOfVertices) {
+        throw std::runtime_error("order does not contain each vertex exactly once.");
+    }
+
+    reordering.oldVertices_ = order;
+    reordering.newVertices_.assign(numberOfVertices, numberOfVertices);
+    for(std::size_t v = 0; v < numberOfVertices; ++v) {
+        if(order[v] >= numberOfVertices || reordering.newVertices_[order[v]] != numberOfVertices) {
+            throw std::runtime_error("order does not contain each vertex exactly once.");
+        }
+        reordering.newVertices_[order[v]] = v;
+    }
+
+    // sort edges wrt their new vertices
+    std::vector<Pair> edges(graph.numberOfEdges());
+    forEachEdge(graph, [&](const std::size_t e, const std::size_t v0, const std::size_t v1) {
+        edges[e] = Pair(reordering.newVertices_[v0], reordering.newVertices_[v1]);
+    });
+    reordering.oldEdges_.resize(edges.size());
+    for(std::size_t e = 0; e < edges.size(); ++e) {
+        reordering.oldEdges_[e] = e;
+    }
+    std::stable_sort(reordering.oldEdges_.begin(), reordering.oldEdges_.end(), [&](const std::size_t e, const std::size_t f) {
+        const Pair p = edges[e].first < edges[e].second ? edges[e] : Pair(edges[e].second, edges[e].first);
+        const Pair q = edges[f].first < edges[f].second ? edges[f] : Pair(edges[f].second, edges[f].first);
+        return p < q;
+    });
+    reordering.newEdges_.resize(edges.size());
+    std::vector<Pair> reorderedEdges(edges.size());
+    for(std::size_t e = 0; e < edges.size(); ++e) {
+        reordering.newEdges_[reordering.oldEdges_[e]] = e;
+        reorderedEdges[e] = edges[reordering.oldEdges_[e]];
+    }
+
+    detail::assignFromEdges(reorderedGraph, numberOfVertices, graph.multipleEdgesEnabled(),
+        reorderedEdges.begin(), reorderedEdges.end(), 0);
+    assert(reorderedGraph.numberOfEdges() == graph.numberOfEdges());
+}
+
+/// Construct empty maps.
+///
+inline
+Reordering::Reordering()
+:   newVertices_(),
+    oldVertices_(),
+    newEdges_(),
+    oldEdges_()
+{}
+
+/// Get the number of vertices.
+///
+inline std::size_t
+Reordering::numberOfVertices() const {
+    return oldVertices_.size();
+}
+
+/// Get the number of edges.
+///
+inline std::size_t
+Reordering::numberOfEdges() const {
+    return oldEdges_.size();
+}
+
+/// Get the new integer index of a vertex.
+///
+/// \param vertex Integer index of the vertex in the original graph.
+///
+inline std::size_t
+Reordering::newVertex(
+    const std::size_t vertex
+) const {
+    assert(vertex < numberOfVertices());
+    return newVertices_[vertex];
+}
+
+/// Get the original integer index of a vertex.
+///
+/// \param vertex Integer index of the vertex in the reordered graph.
+///
+inline std::size_t
+Reordering::oldVertex(
+    const std::size_t vertex
+) const {
+    assert(vertex < numberOfVertices());
+    return oldVertices_[vertex];
+}
+
+/// Get the new integer index of an edge.
+///
+/// \param edge Integer index of the edge in the original graph.
+///
+inline std::size_t
+Reordering::newEdge(
+    const std::size_t edge
+) const {
+    assert(edge < numberOfEdges());
+    return newEdges_[edge];
+}
+
+/// Get the original integer index of an edge.
+///
+/// \param edge Integer index of the edge in the reordered graph.
+///
+inline std::size_t
+Reordering::oldEdge(
+    const std::size_t edge
+) const {
+    assert(edge < numberOfEdges());
+    return oldEdges_[edge];
+}
+
+/// Copy values of the vertices of the original graph to the reordered graph.
+///
+/// \param oldValues Random access iterator to the beginning of a sequence
+///     of values, one for each vertex of the original graph.
+/// \param newValues Random access iterator to the beginning of a sequence
+///     of values, one for each vertex of the reordered graph.
+///
+template<class INPUT_ITERATOR, class OUTPUT_ITERATOR>
+inline void
+Reordering::permuteVertexValues(
+    INPUT_ITERATOR oldValues,
+    OUTPUT_ITERATOR newValues
+) const {
+    for(std::size_t v = 0; v < numberOfVertices(); ++v) {
+        newValues[v] = oldValues[oldVertices_[v]];
+    }
+}
+
+/// Copy values of the vertices of the reordered graph to the original graph,
+/// e.g. a vertex labeling computed for the reordered graph.
+///
+/// \param newValues Random access iterator to the beginning of a sequence
+///     of values, one for each vertex of the reordered graph.
+/// \param oldValues Random access iterator to the beginning of a sequence
+///     of values, one for each vertex of the original graph.
+///
+template<class INPUT_ITERATOR, class OUTPUT_ITERATOR>
+inline void
+Reordering::restoreVertexValues(
+    INPUT_ITERATOR newValues,
+    OUTPUT_ITERATOR oldValues
+) const {
+    for(std::size_t v = 0; v < numberOfVertices(); ++v) {
+        oldValues[oldVertices_[v]] = newValues[v];
+    }
+}
+
+/// Copy values of the edges of the original graph to the reordered graph,
+/// e.g. edge costs.
+///
+/// \param oldValues Random access iterator to the beginning of a sequence
+///     of values, one for each edge of the original graph.
+/// \param newValues Random access iterator to the beginning of a sequence
+///     of values, one for each edge of the reordered graph.
+///
+template<class INPUT_ITERATOR, class OUTPUT_ITERATOR>
+inline void
+Reordering::permuteEdgeValues(
+    INPUT_ITERATOR oldValues,
+    OUTPUT_ITERATOR newValues
+) const {
+    for(std::size_t e = 0; e < numberOfEdges(); ++e) {
+        newValues[e] = oldValues[oldEdges_[e]];
+    }
+}
+
+/// Copy values of the edges of the reordered graph to the original graph,
+/// e.g. an edge labeling computed for the reordered graph.
+///
+/// \param newValues Random access iterator to the beginning of a sequence
+///     of values, one for each edge of the reordered graph.
+/// \param oldValues Random access iterator to the beginning of a sequence
+///     of values, one for each edge of the original graph.
+///
+template<class INPUT_ITERATOR, class OUTPUT_ITERATOR>
+inline void
+Reordering::restoreEdgeValues(
+    INPUT_ITERATOR newValues,
+    OUTPUT_ITERATOR oldValues
+) const {
+    for(std::size_t e = 0; e < numberOfEdges(); ++e) {
+        oldValues[oldEdges_[e]] = newValues[e];
+    }
+}
+
+} // namespace graph
+} // namespace andres
+
+#endif // #ifndef ANDRES_GRAPH_REORDERING_HXX
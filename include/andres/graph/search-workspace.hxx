@@ -0,0 +1,227 @@
+#pragma once
+#ifndef ANDRES_GRAPH_SEARCH_WORKSPACE_HXX
+#define ANDRES_GRAPH_SEARCH_WORKSPACE_HXX
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+#include <algorithm> // std::fill
+
+#include "priority-queues.hxx"
+
+namespace andres {
+namespace graph {
+
+/// Per-vertex state of graph searches that is reset in constant time.
+///
+/// Every vertex carries the generation of the search that visited it last.
+/// Starting a new search increments the current generation, so that the
+/// state of all vertices becomes invalid without touching them. A search
+/// thus costs time in the number of vertices and edges it visits, not in
+/// the number of vertices of the graph, which pays off for many short
+/// searches on a large graph. The generations of all vertices are reset
+/// only once every 2^32 - 1 searches, when the counter wraps around.
+/// Generation 0 is never current and marks vertices that have not been
+/// visited since the workspace was allocated or reset.
+///
+/// A workspace can be passed to breadthFirstSearch, depthFirstSearch,
+/// spsp and sssp. It grows with the largest graph searched and can be used
+/// for graphs of different size. After a search, the distances and parents
+/// of the visited vertices can be queried.
+///
+/// Bidirectional searches, i.e. weighted spsp and spspEdges, additionally
+/// label vertices from the target vertex, with a second set of buffers
+/// that is allocated by the first such search.
+///
+/// \tparam VALUE Type of distances, std::size_t for unweighted searches.
+/// \tparam QUEUE_TAG Priority queue of Dijkstra's algorithm, IndexedHeapTag
+///     by default, or BucketQueueTag or RadixHeapTag for searches with
+///     integral edge weights whose keys are monotone.
+///
+template<class VALUE = std::size_t, class QUEUE_TAG = IndexedHeapTag>
+class SearchWorkspace {
+public:
+    typedef VALUE Value;
+    typedef QUEUE_TAG QueueTag;
+    typedef typename PriorityQueueType<QueueTag, Value>::type Queue;
+    typedef std::uint32_t Generation;
+
+    SearchWorkspace(const std::size_t = 0);
+    template<class GRAPH>
+        SearchWorkspace(const GRAPH&);
+    void startSearch(const std::size_t);
+    void startBidirectionalSearch(const std::size_t);
+    bool isVisited(const std::size_t v) const
+        { return generations_[v] == generation_; }
+    void markVisited(const std::size_t v)
+        { generations_[v] = generation_; }
+    bool isVisitedBackward(const std::size_t v) const
+        { return backwardGenerations_[v] == generation_; }
+    void markVisitedBackward(const std::size_t v)
+        { backwardGenerations_[v] = generation_; }
+    Value distance(const std::size_t) const;
+    std::size_t parent(const std::size_t) const;
+    std::size_t parentEdge(const std::size_t) const;
+    static Value infinity();
+
+    // buffers used by the search functions
+    std::vector<Generation> generations_;
+    Generation generation_;
+    std::vector<Value> distances_;
+    std::vector<std::ptrdiff_t> parents_;
+    std::vector<std::size_t> parentEdges_;
+    std::vector<std::size_t> queues_[2];
+    Queue heap_;
+
+    // buffers of the backward search from the target vertex
+    std::vector<Generation> backwardGenerations_;
+    std::vector<Value> backwardDistances_;
+    std::vector<std::size_t> backwardParents_;
+    std::vector<std::size_t> backwardParentEdges_;
+    Queue backwardHeap_;
+};
+
+template<class VALUE, class QUEUE_TAG>
+inline
+SearchWorkspace<VALUE, QUEUE_TAG>::SearchWorkspace(
+    const std::size_t numberOfVertices
+)
+:   generations_(numberOfVertices),
+    generation_(1),
+    distances_(numberOfVertices),
+    parents_(numberOfVertices),
+    parentEdges_(numberOfVertices),
+    queues_(),
+    heap_(numberOfVertices),
+    backwardGenerations_(),
+    backwardDistances_(),
+    backwardParents_(),
+    backwardParentEdges_(),
+    backwardHeap_()
+{}
+
+template<class VALUE, class QUEUE_TAG>
+template<class GRAPH>
+inline
+SearchWorkspace<VALUE, QUEUE_TAG>::SearchWorkspace(
+    const GRAPH& graph
+)
+:   generations_(graph.numberOfVertices()),
+    generation_(1),
+    distances_(graph.numberOfVertices()),
+    parents_(graph.numberOfVertices()),
+    parentEdges_(graph.numberOfVertices()),
+    queues_(),
+    heap_(graph.numberOfVertices()),
+    backwardGenerations_(),
+    backwardDistances_(),
+    backwardParents_(),
+    backwardParentEdges_(),
+    backwardHeap_()
+{}
+
+/// Start a new search, invalidating the state of all vertices.
+///
+/// \param numberOfVertices Number of vertices of the graph to be searched.
+///
+template<class VALUE, class QUEUE_TAG>
+inline void
+SearchWorkspace<VALUE, QUEUE_TAG>::startSearch(
+    const std::size_t numberOfVertices
+) {
+    if(generations_.size() < numberOfVertices) {
+        generations_.resize(numberOfVertices, 0);
+        distances_.resize(numberOfVertices);
+        parents_.resize(numberOfVertices);
+        parentEdges_.resize(numberOfVertices);
+        heap_.resize(numberOfVertices);
+    }
+    ++generation_;
+    if(generation_ == 0) {
+        std::fill(generations_.begin(), generations_.end(), 0);
+        std::fill(backwardGenerations_.begin(), backwardGenerations_.end(), 0);
+        generation_ = 1;
+    }
+    queues_[0].clear();
+    queues_[1].clear();
+    heap_.clear();
+}
+
+/// Start a new search from both a source and a target vertex, invalidating
+/// the state of all vertices in both directions.
+///
+/// \param numberOfVertices Number of vertices of the graph to be searched.
+///
+template<class VALUE, class QUEUE_TAG>
+inline void
+SearchWorkspace<VALUE, QUEUE_TAG>::startBidirectionalSearch(
+    const std::size_t numberOfVertices
+) {
+    if(backwardGenerations_.size() < numberOfVertices) {
+        backwardGenerations_.resize(numberOfVertices, 0);
+        backwardDistances_.resize(numberOfVertices);
+        backwardParents_.resize(numberOfVertices);
+        backwardParentEdges_.resize(numberOfVertices);
+        backwardHeap_.resize(numberOfVertices);
+    }
+    startSearch(numberOfVertices);
+    backwardHeap_.clear();
+}
+
+/// Get the distance of a vertex from the source of the last search.
+///
+/// \param v Vertex.
+/// \return Distance, or infinity() if the vertex has not been visited.
+///
+template<class VALUE, class QUEUE_TAG>
+inline typename SearchWorkspace<VALUE, QUEUE_TAG>::Value
+SearchWorkspace<VALUE, QUEUE_TAG>::distance(
+    const std::size_t v
+) const {
+    return isVisited(v) ? distances_[v] : infinity();
+}
+
+/// Get the parent of a visited vertex in the tree of shortest paths found
+/// by the last call of sssp.
+///
+/// \param v Vertex other than the source.
+///
+template<class VALUE, class QUEUE_TAG>
+inline std::size_t
+SearchWorkspace<VALUE, QUEUE_TAG>::parent(
+    const std::size_t v
+) const {
+    assert(isVisited(v));
+    return parents_[v];
+}
+
+/// Get the edge from a visited vertex to its parent in the tree of shortest
+/// paths found by the last call of sssp.
+///
+/// \param v Vertex other than the source.
+///
+template<class VALUE, class QUEUE_TAG>
+inline std::size_t
+SearchWorkspace<VALUE, QUEUE_TAG>::parentEdge(
+    const std::size_t v
+) const {
+    assert(isVisited(v));
+    return parentEdges_[v];
+}
+
+/// Distance of vertices that have not been visited.
+///
+template<class VALUE, class QUEUE_TAG>
+inline typename SearchWorkspace<VALUE, QUEUE_TAG>::Value
+SearchWorkspace<VALUE, QUEUE_TAG>::infinity() {
+    return std::numeric_limits<Value>::has_infinity
+        ? std::numeric_limits<Value>::infinity()
+        : std::numeric_limits<Value>::max();
+}
+
+} // namespace graph
+} // namespace andres
+
+#endif // #ifndef ANDRES_GRAPH_SEARCH_WORKSPACE_HXX
@@ -8,9 +8,19 @@
 #include <queue>
 #include <vector>
 #include <algorithm> // std::reverse
+#include <atomic>
+#include <memory> // std::unique_ptr
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 #include "subgraph.hxx" // DefaultSubgraphMask
 #include "edge-value.hxx" // UnitEdgeValueIterator
+#include "for-each.hxx"
+#include "grid-graph.hxx"
+#include "indexed-heap.hxx"
+#include "search-workspace.hxx"
 
 namespace andres {
 namespace graph {
@@ -442,6 +452,197 @@ spspEdges(
      PARENT_ITERATOR
 );
     
+template<class GRAPH, class VALUE, class QUEUE_TAG>
+bool
+spsp(
+    const GRAPH&,
+    const std::size_t,
+    const std::size_t,
+    std::deque<std::size_t>&,
+    SearchWorkspace<VALUE, QUEUE_TAG>&
+);
+
+template<class GRAPH, class SUBGRAPH_MASK, class VALUE, class QUEUE_TAG>
+bool
+spsp(
+    const GRAPH&,
+    const SUBGRAPH_MASK&,
+    const std::size_t,
+    const std::size_t,
+    std::deque<std::size_t>&,
+    SearchWorkspace<VALUE, QUEUE_TAG>&
+);
+
+template<class GRAPH, class SUBGRAPH_MASK, class VALUE, class QUEUE_TAG>
+bool
+spsp(
+    const GRAPH&,
+    const SUBGRAPH_MASK&,
+    const std::size_t,
+    const std::size_t,
+    std::deque<std::size_t>&,
+    SearchWorkspace<VALUE, QUEUE_TAG>&,
+    const std::size_t
+);
+
+template<class GRAPH, class EDGE_VALUE_ITERATOR, class T, class QUEUE_TAG>
+void
+spsp(
+    const GRAPH&,
+    const std::size_t,
+    const std::size_t,
+    EDGE_VALUE_ITERATOR,
+    std::deque<std::size_t>&,
+    T&,
+    SearchWorkspace<T, QUEUE_TAG>&
+);
+
+template<class GRAPH, class SUBGRAPH_MASK, class EDGE_VALUE_ITERATOR, class T, class QUEUE_TAG>
+void
+spsp(
+    const GRAPH&,
+    const SUBGRAPH_MASK&,
+    const std::size_t,
+    const std::size_t,
+    EDGE_VALUE_ITERATOR,
+    std::deque<std::size_t>&,
+    T&,
+    SearchWorkspace<T, QUEUE_TAG>&
+);
+
+template<class GRAPH, class VALUE, class QUEUE_TAG>
+void
+sssp(
+    const GRAPH&,
+    const std::size_t,
+    SearchWorkspace<VALUE, QUEUE_TAG>&
+);
+
+template<class GRAPH, class SUBGRAPH_MASK, class VALUE, class QUEUE_TAG>
+void
+sssp(
+    const GRAPH&,
+    const SUBGRAPH_MASK&,
+    const std::size_t,
+    SearchWorkspace<VALUE, QUEUE_TAG>&
+);
+
+template<class GRAPH, class EDGE_VALUE_ITERATOR, class VALUE, class QUEUE_TAG>
+void
+sssp(
+    const GRAPH&,
+    const std::size_t,
+    const EDGE_VALUE_ITERATOR,
+    SearchWorkspace<VALUE, QUEUE_TAG>&
+);
+
+template<class GRAPH, class SUBGRAPH_MASK, class EDGE_VALUE_ITERATOR, class VALUE, class QUEUE_TAG>
+void
+sssp(
+    const GRAPH&,
+    const SUBGRAPH_MASK&,
+    const std::size_t,
+    const EDGE_VALUE_ITERATOR,
+    SearchWorkspace<VALUE, QUEUE_TAG>&
+);
+
+template<class GRAPH, class SUBGRAPH_MASK, class VALUE, class QUEUE_TAG>
+bool
+spspEdges(
+    const GRAPH&,
+    const SUBGRAPH_MASK&,
+    const std::size_t,
+    const std::size_t,
+    std::deque<std::size_t>&,
+    SearchWorkspace<VALUE, QUEUE_TAG>&
+);
+
+template<class GRAPH, class SUBGRAPH_MASK, class EDGE_VALUE_ITERATOR, class T, class QUEUE_TAG>
+void
+spspEdges(
+    const GRAPH&,
+    const SUBGRAPH_MASK&,
+    const std::size_t,
+    const std::size_t,
+    EDGE_VALUE_ITERATOR,
+    std::deque<std::size_t>&,
+    T&,
+    SearchWorkspace<T, QUEUE_TAG>&
+);
+
+/// Parameters and buffers of the parallel delta-stepping algorithm.
+///
+/// Passing these buffers to sssp selects the parallel algorithm.
+///
+/// \tparam VALUE Type of distances.
+///
+template<class VALUE>
+struct DeltaSteppingBuffers {
+    typedef VALUE Value;
+
+    DeltaSteppingBuffers(const Value, const std::size_t = 0);
+    int startSearch(const std::size_t);
+
+    Value delta_; // width of buckets, edges of larger weight are heavy
+    std::size_t numberOfThreads_; // 0 for the default of OpenMP
+    std::size_t numberOfVertices_;
+    std::unique_ptr<std::atomic<Value>[]> distances_;
+    std::unique_ptr<std::atomic<bool>[]> flags_; // all false between searches
+    std::vector<std::vector<std::vector<std::size_t> > > buckets_; // per thread, cyclic
+    std::vector<std::vector<std::size_t> > vertices_; // per thread
+    std::vector<std::size_t> frontier_;
+};
+
+template<class GRAPH, class EDGE_VALUE_ITERATOR, class DISTANCE_ITERATOR, class PARENT_ITERATOR, class VALUE>
+void
+sssp(
+    const GRAPH&,
+    const std::size_t,
+    const EDGE_VALUE_ITERATOR,
+    DISTANCE_ITERATOR,
+    PARENT_ITERATOR,
+    DeltaSteppingBuffers<VALUE>&
+);
+
+template<class GRAPH, class SUBGRAPH_MASK, class EDGE_VALUE_ITERATOR, class DISTANCE_ITERATOR, class PARENT_ITERATOR, class VALUE>
+void
+sssp(
+    const GRAPH&,
+    const SUBGRAPH_MASK&,
+    const std::size_t,
+    const EDGE_VALUE_ITERATOR,
+    DISTANCE_ITERATOR,
+    PARENT_ITERATOR,
+    DeltaSteppingBuffers<VALUE>&
+);
+
+template<unsigned char D, class VISITOR, class EDGE_VALUE_ITERATOR, class T, class QUEUE_TAG>
+void
+spsp(
+    const GridGraph<D, VISITOR>&,
+    const std::size_t,
+    const std::size_t,
+    EDGE_VALUE_ITERATOR,
+    std::deque<std::size_t>&,
+    T&,
+    SearchWorkspace<T, QUEUE_TAG>&,
+    const T
+);
+
+template<unsigned char D, class VISITOR, class SUBGRAPH_MASK, class EDGE_VALUE_ITERATOR, class T, class QUEUE_TAG>
+void
+spsp(
+    const GridGraph<D, VISITOR>&,
+    const SUBGRAPH_MASK&,
+    const std::size_t,
+    const std::size_t,
+    EDGE_VALUE_ITERATOR,
+    std::deque<std::size_t>&,
+    T&,
+    SearchWorkspace<T, QUEUE_TAG>&,
+    const T
+);
+
 // \cond SUPPRESS_DOXYGEN
 namespace graph_detail {
 
@@ -477,24 +678,6 @@ spspHelper(
     }
 }
 
-template<class T>
-struct DijkstraQueueEntry {
-    typedef T Value;
-
-    DijkstraQueueEntry(const std::size_t vertex = 0, const Value distance = Value())
-        :   vertex_(vertex), distance_(distance)
-        {}
-    bool operator<(const DijkstraQueueEntry<Value>& other) const
-        { return distance_ > other.distance_; }
-    bool operator==(const DijkstraQueueEntry<Value>& other) const
-        { return vertex_ == other.vertex_ && distance_ == other.distance_; }
-    bool operator!=(const DijkstraQueueEntry<Value>& other) const
-        { return vertex_ != other.vertex_ || distance_ != other.distance_; }
-
-    std::size_t vertex_;
-    Value distance_;
-};
-
 // Single source shortest path visitor for Dijkstra's algorithm.
 template<class DISTANCE_ITERATOR, class PARENT_ITERATOR>
 class DijkstraSPSPVisitor {
@@ -575,6 +758,210 @@ public:
     std::deque<std::size_t>& path_;
 };
 
+// Dijkstra's algorithm on the heap of a workspace, stopped as soon as the
+// vertex vt is settled. Only vertices that are reached are touched. Each
+// vertex is contained in the heap at most once, with its key decreased
+// whenever a shorter path to it is found.
+template<class GRAPH, class SUBGRAPH_MASK, class EDGE_VALUE_ITERATOR, class VALUE, class QUEUE_TAG>
+inline bool
+dijkstra(
+    const GRAPH& g,
+    const SUBGRAPH_MASK& mask,
+    const std::size_t vs,
+    const std::size_t vt,
+    const EDGE_VALUE_ITERATOR edgeWeights,
+    SearchWorkspace<VALUE, QUEUE_TAG>& workspace
+) {
+    typedef VALUE Value;
+
+    assert(detail::isVertexInSubgraph(mask, vs));
+    workspace.startSearch(g.numberOfVertices());
+    typename SearchWorkspace<VALUE, QUEUE_TAG>::Queue& heap = workspace.heap_;
+    workspace.markVisited(vs);
+    workspace.distances_[vs] = Value();
+    workspace.parents_[vs] = vs;
+    heap.push(vs, Value());
+    while(!heap.empty()) {
+        const std::size_t v = heap.top();
+        const Value distance = heap.topKey();
+        heap.pop();
+        if(v == vt) {
+            return true;
+        }
+        forEachAdjacency(g, v, [&](const typename GRAPH::AdjacencyType& a) {
+            const std::size_t w = a.vertex();
+            if(detail::isVertexInSubgraph(mask, w) && detail::isEdgeInSubgraph(mask, a.edge())) {
+                const Value alternativeDistance = distance + edgeWeights[a.edge()];
+                if(!workspace.isVisited(w) || alternativeDistance < workspace.distances_[w]) {
+                    workspace.markVisited(w);
+                    workspace.distances_[w] = alternativeDistance;
+                    workspace.parents_[w] = v;
+                    workspace.parentEdges_[w] = a.edge();
+                    heap.pushOrDecreaseKey(w, alternativeDistance);
+                }
+            }
+        });
+    }
+    return false;
+}
+
+// Bidirectional Dijkstra's algorithm on the heaps of a workspace. Vertices
+// are settled alternately from vs, along outgoing edges, and from vt, along
+// incoming edges, always in the direction whose heap holds fewer vertices.
+// mu is the length of the shortest path found so far through a vertex that
+// is labeled in both directions. The search stops as soon as the sum of the
+// smallest keys of both heaps is at least mu, because no path through an
+// unsettled vertex can be shorter. Returns the vertex on a shortest path at
+// which the two searches meet. mu is infinity if there is no path.
+template<class GRAPH, class SUBGRAPH_MASK, class EDGE_VALUE_ITERATOR, class VALUE, class QUEUE_TAG>
+inline std::size_t
+bidirectionalDijkstra(
+    const GRAPH& g,
+    const SUBGRAPH_MASK& mask,
+    const std::size_t vs,
+    const std::size_t vt,
+    const EDGE_VALUE_ITERATOR edgeWeights,
+    SearchWorkspace<VALUE, QUEUE_TAG>& workspace,
+    VALUE& mu
+) {
+    typedef VALUE Value;
+
+    assert(detail::isVertexInSubgraph(mask, vs));
+    assert(detail::isVertexInSubgraph(mask, vt));
+    workspace.startBidirectionalSearch(g.numberOfVertices());
+    typename SearchWorkspace<VALUE, QUEUE_TAG>::Queue& forwardHeap = workspace.heap_;
+    typename SearchWorkspace<VALUE, QUEUE_TAG>::Queue& backwardHeap = workspace.backwardHeap_;
+    workspace.markVisited(vs);
+    workspace.distances_[vs] = Value();
+    workspace.parents_[vs] = vs;
+    forwardHeap.push(vs, Value());
+    workspace.markVisitedBackward(vt);
+    workspace.backwardDistances_[vt] = Value();
+    workspace.backwardParents_[vt] = vt;
+    backwardHeap.push(vt, Value());
+    mu = SearchWorkspace<VALUE, QUEUE_TAG>::infinity();
+    std::size_t meetingVertex = vs;
+    if(vs == vt) {
+        mu = Value();
+        return vs;
+    }
+    while(!forwardHeap.empty() && !backwardHeap.empty()) {
+        if(!(forwardHeap.topKey() + backwardHeap.topKey() < mu)) {
+            break;
+        }
+        if(forwardHeap.size() <= backwardHeap.size()) {
+            const std::size_t v = forwardHeap.top();
+            const Value distance = forwardHeap.topKey();
+            forwardHeap.pop();
+            forEachAdjacency(g, v, [&](const typename GRAPH::AdjacencyType& a) {
+                const std::size_t w = a.vertex();
+                if(detail::isVertexInSubgraph(mask, w) && detail::isEdgeInSubgraph(mask, a.edge())) {
+                    const Value alternativeDistance = distance + edgeWeights[a.edge()];
+                    if(!workspace.isVisited(w) || alternativeDistance < workspace.distances_[w]) {
+                        workspace.markVisited(w);
+                        workspace.distances_[w] = alternativeDistance;
+                        workspace.parents_[w] = v;
+                        workspace.parentEdges_[w] = a.edge();
+                        forwardHeap.pushOrDecreaseKey(w, alternativeDistance);
+                        if(workspace.isVisitedBackward(w) && alternativeDistance + workspace.backwardDistances_[w] < mu) {
+                            mu = alternativeDistance + workspace.backwardDistances_[w];
+                            meetingVertex = w;
+                        }
+                    }
+                }
+            });
+        }
+        else {
+            const std::size_t v = backwardHeap.top();
+            const Value distance = backwardHeap.topKey();
+            backwardHeap.pop();
+            for(typename GRAPH::AdjacencyIterator it = g.adjacenciesToVertexBegin(v);
+            it != g.adjacenciesToVertexEnd(v); ++it) {
+                const std::size_t w = it->vertex();
+                if(detail::isVertexInSubgraph(mask, w) && detail::isEdgeInSubgraph(mask, it->edge())) {
+                    const Value alternativeDistance = distance + edgeWeights[it->edge()];
+                    if(!workspace.isVisitedBackward(w) || alternativeDistance < workspace.backwardDistances_[w]) {
+                        workspace.markVisitedBackward(w);
+                        workspace.backwardDistances_[w] = alternativeDistance;
+                        workspace.backwardParents_[w] = v;
+                        workspace.backwardParentEdges_[w] = it->edge();
+                        backwardHeap.pushOrDecreaseKey(w, alternativeDistance);
+                        if(workspace.isVisited(w) && workspace.distances_[w] + alternativeDistance < mu) {
+                            mu = workspace.distances_[w] + alternativeDistance;
+                            meetingVertex = w;
+                        }
+                    }
+                }
+            }
+        }
+    }
+    return meetingVertex;
+}
+
+// A* search in a grid graph on the heap of a workspace, stopped as soon as
+// the vertex vt is settled. Vertices are settled in the order of their
+// distance from vs plus a lower bound on their distance to vt, namely their
+// Manhattan distance to vt times the minimum edge weight. This bound is
+// consistent, so no settled vertex is reached again on a shorter path.
+template<unsigned char D, class VISITOR, class SUBGRAPH_MASK, class EDGE_VALUE_ITERATOR, class VALUE, class QUEUE_TAG>
+inline bool
+aStar(
+    const GridGraph<D, VISITOR>& g,
+    const SUBGRAPH_MASK& mask,
+    const std::size_t vs,
+    const std::size_t vt,
+    const EDGE_VALUE_ITERATOR edgeWeights,
+    const VALUE minimumEdgeWeight,
+    SearchWorkspace<VALUE, QUEUE_TAG>& workspace
+) {
+    typedef VALUE Value;
+    typedef typename GridGraph<D, VISITOR>::VertexCoordinate VertexCoordinate;
+
+    assert(detail::isVertexInSubgraph(mask, vs));
+    VertexCoordinate targetCoordinate;
+    g.vertex(vt, targetCoordinate);
+    auto lowerBound = [&](const std::size_t v) {
+        VertexCoordinate coordinate;
+        g.vertex(v, coordinate);
+        std::size_t length = 0;
+        for(std::size_t j = 0; j < GridGraph<D, VISITOR>::DIMENSION; ++j) {
+            length += coordinate[j] < targetCoordinate[j]
+                ? targetCoordinate[j] - coordinate[j]
+                : coordinate[j] - targetCoordinate[j];
+        }
+        return static_cast<Value>(length) * minimumEdgeWeight;
+    };
+
+    workspace.startSearch(g.numberOfVertices());
+    typename SearchWorkspace<VALUE, QUEUE_TAG>::Queue& heap = workspace.heap_;
+    workspace.markVisited(vs);
+    workspace.distances_[vs] = Value();
+    workspace.parents_[vs] = vs;
+    heap.push(vs, lowerBound(vs));
+    while(!heap.empty()) {
+        const std::size_t v = heap.top();
+        heap.pop();
+        if(v == vt) {
+            return true;
+        }
+        const Value distance = workspace.distances_[v];
+        forEachAdjacency(g, v, [&](const typename GridGraph<D, VISITOR>::AdjacencyType& a) {
+            const std::size_t w = a.vertex();
+            if(detail::isVertexInSubgraph(mask, w) && detail::isEdgeInSubgraph(mask, a.edge())) {
+                const Value alternativeDistance = distance + edgeWeights[a.edge()];
+                if(!workspace.isVisited(w) || alternativeDistance < workspace.distances_[w]) {
+                    workspace.markVisited(w);
+                    workspace.distances_[w] = alternativeDistance;
+                    workspace.parents_[w] = v;
+                    workspace.parentEdges_[w] = a.edge();
+                    heap.pushOrDecreaseKey(w, alternativeDistance + lowerBound(w));
+                }
+            }
+        });
+    }
+    return false;
+}
+
 } // namespace graph_detail
 // \endcond
 
@@ -686,7 +1073,7 @@ spsp(
     const std::size_t max_length
 ) {
     path.clear();
-    if(!mask.vertex(vs) || !mask.vertex(vt)) {
+    if(!detail::isVertexInSubgraph(mask, vs) || !detail::isVertexInSubgraph(mask, vt)) {
         return false;
     }
     if(vs == vt) {
@@ -720,7 +1107,7 @@ spsp(
                 end = g.adjacenciesToVertexEnd(v);
             }
             for(; it != end; ++it) {
-                if(!mask.edge(it->edge()) || !mask.vertex(it->vertex())) {
+                if(!detail::isEdgeInSubgraph(mask, it->edge()) || !detail::isVertexInSubgraph(mask, it->vertex())) {
                     continue;
                 }
                 if(parents[it->vertex()] < 0 && q == 0) {
@@ -776,7 +1163,7 @@ spsp(
     const std::size_t max_length
 ) {
     path.clear();
-    if(!mask.vertex(vs) || !mask.vertex(vt)) {
+    if(!detail::isVertexInSubgraph(mask, vs) || !detail::isVertexInSubgraph(mask, vt)) {
         return false;
     }
     if(vs == vt) {
@@ -812,7 +1199,7 @@ spsp(
                 end = g.adjacenciesToVertexEnd(v);
             }
             for(; it != end; ++it) {
-                if(!mask.edge(it->edge()) || !mask.vertex(it->vertex())) {
+                if(!detail::isEdgeInSubgraph(mask, it->edge()) || !detail::isVertexInSubgraph(mask, it->vertex())) {
                     continue;
                 }
                 if(labels[it->vertex()] == seen_label && parents[it->vertex()] < 0 && q == 0) {
@@ -1084,23 +1471,24 @@ sssp(
     VISITOR& visitor 
 ) {
     typedef typename std::iterator_traits<DISTANCE_ITERATOR>::value_type Value;
-    typedef typename graph_detail::DijkstraQueueEntry<Value> Entry;
 
     assert(mask.vertex(vs));  
     const Value infinity = std::numeric_limits<Value>::has_infinity 
         ? std::numeric_limits<Value>::infinity() 
         : std::numeric_limits<Value>::max();
-    std::priority_queue<Entry> queue;
-    queue.push(vs);
+    // every vertex of the subgraph is contained once, at infinite distance
+    // until it is reached
+    IndexedHeap<Value> queue(g.numberOfVertices());
     for(std::size_t v = 0; v < g.numberOfVertices(); ++v) {
         distances[v] = infinity;
-        if(mask.vertex(v)) {
-            queue.push(Entry(v, infinity));
+        if(v != vs && detail::isVertexInSubgraph(mask, v)) {
+            queue.push(v, infinity);
         }
     }
     distances[vs] = 0;
+    queue.push(vs, 0);
     while(!queue.empty()) {
-        const std::size_t v = queue.top().vertex_;
+        const std::size_t v = queue.top();
         const bool proceed = visitor(distances, parents, v);
         if(!proceed) {
             return;
@@ -1109,22 +1497,16 @@ sssp(
         if(distances[v] == infinity) {
             return;
         }
-        for(typename GRAPH::AdjacencyIterator it = g.adjacenciesFromVertexBegin(v);
-        it != g.adjacenciesFromVertexEnd(v); ++it) {
-            if(mask.vertex(it->vertex()) && mask.edge(it->edge())) {
-                const Value alternativeDistance = distances[v] + edgeWeights[it->edge()];
-                if(alternativeDistance < distances[it->vertex()]) {
-                    distances[it->vertex()] = alternativeDistance;
-                    parents[it->vertex()] = v;
-                    queue.push(Entry(it->vertex(), alternativeDistance));
-                    // pushing v another time, not worring about existing entries
-                    // v in the queue at deprecated positions.
-                    // alternatively, one could use a heap from which elements 
-                    // can be removed. this is beneficial for dense graphs in 
-                    // which many weights are equal.
+        forEachAdjacency(g, v, [&](const typename GRAPH::AdjacencyType& a) {
+            if(detail::isVertexInSubgraph(mask, a.vertex()) && detail::isEdgeInSubgraph(mask, a.edge())) {
+                const Value alternativeDistance = distances[v] + edgeWeights[a.edge()];
+                if(alternativeDistance < distances[a.vertex()]) {
+                    distances[a.vertex()] = alternativeDistance;
+                    parents[a.vertex()] = v;
+                    queue.pushOrDecreaseKey(a.vertex(), alternativeDistance);
                 }
             }
-        }
+        });
     }
 }
 
@@ -1170,107 +1552,860 @@ spsp(
     distance = distances[vt];
 }
 
-// edge output versions below.
-
-/// Search for a shortest path from one to another vertex in an **unweighted** graph using breadth-first-search.
-///
-/// This function works for both undirected and directed graphs. It carries out
-/// breadth-first searches from the source vertex vs and the target vertex vt,
-/// alternating between the two search trees, until these trees meet and thus,
-/// a shortest path from vs to vt has been found.
+/// Search for a shortest path from one to another vertex in an **unweighted** graph using breadth-first-search, with a reusable workspace.
 ///
 /// \param g A graph class such as andres::Graph or andres::Digraph.
 /// \param vs The source vertex.
 /// \param vt The target vertex.
-/// \param path A double-ended queue to which the path (in edges) is written.
-/// \param parents An optional external buffer.
+/// \param path A double-ended queue to which the path is written.
+/// \param workspace Workspace, reusable across searches without being reset.
 /// \return true if a (shortest) path was found, false otherwise.
 ///
-template<class GRAPH>
+template<class GRAPH, class VALUE, class QUEUE_TAG>
 inline bool
-spspEdges(
+spsp(
     const GRAPH& g,
     const std::size_t vs,
     const std::size_t vt,
     std::deque<std::size_t>& path,
-    std::vector<std::ptrdiff_t>& parents
-) {
-    return spspEdges(g, DefaultSubgraphMask<>(), vs, vt, path, parents);
-}
-    
-template<class GRAPH>
-inline bool
-spspEdges(
-    const GRAPH& g,
-    const std::size_t vs,
-    const std::size_t vt,
-    std::deque<std::size_t>& path
+    SearchWorkspace<VALUE, QUEUE_TAG>& workspace
 ) {
-    std::vector<std::ptrdiff_t> parents = std::vector<std::ptrdiff_t>();
-    return spspEdges(g, DefaultSubgraphMask<>(), vs, vt, path, parents);
+    return spsp(g, DefaultSubgraphMask<>(), vs, vt, path, workspace, g.numberOfEdges());
 }
-    
-/// Search for a shortest path from one to another vertex in an **unweighted subgraph** using breadth-first-search.
-///
-/// This function works for both undirected and directed graphs. It carries out
-/// breadth-first searches from the source vertex vs and the target vertex vt,
-/// alternating between the two search trees, until these trees meet and thus,
-/// a shortest path from vs to vt has been found.
+
+/// Search for a shortest path from one to another vertex in an **unweighted subgraph** using breadth-first-search, with a reusable workspace.
 ///
 /// \param g A graph class such as andres::Graph or andres::Digraph.
 /// \param mask A subgraph mask such as DefaultSubgraphMask.
 /// \param vs The source vertex.
 /// \param vt The target vertex.
-/// \param path A double-ended queue to which the path (in edges) is written.
+/// \param path A double-ended queue to which the path is written.
+/// \param workspace Workspace, reusable across searches without being reset.
 /// \return true if a (shortest) path was found, false otherwise.
 ///
-template<class GRAPH, class SUBGRAPH_MASK>
+template<class GRAPH, class SUBGRAPH_MASK, class VALUE, class QUEUE_TAG>
 inline bool
-spspEdges(
+spsp(
     const GRAPH& g,
     const SUBGRAPH_MASK& mask,
     const std::size_t vs,
     const std::size_t vt,
-    std::deque<std::size_t>& path
+    std::deque<std::size_t>& path,
+    SearchWorkspace<VALUE, QUEUE_TAG>& workspace
 ) {
-    std::vector<std::ptrdiff_t> parents = std::vector<std::ptrdiff_t>();
-    return spspEdges(g, mask, vs, vt, path, parents);
+    return spsp(g, mask, vs, vt, path, workspace, g.numberOfEdges());
 }
 
-/// Search for a shortest path from one to another vertex in an **unweighted subgraph** using breadth-first-search.
+/// Search for a shortest path from one to another vertex in an **unweighted subgraph** using breadth-first-search, with a reusable workspace.
 ///
-/// This function works for both undirected and directed graphs. It carries out
-/// breadth-first searches from the source vertex vs and the target vertex vt, 
-/// alternating between the two search trees, until these trees meet and thus, 
-/// a shortest path from vs to vt has been found.
+/// This function works like the one with an external buffer of parents.
+/// Instead of initializing the parents of all vertices, it starts a new
+/// search in the workspace, so that the search costs time only in the
+/// number of vertices and edges it visits. This is more efficient when many
+/// short searches are performed on the same graph.
 ///
 /// \param g A graph class such as andres::Graph or andres::Digraph.
 /// \param mask A subgraph mask such as DefaultSubgraphMask.
 /// \param vs The source vertex.
 /// \param vt The target vertex.
-/// \param path A double-ended queue to which the path (in edges) is written.
-/// \param parents An optional external buffer.
+/// \param path A double-ended queue to which the path is written.
+/// \param workspace Workspace, reusable across searches without being reset.
+/// \param max_length Upper bound on the shortest path length
 /// \return true if a (shortest) path was found, false otherwise.
 ///
-template<class GRAPH, class SUBGRAPH_MASK>
+template<class GRAPH, class SUBGRAPH_MASK, class VALUE, class QUEUE_TAG>
 inline bool
-spspEdges(
+spsp(
     const GRAPH& g,
     const SUBGRAPH_MASK& mask,
     const std::size_t vs,
     const std::size_t vt,
-    std::deque<std::size_t>& path, // sequence of edges
-    std::vector<std::ptrdiff_t>& parents // sequence of edges
+    std::deque<std::size_t>& path,
+    SearchWorkspace<VALUE, QUEUE_TAG>& workspace,
+    const std::size_t max_length
 ) {
     path.clear();
-    if(!mask.vertex(vs) || !mask.vertex(vt)) {
+    if(!detail::isVertexInSubgraph(mask, vs) || !detail::isVertexInSubgraph(mask, vt)) {
+        return false;
+    }
+    if(vs == vt) {
+        path.push_back(vs);
+        return true;
+    }
+    workspace.startSearch(g.numberOfVertices());
+    std::vector<std::ptrdiff_t>& parents = workspace.parents_;
+    std::vector<std::size_t>* queues = workspace.queues_;
+    workspace.markVisited(vs);
+    workspace.markVisited(vt);
+    parents[vs] = vs + 1;
+    parents[vt] = -static_cast<std::ptrdiff_t>(vt) - 1;
+    queues[0].push_back(vs);
+    queues[1].push_back(vt);
+    std::size_t heads[2] = {0, 0};
+    size_t length = 0;
+    for(std::size_t q = 0; true; q = 1 - q) { // infinite loop, alternating queues
+        length++;
+        if (length > max_length)
+            return false;
+        const std::size_t numberOfNodesUpToFront = queues[q].size();
+        for(; heads[q] < numberOfNodesUpToFront; ++heads[q]) {
+            const std::size_t v = queues[q][heads[q]];
+            typename GRAPH::AdjacencyIterator it;
+            typename GRAPH::AdjacencyIterator end;
+            if(q == 0) {
+                it = g.adjacenciesFromVertexBegin(v);
+                end = g.adjacenciesFromVertexEnd(v);
+            }
+            else {
+                it = g.adjacenciesToVertexBegin(v);
+                end = g.adjacenciesToVertexEnd(v);
+            }
+            for(; it != end; ++it) {
+                if(!detail::isEdgeInSubgraph(mask, it->edge()) || !detail::isVertexInSubgraph(mask, it->vertex())) {
+                    continue;
+                }
+                if(!workspace.isVisited(it->vertex())) {
+                    workspace.markVisited(it->vertex());
+                    if(q == 0) {
+                        parents[it->vertex()] = v + 1;
+                    }
+                    else {
+                        parents[it->vertex()] = -static_cast<std::ptrdiff_t>(v) - 1;
+                    }
+                    queues[q].push_back(it->vertex());
+                }
+                else if(parents[it->vertex()] < 0 && q == 0) {
+                    graph_detail::spspHelper(parents, v, it->vertex(), path);
+                    assert(path[0] == vs);
+                    assert(path.back() == vt);
+                    return true;
+                }
+                else if(parents[it->vertex()] > 0 && q == 1) {
+                    graph_detail::spspHelper(parents, it->vertex(), v, path);
+                    assert(path[0] == vs);
+                    assert(path.back() == vt);
+                    return true;
+                }
+            }
+        }
+        if(heads[0] == queues[0].size() && heads[1] == queues[1].size()) {
+            return false;
+        }
+    }
+}
+
+/// Search for a shortest path from one to another vertex in a graph with **non-negative edge weights** using Dijkstra's algorithm, with a reusable workspace.
+///
+/// \param g A graph class such as andres::Graph or andres::Digraph.
+/// \param vs Source vertex.
+/// \param vt Target vertex.
+/// \param edgeWeights A random access iterator pointing to positive edge weights.
+/// \param path A double-ended queue to which the path is written.
+/// \param distance the distance to from the source to the target vertex (if there exists a path).
+///     if no path is found, path.size() == 0.
+/// \param workspace Workspace, reusable across searches without being reset.
+///
+template<class GRAPH, class EDGE_VALUE_ITERATOR, class T, class QUEUE_TAG>
+inline void
+spsp(
+    const GRAPH& g,
+    const std::size_t vs,
+    const std::size_t vt,
+    EDGE_VALUE_ITERATOR edgeWeights,
+    std::deque<std::size_t>& path,
+    T& distance,
+    SearchWorkspace<T, QUEUE_TAG>& workspace
+) {
+    spsp(g, DefaultSubgraphMask<>(), vs, vt, edgeWeights, path, distance, workspace);
+}
+
+/// Search for a shortest path from one to another vertex in a **subgraph** with **non-negative edge weights** using Dijkstra's algorithm, with a reusable workspace.
+///
+/// This function carries out a bidirectional Dijkstra search from vs along
+/// outgoing edges and from vt along incoming edges, until the sum of the
+/// smallest tentative distances in both directions is no less than the
+/// length of the shortest path found through a vertex reached from both
+/// sides. Typically, this settles far fewer vertices than a search from vs
+/// alone. Only the vertices reached are visited, and the workspace need not
+/// be reset between searches.
+///
+/// \param g A graph class such as andres::Graph or andres::Digraph.
+/// \param mask A subgraph mask such as DefaultSubgraphMask.
+/// \param vs Source vertex.
+/// \param vt Target vertex.
+/// \param edgeWeights A random access iterator pointing to positive edge weights.
+/// \param path A double-ended queue to which the path is written.
+/// \param distance the distance to from the source to the target vertex (if there exists a path).
+///     if no path is found, path.size() == 0.
+/// \param workspace Workspace, reusable across searches without being reset.
+///
+template<class GRAPH, class SUBGRAPH_MASK, class EDGE_VALUE_ITERATOR, class T, class QUEUE_TAG>
+inline void
+spsp(
+    const GRAPH& g,
+    const SUBGRAPH_MASK& mask,
+    const std::size_t vs,
+    const std::size_t vt,
+    EDGE_VALUE_ITERATOR edgeWeights,
+    std::deque<std::size_t>& path,
+    T& distance,
+    SearchWorkspace<T, QUEUE_TAG>& workspace
+) {
+    path.clear();
+    const std::size_t meetingVertex = graph_detail::bidirectionalDijkstra(g, mask, vs, vt, edgeWeights, workspace, distance);
+    if(distance != workspace.infinity()) {
+        for(std::size_t v = meetingVertex; v != vs; v = workspace.parents_[v]) {
+            path.push_front(v);
+        }
+        path.push_front(vs);
+        for(std::size_t v = meetingVertex; v != vt; ) {
+            v = workspace.backwardParents_[v];
+            path.push_back(v);
+        }
+    }
+}
+
+/// Search for a shortest path from one to another vertex in a **grid graph** with **non-negative edge weights** using the A* algorithm, with a reusable workspace.
+///
+/// \param g A grid graph.
+/// \param vs Source vertex.
+/// \param vt Target vertex.
+/// \param edgeWeights A random access iterator pointing to positive edge weights.
+/// \param path A double-ended queue to which the path is written.
+/// \param distance the distance to from the source to the target vertex (if there exists a path).
+///     if no path is found, path.size() == 0.
+/// \param workspace Workspace, reusable across searches without being reset.
+/// \param minimumEdgeWeight A lower bound on all edge weights.
+///
+template<unsigned char D, class VISITOR, class EDGE_VALUE_ITERATOR, class T, class QUEUE_TAG>
+inline void
+spsp(
+    const GridGraph<D, VISITOR>& g,
+    const std::size_t vs,
+    const std::size_t vt,
+    EDGE_VALUE_ITERATOR edgeWeights,
+    std::deque<std::size_t>& path,
+    T& distance,
+    SearchWorkspace<T, QUEUE_TAG>& workspace,
+    const T minimumEdgeWeight
+) {
+    spsp(g, DefaultSubgraphMask<>(), vs, vt, edgeWeights, path, distance, workspace, minimumEdgeWeight);
+}
+
+/// Search for a shortest path from one to another vertex in a **subgraph** of a **grid graph** with **non-negative edge weights** using the A* algorithm, with a reusable workspace.
+///
+/// Hart P. E., Nilsson N. J. and Raphael B. (1968). A formal basis for the
+/// heuristic determination of minimum cost paths. IEEE Transactions on
+/// Systems Science and Cybernetics 4(2):100-107.
+///
+/// Every path from a vertex to vt has at least as many edges as the
+/// Manhattan distance between their coordinates. Multiplied by a lower
+/// bound on the edge weights, this is a consistent estimate of the
+/// remaining distance, by which the search is directed toward vt. With a
+/// minimum edge weight of 0, the search is Dijkstra's algorithm.
+/// Adjacencies are enumerated from the stencil of the grid graph. For
+/// integral edge weights, a workspace with RadixHeapTag or BucketQueueTag
+/// can be used, since the keys, estimated distances, are monotone.
+///
+/// \param g A grid graph.
+/// \param mask A subgraph mask such as DefaultSubgraphMask.
+/// \param vs Source vertex.
+/// \param vt Target vertex.
+/// \param edgeWeights A random access iterator pointing to positive edge weights.
+/// \param path A double-ended queue to which the path is written.
+/// \param distance the distance to from the source to the target vertex (if there exists a path).
+///     if no path is found, path.size() == 0.
+/// \param workspace Workspace, reusable across searches without being reset.
+/// \param minimumEdgeWeight A lower bound on the weights of all edges of the subgraph.
+///
+template<unsigned char D, class VISITOR, class SUBGRAPH_MASK, class EDGE_VALUE_ITERATOR, class T, class QUEUE_TAG>
+inline void
+spsp(
+    const GridGraph<D, VISITOR>& g,
+    const SUBGRAPH_MASK& mask,
+    const std::size_t vs,
+    const std::size_t vt,
+    EDGE_VALUE_ITERATOR edgeWeights,
+    std::deque<std::size_t>& path,
+    T& distance,
+    SearchWorkspace<T, QUEUE_TAG>& workspace,
+    const T minimumEdgeWeight
+) {
+    path.clear();
+    if(graph_detail::aStar(g, mask, vs, vt, edgeWeights, minimumEdgeWeight, workspace)) {
+        for(std::size_t v = vt; v != vs; v = workspace.parents_[v]) {
+            path.push_front(v);
+        }
+        path.push_front(vs);
+    }
+    distance = workspace.distance(vt);
+}
+
+/// Search for shortest paths from a given vertex to every other vertex in an **unweighted** graph using breadth-first search, with a reusable workspace.
+///
+/// \param g A graph class such as andres::Graph or andres::Digraph.
+/// \param vs Source vertex.
+/// \param workspace Workspace to which distances and parents are written.
+///
+template<class GRAPH, class VALUE, class QUEUE_TAG>
+inline void
+sssp(
+    const GRAPH& g,
+    const std::size_t vs,
+    SearchWorkspace<VALUE, QUEUE_TAG>& workspace
+) {
+    sssp(g, DefaultSubgraphMask<>(), vs, workspace);
+}
+
+/// Search for shortest paths from a given vertex to every other vertex in an **unweighted** **subgraph** using breadth-first search, with a reusable workspace.
+///
+/// Only the vertices reachable from vs are visited. Their distances and
+/// parents are queried from the workspace, and all other vertices have
+/// distance SearchWorkspace::infinity().
+///
+/// \param g A graph class such as andres::Graph or andres::Digraph.
+/// \param mask A subgraph mask such as DefaultSubgraphMask.
+/// \param vs Source vertex.
+/// \param workspace Workspace to which distances and parents are written.
+///
+template<class GRAPH, class SUBGRAPH_MASK, class VALUE, class QUEUE_TAG>
+inline void
+sssp(
+    const GRAPH& g,
+    const SUBGRAPH_MASK& mask,
+    const std::size_t vs,
+    SearchWorkspace<VALUE, QUEUE_TAG>& workspace
+) {
+    assert(detail::isVertexInSubgraph(mask, vs));
+    workspace.startSearch(g.numberOfVertices());
+    std::vector<std::size_t>& queue = workspace.queues_[0];
+    workspace.markVisited(vs);
+    workspace.distances_[vs] = VALUE();
+    workspace.parents_[vs] = vs;
+    queue.push_back(vs);
+    for(std::size_t head = 0; head < queue.size(); ++head) {
+        const std::size_t v = queue[head];
+        forEachAdjacency(g, v, [&](const typename GRAPH::AdjacencyType& a) {
+            const std::size_t w = a.vertex();
+            if(!workspace.isVisited(w)
+            && detail::isVertexInSubgraph(mask, w)
+            && detail::isEdgeInSubgraph(mask, a.edge())) {
+                workspace.markVisited(w);
+                workspace.distances_[w] = workspace.distances_[v] + 1;
+                workspace.parents_[w] = v;
+                workspace.parentEdges_[w] = a.edge();
+                queue.push_back(w);
+            }
+        });
+    }
+}
+
+/// Search for shortest paths from a given vertex to every other vertex in a graph with **non-negative edge weights** using Dijkstra's algorithm, with a reusable workspace.
+///
+/// \param g A graph class such as andres::Graph or andres::Digraph.
+/// \param vs Source vertex.
+/// \param edgeWeights A random access iterator pointing to positive edge weights.
+/// \param workspace Workspace to which distances and parents are written.
+///
+template<class GRAPH, class EDGE_VALUE_ITERATOR, class VALUE, class QUEUE_TAG>
+inline void
+sssp(
+    const GRAPH& g,
+    const std::size_t vs,
+    const EDGE_VALUE_ITERATOR edgeWeights,
+    SearchWorkspace<VALUE, QUEUE_TAG>& workspace
+) {
+    sssp(g, DefaultSubgraphMask<>(), vs, edgeWeights, workspace);
+}
+
+/// Search for shortest paths from a given vertex to every other vertex in a **subgraph** with **non-negative edge weights** using Dijkstra's algorithm, with a reusable workspace.
+///
+/// Only the vertices reachable from vs are visited. Their distances and
+/// parents are queried from the workspace, and all other vertices have
+/// distance SearchWorkspace::infinity().
+///
+/// \param g A graph class such as andres::Graph or andres::Digraph.
+/// \param mask A subgraph mask such as DefaultSubgraphMask.
+/// \param vs Source vertex.
+/// \param edgeWeights A random access iterator pointing to positive edge weights.
+/// \param workspace Workspace to which distances and parents are written.
+///
+template<class GRAPH, class SUBGRAPH_MASK, class EDGE_VALUE_ITERATOR, class VALUE, class QUEUE_TAG>
+inline void
+sssp(
+    const GRAPH& g,
+    const SUBGRAPH_MASK& mask,
+    const std::size_t vs,
+    const EDGE_VALUE_ITERATOR edgeWeights,
+    SearchWorkspace<VALUE, QUEUE_TAG>& workspace
+) {
+    graph_detail::dijkstra(g, mask, vs, g.numberOfVertices(), edgeWeights, workspace);
+}
+
+/// Construct buffers of the parallel delta-stepping algorithm.
+///
+/// \param delta Width of the buckets, a positive number. Edges whose weight
+///     exceeds delta are relaxed only once per bucket. For random edge
+///     weights, a good choice is the largest weight divided by the average
+///     degree.
+/// \param numberOfThreads Number of threads, 0 for the default of OpenMP.
+///
+template<class VALUE>
+inline
+DeltaSteppingBuffers<VALUE>::DeltaSteppingBuffers(
+    const Value delta,
+    const std::size_t numberOfThreads
+)
+:   delta_(delta),
+    numberOfThreads_(numberOfThreads),
+    numberOfVertices_(0),
+    distances_(),
+    flags_(),
+    buckets_(),
+    vertices_(),
+    frontier_()
+{}
+
+/// Allocate the buffers for a graph, if necessary.
+///
+/// \param numberOfVertices Number of vertices of the graph to be searched.
+/// \return Number of threads to be used.
+///
+template<class VALUE>
+inline int
+DeltaSteppingBuffers<VALUE>::startSearch(
+    const std::size_t numberOfVertices
+) {
+    if(numberOfVertices_ < numberOfVertices) {
+        distances_.reset(new std::atomic<Value>[numberOfVertices]);
+        flags_.reset(new std::atomic<bool>[numberOfVertices]);
+        for(std::size_t v = 0; v < numberOfVertices; ++v) {
+            flags_[v].store(false, std::memory_order_relaxed);
+        }
+        numberOfVertices_ = numberOfVertices;
+    }
+#ifdef _OPENMP
+    const int numberOfThreads = numberOfThreads_ != 0 ? static_cast<int>(numberOfThreads_) : omp_get_max_threads();
+#else
+    const int numberOfThreads = 1;
+#endif
+    buckets_.resize(numberOfThreads);
+    vertices_.resize(numberOfThreads);
+    return numberOfThreads;
+}
+
+/// Search for shortest paths from a given vertex to every other vertex in a graph with **non-negative edge weights** using the parallel delta-stepping algorithm.
+///
+/// \param g A graph class such as andres::Graph or andres::Digraph.
+/// \param vs Source vertex.
+/// \param edgeWeights A random access iterator pointing to positive edge weights.
+/// \param distances Random access iterator pointing to distances
+/// \param parents Random access iterator pointing to parent vertices
+/// \param buffers Parameters and buffers, reusable across searches.
+///
+template<class GRAPH, class EDGE_VALUE_ITERATOR, class DISTANCE_ITERATOR, class PARENT_ITERATOR, class VALUE>
+inline void
+sssp(
+    const GRAPH& g,
+    const std::size_t vs,
+    const EDGE_VALUE_ITERATOR edgeWeights,
+    DISTANCE_ITERATOR distances,
+    PARENT_ITERATOR parents,
+    DeltaSteppingBuffers<VALUE>& buffers
+) {
+    sssp(g, DefaultSubgraphMask<>(), vs, edgeWeights, distances, parents, buffers);
+}
+
+/// Search for shortest paths from a given vertex to every other vertex in a **subgraph** with **non-negative edge weights** using the parallel delta-stepping algorithm.
+///
+/// Meyer U. and Sanders P. (2003). Delta-stepping: a parallelizable shortest
+/// path algorithm. Journal of Algorithms 49(1):114-152.
+///
+/// Tentative distances are kept in buckets of width delta. The vertices of
+/// the first non-empty bucket are processed in parallel, relaxing their
+/// light edges, of weight at most delta, until the bucket remains empty.
+/// Then, the heavy edges of all vertices removed from the bucket are
+/// relaxed in parallel. Each thread inserts vertices into buckets of its
+/// own, and distances are decreased by atomic compare-and-swap. Finally,
+/// the parent of each vertex is chosen among the vertices from which an
+/// edge completes a shortest path.
+///
+/// Only floor(w/delta) + 2 buckets per thread are kept, where w is the
+/// largest edge weight, and these are used cyclically. An edge whose weight
+/// exceeds delta but which, due to rounding, leads into the current bucket
+/// is treated as light.
+///
+/// The work is O(|E| + |V|) for random edge weights and a suitable delta,
+/// and the vertices of a bucket are processed in parallel if OpenMP is
+/// enabled. Distances of vertices that are not reached are infinite, or the
+/// largest value if the type has no infinity, and their parents are left
+/// unchanged, as is the parent of vs.
+///
+/// \param g A graph class such as andres::Graph or andres::Digraph.
+/// \param mask A subgraph mask such as DefaultSubgraphMask.
+/// \param vs Source vertex.
+/// \param edgeWeights A random access iterator pointing to positive edge weights.
+/// \param distances Random access iterator pointing to distances
+/// \param parents Random access iterator pointing to parent vertices
+/// \param buffers Parameters and buffers, reusable across searches.
+///
+template<class GRAPH, class SUBGRAPH_MASK, class EDGE_VALUE_ITERATOR, class DISTANCE_ITERATOR, class PARENT_ITERATOR, class VALUE>
+inline void
+sssp(
+    const GRAPH& g,
+    const SUBGRAPH_MASK& mask,
+    const std::size_t vs,
+    const EDGE_VALUE_ITERATOR edgeWeights,
+    DISTANCE_ITERATOR distances,
+    PARENT_ITERATOR parents,
+    DeltaSteppingBuffers<VALUE>& buffers
+) {
+    typedef VALUE Value;
+
+    assert(detail::isVertexInSubgraph(mask, vs));
+    assert(Value() < buffers.delta_);
+    const Value delta = buffers.delta_;
+    const Value infinity = std::numeric_limits<Value>::has_infinity
+        ? std::numeric_limits<Value>::infinity()
+        : std::numeric_limits<Value>::max();
+    const std::ptrdiff_t numberOfVertices = g.numberOfVertices();
+    const int numberOfThreads = buffers.startSearch(numberOfVertices);
+    std::atomic<Value>* tentative = buffers.distances_.get();
+    std::atomic<bool>* flags = buffers.flags_.get();
+    std::vector<std::size_t>& frontier = buffers.frontier_;
+
+    // index of the bucket of a distance, used for all bucket tests
+    auto bucketIndex = [delta](const Value d) {
+        return static_cast<std::size_t>(d / delta);
+    };
+
+    // while bucket i is processed, all finite tentative distances are in
+    // buckets i to i + floor(w/delta) + 1, for the largest edge weight w
+    Value maximumWeight = Value();
+    for(std::size_t e = 0; e < g.numberOfEdges(); ++e) {
+        if(maximumWeight < edgeWeights[e] && detail::isEdgeInSubgraph(mask, e)) {
+            maximumWeight = edgeWeights[e];
+        }
+    }
+    const std::size_t numberOfBuckets = bucketIndex(maximumWeight) + 2;
+    for(int t = 0; t < numberOfThreads; ++t) {
+        buffers.buckets_[t].resize(numberOfBuckets); // all empty between searches
+    }
+
+#pragma omp parallel for num_threads(numberOfThreads)
+    for(std::ptrdiff_t v = 0; v < numberOfVertices; ++v) {
+        tentative[v].store(infinity, std::memory_order_relaxed);
+    }
+    tentative[vs].store(Value(), std::memory_order_relaxed);
+    buffers.buckets_[0][0].push_back(vs);
+
+    std::size_t i = 0; // index of the current bucket, not taken modulo numberOfBuckets
+
+    // decrease the tentative distance of w to d, if d is smaller, and insert
+    // w into the bucket of d that belongs to the calling thread
+    auto relax = [&](const std::size_t thread, const std::size_t w, const Value d) {
+        Value old = tentative[w].load(std::memory_order_relaxed);
+        while(d < old) {
+            if(tentative[w].compare_exchange_weak(old, d, std::memory_order_relaxed)) {
+                const std::size_t j = bucketIndex(d);
+                assert(i <= j && j < i + numberOfBuckets);
+                buffers.buckets_[thread][j % numberOfBuckets].push_back(w);
+                break;
+            }
+        }
+    };
+
+    for(;; ++i) {
+        // find the first non-empty bucket among the next numberOfBuckets
+        std::size_t k = 0;
+        for(; k < numberOfBuckets; ++k, ++i) {
+            bool empty = true;
+            for(int t = 0; t < numberOfThreads; ++t) {
+                if(!buffers.buckets_[t][i % numberOfBuckets].empty()) {
+                    empty = false;
+                    break;
+                }
+            }
+            if(!empty) {
+                break;
+            }
+        }
+        if(k == numberOfBuckets) {
+            break;
+        }
+
+        // relax light edges until the bucket remains empty
+        for(;;) {
+            frontier.clear();
+            for(int t = 0; t < numberOfThreads; ++t) {
+                std::vector<std::size_t>& bucket = buffers.buckets_[t][i % numberOfBuckets];
+                frontier.insert(frontier.end(), bucket.begin(), bucket.end());
+                bucket.clear();
+            }
+            if(frontier.empty()) {
+                break;
+            }
+            const std::ptrdiff_t frontierSize = frontier.size();
+#pragma omp parallel num_threads(numberOfThreads)
+            {
+#ifdef _OPENMP
+                const std::size_t thread = omp_get_thread_num();
+#else
+                const std::size_t thread = 0;
+#endif
+#pragma omp for schedule(dynamic, 64)
+                for(std::ptrdiff_t j = 0; j < frontierSize; ++j) {
+                    const std::size_t v = frontier[j];
+                    const Value d = tentative[v].load(std::memory_order_relaxed);
+                    if(bucketIndex(d) != i) {
+                        continue; // moved to a bucket of lower index and processed before
+                    }
+                    if(!flags[v].exchange(true, std::memory_order_relaxed)) {
+                        buffers.vertices_[thread].push_back(v);
+                    }
+                    forEachAdjacency(g, v, [&](const typename GRAPH::AdjacencyType& a) {
+                        const Value weight = edgeWeights[a.edge()];
+                        if((!(delta < weight) || bucketIndex(d + weight) == i) && detail::isVertexInSubgraph(mask, a.vertex()) && detail::isEdgeInSubgraph(mask, a.edge())) {
+                            relax(thread, a.vertex(), d + weight);
+                        }
+                    });
+                }
+            }
+        }
+
+        // relax heavy edges of all vertices removed from the bucket, whose
+        // distances are now final, except those relaxed as light edges
+        frontier.clear();
+        for(int t = 0; t < numberOfThreads; ++t) {
+            frontier.insert(frontier.end(), buffers.vertices_[t].begin(), buffers.vertices_[t].end());
+            buffers.vertices_[t].clear();
+        }
+        const std::ptrdiff_t frontierSize = frontier.size();
+#pragma omp parallel num_threads(numberOfThreads)
+        {
+#ifdef _OPENMP
+            const std::size_t thread = omp_get_thread_num();
+#else
+            const std::size_t thread = 0;
+#endif
+#pragma omp for schedule(dynamic, 64)
+            for(std::ptrdiff_t j = 0; j < frontierSize; ++j) {
+                const std::size_t v = frontier[j];
+                flags[v].store(false, std::memory_order_relaxed);
+                const Value d = tentative[v].load(std::memory_order_relaxed);
+                forEachAdjacency(g, v, [&](const typename GRAPH::AdjacencyType& a) {
+                    const Value weight = edgeWeights[a.edge()];
+                    if(delta < weight && bucketIndex(d + weight) != i && detail::isVertexInSubgraph(mask, a.vertex()) && detail::isEdgeInSubgraph(mask, a.edge())) {
+                        relax(thread, a.vertex(), d + weight);
+                    }
+                });
+            }
+        }
+    }
+
+#pragma omp parallel for num_threads(numberOfThreads)
+    for(std::ptrdiff_t v = 0; v < numberOfVertices; ++v) {
+        distances[v] = tentative[v].load(std::memory_order_relaxed);
+    }
+
+    // parents along edges that complete shortest paths. An edge from a
+    // vertex at smaller distance is taken if one exists. Otherwise, e.g. for
+    // edges of weight 0, an edge from a vertex whose parent has been chosen
+    // is taken, in rounds, so that no cycles are formed. Flags mark vertices
+    // whose parent has been chosen.
+    flags[vs].store(true, std::memory_order_relaxed);
+    frontier.clear();
+#pragma omp parallel num_threads(numberOfThreads)
+    {
+#ifdef _OPENMP
+        const std::size_t thread = omp_get_thread_num();
+#else
+        const std::size_t thread = 0;
+#endif
+#pragma omp for schedule(dynamic, 1024)
+        for(std::ptrdiff_t v = 0; v < numberOfVertices; ++v) {
+            const Value d = tentative[v].load(std::memory_order_relaxed);
+            if(static_cast<std::size_t>(v) == vs || d == infinity) {
+                continue;
+            }
+            bool found = false;
+            for(typename GRAPH::AdjacencyIterator it = g.adjacenciesToVertexBegin(v);
+            it != g.adjacenciesToVertexEnd(v); ++it) {
+                const std::size_t u = it->vertex();
+                const Value du = tentative[u].load(std::memory_order_relaxed);
+                if(du < d && du + edgeWeights[it->edge()] == d
+                && detail::isVertexInSubgraph(mask, u) && detail::isEdgeInSubgraph(mask, it->edge())) {
+                    parents[v] = u;
+                    found = true;
+                    break;
+                }
+            }
+            if(found) {
+                flags[v].store(true, std::memory_order_release);
+            }
+            else {
+                buffers.vertices_[thread].push_back(v);
+            }
+        }
+    }
+    for(int t = 0; t < numberOfThreads; ++t) {
+        frontier.insert(frontier.end(), buffers.vertices_[t].begin(), buffers.vertices_[t].end());
+        buffers.vertices_[t].clear();
+    }
+    while(!frontier.empty()) {
+        const std::ptrdiff_t frontierSize = frontier.size();
+#pragma omp parallel num_threads(numberOfThreads)
+        {
+#ifdef _OPENMP
+            const std::size_t thread = omp_get_thread_num();
+#else
+            const std::size_t thread = 0;
+#endif
+#pragma omp for schedule(dynamic, 64)
+            for(std::ptrdiff_t j = 0; j < frontierSize; ++j) {
+                const std::size_t v = frontier[j];
+                const Value d = tentative[v].load(std::memory_order_relaxed);
+                bool found = false;
+                for(typename GRAPH::AdjacencyIterator it = g.adjacenciesToVertexBegin(v);
+                it != g.adjacenciesToVertexEnd(v); ++it) {
+                    const std::size_t u = it->vertex();
+                    if(flags[u].load(std::memory_order_acquire)
+                    && tentative[u].load(std::memory_order_relaxed) + edgeWeights[it->edge()] == d
+                    && detail::isVertexInSubgraph(mask, u) && detail::isEdgeInSubgraph(mask, it->edge())) {
+                        parents[v] = u;
+                        found = true;
+                        break;
+                    }
+                }
+                if(found) {
+                    flags[v].store(true, std::memory_order_release);
+                }
+                else {
+                    buffers.vertices_[thread].push_back(v);
+                }
+            }
+        }
+        frontier.clear();
+        for(int t = 0; t < numberOfThreads; ++t) {
+            frontier.insert(frontier.end(), buffers.vertices_[t].begin(), buffers.vertices_[t].end());
+            buffers.vertices_[t].clear();
+        }
+        if(static_cast<std::ptrdiff_t>(frontier.size()) == frontierSize) {
+            assert(false); // every vertex reached has a parent on a shortest path
+            break;
+        }
+    }
+
+#pragma omp parallel for num_threads(numberOfThreads)
+    for(std::ptrdiff_t v = 0; v < numberOfVertices; ++v) {
+        flags[v].store(false, std::memory_order_relaxed);
+    }
+    for(int t = 0; t < numberOfThreads; ++t) {
+        buffers.buckets_[t].clear();
+    }
+}
+
+// edge output versions below.
+
+/// Search for a shortest path from one to another vertex in an **unweighted** graph using breadth-first-search.
+///
+/// This function works for both undirected and directed graphs. It carries out
+/// breadth-first searches from the source vertex vs and the target vertex vt,
+/// alternating between the two search trees, until these trees meet and thus,
+/// a shortest path from vs to vt has been found.
+///
+/// \param g A graph class such as andres::Graph or andres::Digraph.
+/// \param vs The source vertex.
+/// \param vt The target vertex.
+/// \param path A double-ended queue to which the path (in edges) is written.
+/// \param parents An optional external buffer.
+/// \return true if a (shortest) path was found, false otherwise.
+///
+template<class GRAPH>
+inline bool
+spspEdges(
+    const GRAPH& g,
+    const std::size_t vs,
+    const std::size_t vt,
+    std::deque<std::size_t>& path,
+    std::vector<std::ptrdiff_t>& parents
+) {
+    return spspEdges(g, DefaultSubgraphMask<>(), vs, vt, path, parents);
+}
+    
+template<class GRAPH>
+inline bool
+spspEdges(
+    const GRAPH& g,
+    const std::size_t vs,
+    const std::size_t vt,
+    std::deque<std::size_t>& path
+) {
+    std::vector<std::ptrdiff_t> parents = std::vector<std::ptrdiff_t>();
+    return spspEdges(g, DefaultSubgraphMask<>(), vs, vt, path, parents);
+}
+    
+/// Search for a shortest path from one to another vertex in an **unweighted subgraph** using breadth-first-search.
+///
+/// This function works for both undirected and directed graphs. It carries out
+/// breadth-first searches from the source vertex vs and the target vertex vt,
+/// alternating between the two search trees, until these trees meet and thus,
+/// a shortest path from vs to vt has been found.
+///
+/// \param g A graph class such as andres::Graph or andres::Digraph.
+/// \param mask A subgraph mask such as DefaultSubgraphMask.
+/// \param vs The source vertex.
+/// \param vt The target vertex.
+/// \param path A double-ended queue to which the path (in edges) is written.
+/// \return true if a (shortest) path was found, false otherwise.
+///
+template<class GRAPH, class SUBGRAPH_MASK>
+inline bool
+spspEdges(
+    const GRAPH& g,
+    const SUBGRAPH_MASK& mask,
+    const std::size_t vs,
+    const std::size_t vt,
+    std::deque<std::size_t>& path
+) {
+    std::vector<std::ptrdiff_t> parents = std::vector<std::ptrdiff_t>();
+    return spspEdges(g, mask, vs, vt, path, parents);
+}
+
+/// Search for a shortest path from one to another vertex in an **unweighted subgraph** using breadth-first-search.
+///
+/// This function works for both undirected and directed graphs. It carries out
+/// breadth-first searches from the source vertex vs and the target vertex vt, 
+/// alternating between the two search trees, until these trees meet and thus, 
+/// a shortest path from vs to vt has been found.
+///
+/// \param g A graph class such as andres::Graph or andres::Digraph.
+/// \param mask A subgraph mask such as DefaultSubgraphMask.
+/// \param vs The source vertex.
+/// \param vt The target vertex.
+/// \param path A double-ended queue to which the path (in edges) is written.
+/// \param parents An optional external buffer.
+/// \return true if a (shortest) path was found, false otherwise.
+///
+template<class GRAPH, class SUBGRAPH_MASK>
+inline bool
+spspEdges(
+    const GRAPH& g,
+    const SUBGRAPH_MASK& mask,
+    const std::size_t vs,
+    const std::size_t vt,
+    std::deque<std::size_t>& path, // sequence of edges
+    std::vector<std::ptrdiff_t>& parents // sequence of edges
+) {
+    path.clear();
+    if(!detail::isVertexInSubgraph(mask, vs) || !detail::isVertexInSubgraph(mask, vt)) {
         return false;
     }
     if(vs == vt) {
         return true;
     }
     for (typename GRAPH::AdjacencyIterator i = g.adjacenciesFromVertexBegin(vs); i < g.adjacenciesFromVertexEnd(vs) ; ++i) {
-        if (i->vertex() == vt && mask.edge(i->edge())) {
+        if (i->vertex() == vt && detail::isEdgeInSubgraph(mask, i->edge())) {
             path.push_front(i->edge());
             return true;
         }
@@ -1279,13 +2414,13 @@ spspEdges(
     std::fill(parents.begin(), parents.end(), 0);
     std::queue<std::size_t> queues[2];
     for (typename GRAPH::AdjacencyIterator i = g.adjacenciesFromVertexBegin(vs); i < g.adjacenciesFromVertexEnd(vs) ; ++i) {
-        if (mask.edge(i->edge()) && mask.vertex(i->vertex())) {
+        if (detail::isEdgeInSubgraph(mask, i->edge()) && detail::isVertexInSubgraph(mask, i->vertex())) {
             queues[0].push(i->edge());
             parents[i->edge()] = i->edge() + 1;
         }        
     }
     for (typename GRAPH::AdjacencyIterator i = g.adjacenciesToVertexBegin(vt); i < g.adjacenciesToVertexEnd(vt) ; ++i) {
-        if (mask.edge(i->edge()) && mask.vertex(i->vertex())) {
+        if (detail::isEdgeInSubgraph(mask, i->edge()) && detail::isVertexInSubgraph(mask, i->vertex())) {
         queues[1].push(i->edge());
         parents[i->edge()] = -static_cast<std::ptrdiff_t>(i->edge()) - 1;
         }
@@ -1306,7 +2441,7 @@ spspEdges(
                 end = g.adjacenciesToVertexEnd(g.vertexOfEdge(e, 0));
             }
             for(; it != end; ++it) {
-                if(!mask.edge(it->edge()) || !mask.vertex(it->vertex())) {
+                if(!detail::isEdgeInSubgraph(mask, it->edge()) || !detail::isVertexInSubgraph(mask, it->vertex())) {
                     continue;
                 }
                 if(parents[it->edge()] < 0 && q == 0) {
@@ -1334,6 +2469,143 @@ spspEdges(
     }
 }
 
+/// Search for a shortest path from one to another vertex in an **unweighted subgraph** using breadth-first-search, with a reusable workspace.
+///
+/// This function works like the one with an external buffer of parents,
+/// except that the workspace is not reset for all edges before the search.
+///
+/// \param g A graph class such as andres::Graph or andres::Digraph.
+/// \param mask A subgraph mask such as DefaultSubgraphMask.
+/// \param vs The source vertex.
+/// \param vt The target vertex.
+/// \param path A double-ended queue to which the path (in edges) is written.
+/// \param workspace Workspace, reusable across searches without being reset.
+/// \return true if a (shortest) path was found, false otherwise.
+///
+template<class GRAPH, class SUBGRAPH_MASK, class VALUE, class QUEUE_TAG>
+inline bool
+spspEdges(
+    const GRAPH& g,
+    const SUBGRAPH_MASK& mask,
+    const std::size_t vs,
+    const std::size_t vt,
+    std::deque<std::size_t>& path, // sequence of edges
+    SearchWorkspace<VALUE, QUEUE_TAG>& workspace
+) {
+    path.clear();
+    if(!detail::isVertexInSubgraph(mask, vs) || !detail::isVertexInSubgraph(mask, vt)) {
+        return false;
+    }
+    if(vs == vt) {
+        return true;
+    }
+    for (typename GRAPH::AdjacencyIterator i = g.adjacenciesFromVertexBegin(vs); i < g.adjacenciesFromVertexEnd(vs) ; ++i) {
+        if (i->vertex() == vt && detail::isEdgeInSubgraph(mask, i->edge())) {
+            path.push_front(i->edge());
+            return true;
+        }
+    }
+    // the workspace is indexed by edges
+    workspace.startSearch(g.numberOfEdges());
+    std::vector<std::ptrdiff_t>& parents = workspace.parents_;
+    std::vector<std::size_t>* queues = workspace.queues_;
+    for (typename GRAPH::AdjacencyIterator i = g.adjacenciesFromVertexBegin(vs); i < g.adjacenciesFromVertexEnd(vs) ; ++i) {
+        if (detail::isEdgeInSubgraph(mask, i->edge()) && detail::isVertexInSubgraph(mask, i->vertex())) {
+            queues[0].push_back(i->edge());
+            workspace.markVisited(i->edge());
+            parents[i->edge()] = i->edge() + 1;
+        }
+    }
+    for (typename GRAPH::AdjacencyIterator i = g.adjacenciesToVertexBegin(vt); i < g.adjacenciesToVertexEnd(vt) ; ++i) {
+        if (detail::isEdgeInSubgraph(mask, i->edge()) && detail::isVertexInSubgraph(mask, i->vertex())) {
+            queues[1].push_back(i->edge());
+            workspace.markVisited(i->edge());
+            parents[i->edge()] = -static_cast<std::ptrdiff_t>(i->edge()) - 1;
+        }
+    }
+    std::size_t heads[2] = {0, 0};
+    for(std::size_t q = 0; true; q = 1 - q) { // infinite loop, alternating queues
+        const std::size_t numberOfEdgesUpToFront = queues[q].size();
+        for(; heads[q] < numberOfEdgesUpToFront; ++heads[q]) {
+            const std::size_t e = queues[q][heads[q]];
+            typename GRAPH::AdjacencyIterator it;
+            typename GRAPH::AdjacencyIterator end;
+            if(q == 0) {
+                it = g.adjacenciesFromVertexBegin(g.vertexOfEdge(e, 1));
+                end = g.adjacenciesFromVertexEnd(g.vertexOfEdge(e, 1));
+            }
+            else {
+                it = g.adjacenciesToVertexBegin(g.vertexOfEdge(e, 0));
+                end = g.adjacenciesToVertexEnd(g.vertexOfEdge(e, 0));
+            }
+            for(; it != end; ++it) {
+                if(!detail::isEdgeInSubgraph(mask, it->edge()) || !detail::isVertexInSubgraph(mask, it->vertex())) {
+                    continue;
+                }
+                if(!workspace.isVisited(it->edge())) {
+                    workspace.markVisited(it->edge());
+                    if(q == 0) {
+                        parents[it->edge()] = e + 1;
+                    }
+                    else {
+                        parents[it->edge()] = -static_cast<std::ptrdiff_t>(e) - 1;
+                    }
+                    queues[q].push_back(it->edge());
+                }
+                else if(parents[it->edge()] < 0 && q == 0) {
+                    graph_detail::spspHelper(parents, e, it->edge(), path);
+                    return true;
+                }
+                else if(parents[it->edge()] > 0 && q == 1) {
+                    graph_detail::spspHelper(parents, it->edge(), e, path);
+                    return true;
+                }
+            }
+        }
+        if(heads[0] == queues[0].size() && heads[1] == queues[1].size()) {
+            return false;
+        }
+    }
+}
+
+/// Search for a shortest path from one to another vertex in a **subgraph** with **non-negative edge weights** using Dijkstra's algorithm, with a reusable workspace.
+///
+/// Like spsp, this function carries out a bidirectional Dijkstra search.
+///
+/// \param g A graph class such as andres::Graph or andres::Digraph.
+/// \param mask A subgraph mask such as DefaultSubgraphMask.
+/// \param vs Source vertex.
+/// \param vt Target vertex.
+/// \param edgeWeights A random access iterator pointing to positive edge weights.
+/// \param path A double-ended queue to which the path (in edges) is written.
+/// \param distance the distance to from the source to the target vertex (if there exists a path).
+///     if no path is found, path.size() == 0.
+/// \param workspace Workspace, reusable across searches without being reset.
+///
+template<class GRAPH, class SUBGRAPH_MASK, class EDGE_VALUE_ITERATOR, class T, class QUEUE_TAG>
+inline void
+spspEdges(
+    const GRAPH& g,
+    const SUBGRAPH_MASK& mask,
+    const std::size_t vs,
+    const std::size_t vt,
+    EDGE_VALUE_ITERATOR edgeWeights,
+    std::deque<std::size_t>& path,
+    T& distance,
+    SearchWorkspace<T, QUEUE_TAG>& workspace
+) {
+    path.clear();
+    const std::size_t meetingVertex = graph_detail::bidirectionalDijkstra(g, mask, vs, vt, edgeWeights, workspace, distance);
+    if(distance != workspace.infinity()) {
+        for(std::size_t v = meetingVertex; v != vs; v = workspace.parents_[v]) {
+            path.push_front(workspace.parentEdges_[v]);
+        }
+        for(std::size_t v = meetingVertex; v != vt; v = workspace.backwardParents_[v]) {
+            path.push_back(workspace.backwardParentEdges_[v]);
+        }
+    }
+}
+
 /// Search for a shortest path from one to another vertex in a graph with **non-negative edge weights** using Dijkstra's algorithm.
 ///
 /// \param g A graph class such as andres::Graph or andres::Digraph.
@@ -1662,23 +2934,24 @@ ssspEdges(
     VISITOR& visitor
 ) {
     typedef typename std::iterator_traits<DISTANCE_ITERATOR>::value_type Value;
-    typedef typename graph_detail::DijkstraQueueEntry<Value> Entry;
     
     assert(mask.vertex(vs));
     const Value infinity = std::numeric_limits<Value>::has_infinity
     ? std::numeric_limits<Value>::infinity()
     : std::numeric_limits<Value>::max();
-    std::priority_queue<Entry> queue;
-    queue.push(vs);
+    // every vertex of the subgraph is contained once, at infinite distance
+    // until it is reached
+    IndexedHeap<Value> queue(g.numberOfVertices());
     for(std::size_t v = 0; v < g.numberOfVertices(); ++v) {
         distances[v] = infinity;
-        if(mask.vertex(v)) {
-            queue.push(Entry(v, infinity));
+        if(v != vs && detail::isVertexInSubgraph(mask, v)) {
+            queue.push(v, infinity);
         }
     }
     distances[vs] = 0;
+    queue.push(vs, 0);
     while(!queue.empty()) {
-        const std::size_t v = queue.top().vertex_;
+        const std::size_t v = queue.top();
         const bool proceed = visitor(distances, parents, parentsEdges, v);
         if(!proceed) {
             // return;
@@ -1689,23 +2962,17 @@ ssspEdges(
             // return;
 			break;
         }
-        for(typename GRAPH::AdjacencyIterator it = g.adjacenciesFromVertexBegin(v);
-            it != g.adjacenciesFromVertexEnd(v); ++it) {
-            if(mask.vertex(it->vertex()) && mask.edge(it->edge())) {
-                const Value alternativeDistance = distances[v] + edgeWeights[it->edge()];
-                if(alternativeDistance < distances[it->vertex()]) {
-                    distances[it->vertex()] = alternativeDistance;
-                    parentsEdges[it->vertex()] = it->edge();
-                    parents[it->vertex()] = v;
-                    queue.push(Entry(it->vertex(), alternativeDistance));
-                    // pushing v another time, not worring about existing entries
-                    // v in the queue at deprecated positions.
-                    // alternatively, one could use a heap from which elements
-                    // can be removed. this is beneficial for dense graphs in 
-                    // which many weights are equal.
+        forEachAdjacency(g, v, [&](const typename GRAPH::AdjacencyType& a) {
+            if(detail::isVertexInSubgraph(mask, a.vertex()) && detail::isEdgeInSubgraph(mask, a.edge())) {
+                const Value alternativeDistance = distances[v] + edgeWeights[a.edge()];
+                if(alternativeDistance < distances[a.vertex()]) {
+                    distances[a.vertex()] = alternativeDistance;
+                    parentsEdges[a.vertex()] = a.edge();
+                    parents[a.vertex()] = v;
+                    queue.pushOrDecreaseKey(a.vertex(), alternativeDistance);
                 }
             }
-        }
+        });
     }
 }
 
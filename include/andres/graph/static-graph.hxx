@@ -0,0 +1,650 @@
+#pragma once
+#ifndef ANDRES_GRAPH_STATIC_GRAPH_HXX
+#define ANDRES_GRAPH_STATIC_GRAPH_HXX
+
+#include <cassert>
+#include <cstddef>
+#include <iterator> // std::random_access_iterator
+#include <vector>
+#include <utility> // std::pair
+#include <algorithm> // std::lower_bound
+
+#include "adjacency.hxx"
+#include "subgraph.hxx"
+#include "visitor.hxx"
+#include "detail/graph.hxx"
+
+namespace andres {
+namespace graph {
+
+/// Immutable undirected graph, implemented in compressed sparse row (CSR) format.
+///
+/// The adjacencies of all vertices are stored in one contiguous array,
+/// delimited by an array of offsets. The adjacencies of each vertex are
+/// ordered exactly as in Graph, i.e. first wrt the vertex, then wrt the edge.
+/// Integer indices of vertices and edges are those of the edge list or
+/// graph from which the StaticGraph is built.
+///
+template<typename VISITOR = IdleGraphVisitor<std::size_t> >
+class StaticGraph {
+public:
+    typedef VISITOR Visitor;
+    typedef detail::VertexIterator VertexIterator;
+    typedef detail::EdgeIterator EdgeIterator;
+    typedef detail::Adjacencies::const_iterator AdjacencyIterator;
+    typedef typename AdjacencyIterator::value_type AdjacencyType;
+
+    // construction
+    StaticGraph(const Visitor& = Visitor());
+    template<class GRAPH>
+        StaticGraph(const GRAPH&, const Visitor& = Visitor());
+    template<class ITERATOR>
+        StaticGraph(const std::size_t, ITERATOR, ITERATOR, const Visitor& = Visitor());
+    void assign(const Visitor& = Visitor());
+    template<class GRAPH>
+        void assign(const GRAPH&, const Visitor& = Visitor());
+    template<class ITERATOR>
+        void assign(const std::size_t, ITERATOR, ITERATOR, const Visitor& = Visitor());
+
+    // iterator access (compatible with Digraph)
+    VertexIterator verticesFromVertexBegin(const std::size_t) const;
+    VertexIterator verticesFromVertexEnd(const std::size_t) const;
+    VertexIterator verticesToVertexBegin(const std::size_t) const;
+    VertexIterator verticesToVertexEnd(const std::size_t) const;
+    EdgeIterator edgesFromVertexBegin(const std::size_t) const;
+    EdgeIterator edgesFromVertexEnd(const std::size_t) const;
+    EdgeIterator edgesToVertexBegin(const std::size_t) const;
+    EdgeIterator edgesToVertexEnd(const std::size_t) const;
+    AdjacencyIterator adjacenciesFromVertexBegin(const std::size_t) const;
+    AdjacencyIterator adjacenciesFromVertexEnd(const std::size_t) const;
+    AdjacencyIterator adjacenciesToVertexBegin(const std::size_t) const;
+    AdjacencyIterator adjacenciesToVertexEnd(const std::size_t) const;
+
+    // access (compatible with Digraph)
+    std::size_t numberOfVertices() const;
+    std::size_t numberOfEdges() const;
+    std::size_t numberOfEdgesFromVertex(const std::size_t) const;
+    std::size_t numberOfEdgesToVertex(const std::size_t) const;
+    std::size_t vertexOfEdge(const std::size_t, const std::size_t) const;
+    std::size_t edgeFromVertex(const std::size_t, const std::size_t) const;
+    std::size_t edgeToVertex(const std::size_t, const std::size_t) const;
+    std::size_t vertexFromVertex(const std::size_t, const std::size_t) const;
+    std::size_t vertexToVertex(const std::size_t, const std::size_t) const;
+    const AdjacencyType& adjacencyFromVertex(const std::size_t, const std::size_t) const;
+    const AdjacencyType& adjacencyToVertex(const std::size_t, const std::size_t) const;
+    std::pair<bool, std::size_t> findEdge(const std::size_t, const std::size_t) const;
+    bool multipleEdgesEnabled() const;
+
+private:
+    typedef detail::Edge<false> Edge;
+
+    void buildAdjacencies(const std::size_t);
+
+    std::vector<std::size_t> offsets_;
+    std::vector<AdjacencyType> adjacencies_;
+    std::vector<Edge> edges_;
+    bool multipleEdgesEnabled_;
+    Visitor visitor_;
+};
+
+/// Construct an empty undirected graph.
+///
+/// \param visitor Visitor to follow changes of integer indices of vertices and edges.
+///
+template<typename VISITOR>
+inline
+StaticGraph<VISITOR>::StaticGraph(
+    const Visitor& visitor
+)
+:   offsets_(1, 0),
+    adjacencies_(),
+    edges_(),
+    multipleEdgesEnabled_(false),
+    visitor_(visitor)
+{}
+
+/// Construct an undirected graph as a copy of another graph.
+///
+/// \param graph A graph class such as andres::Graph. Edge j of the
+///     StaticGraph connects the same vertices as edge j of this graph.
+/// \param visitor Visitor to follow changes of integer indices of vertices and edges.
+///
+template<typename VISITOR>
+template<class GRAPH>
+inline
+StaticGraph<VISITOR>::StaticGraph(
+    const GRAPH& graph,
+    const Visitor& visitor
+)
+:   offsets_(),
+    adjacencies_(),
+    edges_(),
+    multipleEdgesEnabled_(false),
+    visitor_(visitor)
+{
+    assign(graph, visitor);
+}
+
+/// Construct an undirected graph from a list of edges.
+///
+/// \param numberOfVertices Number of vertices.
+/// \param edgesBegin Iterator to the beginning of a sequence of pairs of
+///     integer indices of vertices, e.g. std::pair<std::size_t, std::size_t>.
+///     Edge j of the StaticGraph connects the vertices of the j-th pair.
+/// \param edgesEnd Iterator to the end of the sequence of pairs.
+/// \param visitor Visitor to follow changes of integer indices of vertices and edges.
+///
+template<typename VISITOR>
+template<class ITERATOR>
+inline
+StaticGraph<VISITOR>::StaticGraph(
+    const std::size_t numberOfVertices,
+    ITERATOR edgesBegin,
+    ITERATOR edgesEnd,
+    const Visitor& visitor
+)
+:   offsets_(),
+    adjacencies_(),
+    edges_(),
+    multipleEdgesEnabled_(false),
+    visitor_(visitor)
+{
+    assign(numberOfVertices, edgesBegin, edgesEnd, visitor);
+}
+
+/// Clear an undirected graph.
+///
+/// \param visitor Visitor to follow changes of integer indices of vertices and edges.
+///
+template<typename VISITOR>
+inline void
+StaticGraph<VISITOR>::assign(
+    const Visitor& visitor
+) {
+    offsets_.assign(1, 0);
+    adjacencies_.clear();
+    edges_.clear();
+    multipleEdgesEnabled_ = false;
+    visitor_ = visitor;
+}
+
+/// Clear an undirected graph and make it a copy of another graph.
+///
+/// \param graph A graph class such as andres::Graph.
+/// \param visitor Visitor to follow changes of integer indices of vertices and edges.
+///
+template<typename VISITOR>
+template<class GRAPH>
+inline void
+StaticGraph<VISITOR>::assign(
+    const GRAPH& graph,
+    const Visitor& visitor
+) {
+    edges_.clear();
+    edges_.reserve(graph.numberOfEdges());
+    for(std::size_t e = 0; e < graph.numberOfEdges(); ++e) {
+        edges_.push_back(Edge(graph.vertexOfEdge(e, 0), graph.vertexOfEdge(e, 1)));
+    }
+    visitor_ = visitor;
+    buildAdjacencies(graph.numberOfVertices());
+}
+
+/// Clear an undirected graph and build it from a list of edges.
+///
+/// \param numberOfVertices Number of vertices.
+/// \param edgesBegin Iterator to the beginning of a sequence of pairs of
+///     integer indices of vertices, e.g. std::pair<std::size_t, std::size_t>.
+/// \param edgesEnd Iterator to the end of the sequence of pairs.
+/// \param visitor Visitor to follow changes of integer indices of vertices and edges.
+///
+template<typename VISITOR>
+template<class ITERATOR>
+inline void
+StaticGraph<VISITOR>::assign(
+    const std::size_t numberOfVertices,
+    ITERATOR edgesBegin,
+    ITERATOR edgesEnd,
+    const Visitor& visitor
+) {
+    edges_.clear();
+    for(; edgesBegin != edgesEnd; ++edgesBegin) {
+        assert(static_cast<std::size_t>(edgesBegin->first) < numberOfVertices);
+        assert(static_cast<std::size_t>(edgesBegin->second) < numberOfVertices);
+        edges_.push_back(Edge(edgesBegin->first, edgesBegin->second));
+    }
+    visitor_ = visitor;
+    buildAdjacencies(numberOfVertices);
+}
+
+/// Get the number of vertices.
+///
+template<typename VISITOR>
+inline std::size_t
+StaticGraph<VISITOR>::numberOfVertices() const {
+    return offsets_.size() - 1;
+}
+
+/// Get the number of edges.
+///
+template<typename VISITOR>
+inline std::size_t
+StaticGraph<VISITOR>::numberOfEdges() const {
+    return edges_.size();
+}
+
+/// Get the number of edges that originate from a given vertex.
+///
+/// \param vertex Integer index of a vertex.
+///
+/// \sa edgeFromVertex()
+///
+template<typename VISITOR>
+inline std::size_t
+StaticGraph<VISITOR>::numberOfEdgesFromVertex(
+    const std::size_t vertex
+) const {
+    return offsets_[vertex + 1] - offsets_[vertex];
+}
+
+/// Get the number of edges that are incident to a given vertex.
+///
+/// \param vertex Integer index of a vertex.
+///
+/// \sa edgeToVertex()
+///
+template<typename VISITOR>
+inline std::size_t
+StaticGraph<VISITOR>::numberOfEdgesToVertex(
+    const std::size_t vertex
+) const {
+    return offsets_[vertex + 1] - offsets_[vertex];
+}
+
+/// Get the integer index of a vertex of an edge.
+///
+/// \param edge Integer index of an edge.
+/// \param j Number of the vertex in the edge; either 0 or 1.
+///
+template<typename VISITOR>
+inline std::size_t
+StaticGraph<VISITOR>::vertexOfEdge(
+    const std::size_t edge,
+    const std::size_t j
+) const {
+    assert(j < 2);
+
+    return edges_[edge][j];
+}
+
+/// Get the integer index of an edge that originates from a given vertex.
+///
+/// \param vertex Integer index of a vertex.
+/// \param j Number of the edge; between 0 and numberOfEdgesFromVertex(vertex) - 1.
+///
+/// \sa numberOfEdgesFromVertex()
+///
+template<typename VISITOR>
+inline std::size_t
+StaticGraph<VISITOR>::edgeFromVertex(
+    const std::size_t vertex,
+    const std::size_t j
+) const {
+    return adjacencies_[offsets_[vertex] + j].edge();
+}
+
+/// Get the integer index of an edge that is incident to a given vertex.
+///
+/// \param vertex Integer index of a vertex.
+/// \param j Number of the edge; between 0 and numberOfEdgesFromVertex(vertex) - 1.
+///
+/// \sa numberOfEdgesToVertex()
+///
+template<typename VISITOR>
+inline std::size_t
+StaticGraph<VISITOR>::edgeToVertex(
+    const std::size_t vertex,
+    const std::size_t j
+) const {
+    return adjacencies_[offsets_[vertex] + j].edge();
+}
+
+/// Get the integer index of a vertex reachable from a given vertex via a single edge.
+///
+/// \param vertex Integer index of a vertex.
+/// \param j Number of the vertex; between 0 and numberOfEdgesFromVertex(vertex) - 1.
+///
+/// \sa numberOfEdgesFromVertex()
+///
+template<typename VISITOR>
+inline std::size_t
+StaticGraph<VISITOR>::vertexFromVertex(
+    const std::size_t vertex,
+    const std::size_t j
+) const {
+    return adjacencies_[offsets_[vertex] + j].vertex();
+}
+
+/// Get the integer index of a vertex from which a given vertex is reachable via a single edge.
+///
+/// \param vertex Integer index of a vertex.
+/// \param j Number of the vertex; between 0 and numberOfEdgesFromVertex(vertex) - 1.
+///
+/// \sa numberOfEdgesFromVertex()
+///
+template<typename VISITOR>
+inline std::size_t
+StaticGraph<VISITOR>::vertexToVertex(
+    const std::size_t vertex,
+    const std::size_t j
+) const {
+    return adjacencies_[offsets_[vertex] + j].vertex();
+}
+
+/// Get an iterator to the beginning of the sequence of vertices reachable from a given vertex via a single edge.
+///
+/// \param vertex Integer index of the vertex.
+/// \return VertexIterator.
+///
+/// \sa verticesFromVertexEnd()
+///
+template<typename VISITOR>
+inline typename StaticGraph<VISITOR>::VertexIterator
+StaticGraph<VISITOR>::verticesFromVertexBegin(
+    const std::size_t vertex
+) const {
+    return adjacenciesFromVertexBegin(vertex);
+}
+
+/// Get an iterator to the end of the sequence of vertices reachable from a given vertex via a single edge.
+///
+/// \param vertex Integer index of the vertex.
+/// \return VertexIterator.
+///
+/// \sa verticesFromVertexBegin()
+///
+template<typename VISITOR>
+inline typename StaticGraph<VISITOR>::VertexIterator
+StaticGraph<VISITOR>::verticesFromVertexEnd(
+    const std::size_t vertex
+) const {
+    return adjacenciesFromVertexEnd(vertex);
+}
+
+/// Get an iterator to the beginning of the sequence of vertices from which a given vertex is reachable via a single edge.
+///
+/// \param vertex Integer index of the vertex.
+/// \return VertexIterator.
+///
+/// \sa verticesToVertexEnd()
+///
+template<typename VISITOR>
+inline typename StaticGraph<VISITOR>::VertexIterator
+StaticGraph<VISITOR>::verticesToVertexBegin(
+    const std::size_t vertex
+) const {
+    return adjacenciesFromVertexBegin(vertex);
+}
+
+/// Get an iterator to the end of the sequence of vertices from which a given vertex is reachable via a single edge.
+///
+/// \param vertex Integer index of the vertex.
+/// \return VertexIterator.
+///
+/// \sa verticesToVertexBegin()
+///
+template<typename VISITOR>
+inline typename StaticGraph<VISITOR>::VertexIterator
+StaticGraph<VISITOR>::verticesToVertexEnd(
+    const std::size_t vertex
+) const {
+    return adjacenciesFromVertexEnd(vertex);
+}
+
+/// Get an iterator to the beginning of the sequence of edges that originate from a given vertex.
+///
+/// \param vertex Integer index of the vertex.
+/// \return EdgeIterator.
+///
+/// \sa edgesFromVertexEnd()
+///
+template<typename VISITOR>
+inline typename StaticGraph<VISITOR>::EdgeIterator
+StaticGraph<VISITOR>::edgesFromVertexBegin(
+    const std::size_t vertex
+) const {
+    return adjacenciesFromVertexBegin(vertex);
+}
+
+/// Get an iterator to the end of the sequence of edges that originate from a given vertex.
+///
+/// \param vertex Integer index of the vertex.
+/// \return EdgeIterator.
+///
+/// \sa edgesFromVertexBegin()
+///
+template<typename VISITOR>
+inline typename StaticGraph<VISITOR>::EdgeIterator
+StaticGraph<VISITOR>::edgesFromVertexEnd(
+    const std::size_t vertex
+) const {
+    return adjacenciesFromVertexEnd(vertex);
+}
+
+/// Get an iterator to the beginning of the sequence of edges that are incident to a given vertex.
+///
+/// \param vertex Integer index of the vertex.
+/// \return EdgeIterator.
+///
+/// \sa edgesToVertexEnd()
+///
+template<typename VISITOR>
+inline typename StaticGraph<VISITOR>::EdgeIterator
+StaticGraph<VISITOR>::edgesToVertexBegin(
+    const std::size_t vertex
+) const {
+    return adjacenciesFromVertexBegin(vertex);
+}
+
+/// Get an iterator to the end of the sequence of edges that are incident to a given vertex.
+///
+/// \param vertex Integer index of the vertex.
+/// \return EdgeIterator.
+///
+/// \sa edgesToVertexBegin()
+///
+template<typename VISITOR>
+inline typename StaticGraph<VISITOR>::EdgeIterator
+StaticGraph<VISITOR>::edgesToVertexEnd(
+    const std::size_t vertex
+) const {
+    return adjacenciesFromVertexEnd(vertex);
+}
+
+/// Get an iterator to the beginning of the sequence of adjacencies that originate from a given vertex.
+///
+/// \param vertex Integer index of the vertex.
+/// \return AdjacencyIterator.
+///
+/// \sa adjacenciesFromVertexEnd()
+///
+template<typename VISITOR>
+inline typename StaticGraph<VISITOR>::AdjacencyIterator
+StaticGraph<VISITOR>::adjacenciesFromVertexBegin(
+    const std::size_t vertex
+) const {
+    return adjacencies_.begin() + offsets_[vertex];
+}
+
+/// Get an iterator to the end of the sequence of adjacencies that originate from a given vertex.
+///
+/// \param vertex Integer index of the vertex.
+/// \return AdjacencyIterator.
+///
+/// \sa adjacenciesFromVertexBegin()
+///
+template<typename VISITOR>
+inline typename StaticGraph<VISITOR>::AdjacencyIterator
+StaticGraph<VISITOR>::adjacenciesFromVertexEnd(
+    const std::size_t vertex
+) const {
+    return adjacencies_.begin() + offsets_[vertex + 1];
+}
+
+/// Get an iterator to the beginning of the sequence of adjacencies incident to a given vertex.
+///
+/// \param vertex Integer index of the vertex.
+/// \return AdjacencyIterator.
+///
+/// \sa adjacenciesToVertexEnd()
+///
+template<typename VISITOR>
+inline typename StaticGraph<VISITOR>::AdjacencyIterator
+StaticGraph<VISITOR>::adjacenciesToVertexBegin(
+    const std::size_t vertex
+) const {
+    return adjacenciesFromVertexBegin(vertex);
+}
+
+/// Get an iterator to the end of the sequence of adjacencies incident to a given vertex.
+///
+/// \param vertex Integer index of the vertex.
+/// \return AdjacencyIterator.
+///
+/// \sa adjacenciesToVertexBegin()
+///
+template<typename VISITOR>
+inline typename StaticGraph<VISITOR>::AdjacencyIterator
+StaticGraph<VISITOR>::adjacenciesToVertexEnd(
+    const std::size_t vertex
+) const {
+    return adjacenciesFromVertexEnd(vertex);
+}
+
+/// Get the j-th adjacency from a vertex.
+///
+/// \param vertex Vertex.
+/// \param j Number of the adjacency.
+///
+template<typename VISITOR>
+inline const typename StaticGraph<VISITOR>::AdjacencyType&
+StaticGraph<VISITOR>::adjacencyFromVertex(
+    const std::size_t vertex,
+    const std::size_t j
+) const {
+    return adjacencies_[offsets_[vertex] + j];
+}
+
+/// Get the j-th adjacency to a vertex.
+///
+/// \param vertex Vertex.
+/// \param j Number of the adjacency.
+///
+template<typename VISITOR>
+inline const typename StaticGraph<VISITOR>::AdjacencyType&
+StaticGraph<VISITOR>::adjacencyToVertex(
+    const std::size_t vertex,
+    const std::size_t j
+) const {
+    return adjacencies_[offsets_[vertex] + j];
+}
+
+/// Search for an edge (in logarithmic time).
+///
+/// \param vertex0 first vertex of the edge.
+/// \param vertex1 second vertex of the edge.
+/// \return if an edge from vertex0 to vertex1 exists, pair.first is true
+///     and pair.second is the index of such an edge. if no edge from vertex0
+///     to vertex1 exists, pair.first is false and pair.second is undefined.
+///
+template<typename VISITOR>
+inline std::pair<bool, std::size_t>
+StaticGraph<VISITOR>::findEdge(
+    const std::size_t vertex0,
+    const std::size_t vertex1
+) const {
+    assert(vertex0 < numberOfVertices());
+    assert(vertex1 < numberOfVertices());
+
+    std::size_t v0 = vertex0;
+    std::size_t v1 = vertex1;
+    if(numberOfEdgesFromVertex(vertex1) < numberOfEdgesFromVertex(vertex0)) {
+        v0 = vertex1;
+        v1 = vertex0;
+    }
+    AdjacencyIterator it = std::lower_bound(
+        adjacenciesFromVertexBegin(v0),
+        adjacenciesFromVertexEnd(v0),
+        AdjacencyType(v1, 0)
+    ); // binary search
+    if(it != adjacenciesFromVertexEnd(v0) && it->vertex() == v1) {
+        return std::make_pair(true, it->edge());
+    }
+    else {
+        return std::make_pair(false, 0);
+    }
+}
+
+/// Indicate if multiple edges exist.
+///
+/// \return true if at least two edges connect the same pair of vertices, false otherwise.
+///
+template<typename VISITOR>
+inline bool
+StaticGraph<VISITOR>::multipleEdgesEnabled() const {
+    return multipleEdgesEnabled_;
+}
+
+// builds offsets_ and adjacencies_ from edges_ in O(|V| + |E|) by two
+// passes of counting sort: the first pass orders the adjacencies of each
+// vertex by edge, the second (stable) pass orders them by vertex.
+template<typename VISITOR>
+inline void
+StaticGraph<VISITOR>::buildAdjacencies(
+    const std::size_t numberOfVertices
+) {
+    offsets_.assign(numberOfVertices + 1, 0);
+    for(std::size_t e = 0; e < edges_.size(); ++e) {
+        ++offsets_[edges_[e][0] + 1];
+        if(edges_[e][1] != edges_[e][0]) {
+            ++offsets_[edges_[e][1] + 1];
+        }
+    }
+    for(std::size_t v = 0; v < numberOfVertices; ++v) {
+        offsets_[v + 1] += offsets_[v];
+    }
+
+    std::vector<AdjacencyType> adjacenciesByEdge(offsets_.back());
+    std::vector<std::size_t> position(offsets_.begin(), offsets_.end() - 1);
+    for(std::size_t e = 0; e < edges_.size(); ++e) {
+        const std::size_t v0 = edges_[e][0];
+        const std::size_t v1 = edges_[e][1];
+        adjacenciesByEdge[position[v0]++] = AdjacencyType(v1, e);
+        if(v1 != v0) {
+            adjacenciesByEdge[position[v1]++] = AdjacencyType(v0, e);
+        }
+    }
+
+    adjacencies_.resize(offsets_.back());
+    std::copy(offsets_.begin(), offsets_.end() - 1, position.begin());
+    for(std::size_t v = 0; v < numberOfVertices; ++v) {
+        for(std::size_t j = offsets_[v]; j < offsets_[v + 1]; ++j) {
+            const AdjacencyType& adjacency = adjacenciesByEdge[j];
+            adjacencies_[position[adjacency.vertex()]++] = AdjacencyType(v, adjacency.edge());
+        }
+    }
+
+    multipleEdgesEnabled_ = false;
+    for(std::size_t v = 0; v < numberOfVertices && !multipleEdgesEnabled_; ++v) {
+        for(std::size_t j = offsets_[v] + 1; j < offsets_[v + 1]; ++j) {
+            if(adjacencies_[j].vertex() == adjacencies_[j - 1].vertex()) {
+                multipleEdgesEnabled_ = true;
+                break;
+            }
+        }
+    }
+}
+
+} // namespace graph
+} // namespace andres
+
+#endif // #ifndef ANDRES_GRAPH_STATIC_GRAPH_HXX
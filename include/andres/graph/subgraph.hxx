@@ -2,6 +2,12 @@
 #ifndef ANDRES_GRAPH_SUBGRAPH_HXX
 #define ANDRES_GRAPH_SUBGRAPH_HXX
 
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits> // std::false_type, std::true_type
+#include <vector>
+
 namespace andres {
 namespace graph {
 
@@ -16,6 +22,201 @@ struct DefaultSubgraphMask {
         { return true; }
 };
 
+/// A subgraph whose vertices and edges are stored in two bitsets.
+///
+/// The bitsets are built in one pass over the graph from any other
+/// subgraph mask, e.g. one whose tests are expensive to evaluate and that is
+/// used in many traversals. Testing a vertex or an edge costs one memory
+/// access and a shift.
+///
+template<class T = std::size_t>
+class BitsetSubgraphMask {
+public:
+    typedef T Value;
+
+    BitsetSubgraphMask();
+    template<class GRAPH, class SUBGRAPH_MASK>
+        BitsetSubgraphMask(const GRAPH&, const SUBGRAPH_MASK&);
+    template<class GRAPH, class SUBGRAPH_MASK>
+        void assign(const GRAPH&, const SUBGRAPH_MASK&);
+    bool vertex(const Value) const;
+    bool edge(const Value) const;
+    void setVertex(const Value, const bool);
+    void setEdge(const Value, const bool);
+
+private:
+    typedef std::uint64_t Word;
+
+    static bool test(const std::vector<Word>&, const Value);
+    static void set(std::vector<Word>&, const Value, const bool);
+
+    std::vector<Word> vertices_;
+    std::vector<Word> edges_;
+};
+
+// \cond SUPPRESS_DOXYGEN
+namespace detail {
+
+template<class SUBGRAPH_MASK>
+struct IsDefaultSubgraphMask : std::false_type {};
+
+template<class T>
+struct IsDefaultSubgraphMask<DefaultSubgraphMask<T> > : std::true_type {};
+
+// tests that are resolved at compile time for DefaultSubgraphMask,
+// such that traversals of entire graphs do not evaluate the mask
+template<class SUBGRAPH_MASK>
+inline bool
+isVertexInSubgraph(
+    const SUBGRAPH_MASK& mask,
+    const std::size_t v
+) {
+    return IsDefaultSubgraphMask<SUBGRAPH_MASK>::value || mask.vertex(v);
+}
+
+template<class SUBGRAPH_MASK>
+inline bool
+isEdgeInSubgraph(
+    const SUBGRAPH_MASK& mask,
+    const std::size_t e
+) {
+    return IsDefaultSubgraphMask<SUBGRAPH_MASK>::value || mask.edge(e);
+}
+
+} // namespace detail
+// \endcond
+
+/// Construct a mask of the empty subgraph.
+///
+template<class T>
+inline
+BitsetSubgraphMask<T>::BitsetSubgraphMask()
+:   vertices_(),
+    edges_()
+{}
+
+/// Construct a mask from another subgraph mask.
+///
+/// \param graph Graph.
+/// \param mask A subgraph mask such as DefaultSubgraphMask.
+///
+template<class T>
+template<class GRAPH, class SUBGRAPH_MASK>
+inline
+BitsetSubgraphMask<T>::BitsetSubgraphMask(
+    const GRAPH& graph,
+    const SUBGRAPH_MASK& mask
+)
+:   vertices_(),
+    edges_()
+{
+    assign(graph, mask);
+}
+
+/// Assign a mask from another subgraph mask.
+///
+/// \param graph Graph.
+/// \param mask A subgraph mask such as DefaultSubgraphMask.
+///
+template<class T>
+template<class GRAPH, class SUBGRAPH_MASK>
+inline void
+BitsetSubgraphMask<T>::assign(
+    const GRAPH& graph,
+    const SUBGRAPH_MASK& mask
+) {
+    vertices_.assign((graph.numberOfVertices() + 63) / 64, 0);
+    for(std::size_t v = 0; v < graph.numberOfVertices(); ++v) {
+        if(mask.vertex(v)) {
+            vertices_[v / 64] |= static_cast<Word>(1) << (v % 64);
+        }
+    }
+    edges_.assign((graph.numberOfEdges() + 63) / 64, 0);
+    for(std::size_t e = 0; e < graph.numberOfEdges(); ++e) {
+        if(mask.edge(e)) {
+            edges_[e / 64] |= static_cast<Word>(1) << (e % 64);
+        }
+    }
+}
+
+/// Test whether a vertex is in the subgraph.
+///
+/// \param v Integer index of the vertex.
+///
+template<class T>
+inline bool
+BitsetSubgraphMask<T>::vertex(
+    const Value v
+) const {
+    return test(vertices_, v);
+}
+
+/// Test whether an edge is in the subgraph.
+///
+/// \param e Integer index of the edge.
+///
+template<class T>
+inline bool
+BitsetSubgraphMask<T>::edge(
+    const Value e
+) const {
+    return test(edges_, e);
+}
+
+/// Add a vertex to or remove a vertex from the subgraph.
+///
+/// \param v Integer index of the vertex.
+/// \param value Flag.
+///
+template<class T>
+inline void
+BitsetSubgraphMask<T>::setVertex(
+    const Value v,
+    const bool value
+) {
+    set(vertices_, v, value);
+}
+
+/// Add an edge to or remove an edge from the subgraph.
+///
+/// \param e Integer index of the edge.
+/// \param value Flag.
+///
+template<class T>
+inline void
+BitsetSubgraphMask<T>::setEdge(
+    const Value e,
+    const bool value
+) {
+    set(edges_, e, value);
+}
+
+template<class T>
+inline bool
+BitsetSubgraphMask<T>::test(
+    const std::vector<Word>& words,
+    const Value j
+) {
+    assert(j / 64 < words.size());
+    return (words[j / 64] >> (j % 64)) & 1;
+}
+
+template<class T>
+inline void
+BitsetSubgraphMask<T>::set(
+    std::vector<Word>& words,
+    const Value j,
+    const bool value
+) {
+    assert(j / 64 < words.size());
+    if(value) {
+        words[j / 64] |= static_cast<Word>(1) << (j % 64);
+    }
+    else {
+        words[j / 64] &= ~(static_cast<Word>(1) << (j % 64));
+    }
+}
+
 } // namespace graph
 } // namespace andres
 
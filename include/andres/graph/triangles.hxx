@@ -2,85 +2,307 @@
 #ifndef ANDRES_GRAPH_TRIANGLES_HXX
 #define ANDRES_GRAPH_TRIANGLES_HXX
 
+#include <cstddef>
+#include <array>
+#include <vector>
+#include <algorithm>
+#include <utility> // std::swap
+
 namespace andres {
 namespace graph {
 
-// Efficiently list all triangles of a graph
-// with the "forward" algorithm from [1].
-//
-// [1] Schank, Wagner. Finding, Counting and Listing all
-// Triangles in Large Graphs, An Experimental Study. 2005
+// \cond SUPPRESS_DOXYGEN
+namespace detail {
+
+// Adjacency lists in compressed sparse row format in which every edge is
+// directed from the vertex of lower to the vertex of higher degree, ties
+// broken by vertex index. Vertices are identified by their rank in this
+// order, and every list is sorted and free of duplicates. Each triangle is
+// found exactly once, by intersecting the lists of its two vertices of
+// lowest rank ("compact forward" algorithm of [1]).
 //
-// Implementation by Jan-Hendrik Lange (c) 2018
+// The lists are built in parallel if OpenMP is enabled.
 //
-// Output: Vector of vertex triples    
+// [1] Latapy. Main-memory triangle computations for very large (sparse
+// (power-law)) graphs. Theoretical Computer Science 407:458-473. 2008
 //
 template<typename GRAPH>
-std::vector<std::vector<size_t>> findTriangles(const GRAPH& graph)
+class ForwardAdjacency
 {
-    std::vector<std::vector<size_t>> triangles;
+public:
+    ForwardAdjacency(const GRAPH&);
+
+    size_t numberOfVertices() const
+        { return vertices_.size(); }
+    size_t vertex(const size_t rank) const
+        { return vertices_[rank]; }
+    template<typename CALLBACK>
+        void forEachTriangle(const size_t, CALLBACK&&) const;
 
-    // get degrees of all vertices
-    std::vector<size_t> vertices(graph.numberOfVertices());
-    std::vector<size_t> index(graph.numberOfVertices());
+private:
+    std::vector<size_t> vertices_; // vertex of each rank
+    std::vector<size_t> offsets_;
+    std::vector<size_t> ends_;
+    std::vector<size_t> neighbors_;
+};
+
+template<typename GRAPH>
+inline
+ForwardAdjacency<GRAPH>::ForwardAdjacency(const GRAPH& graph) :
+    vertices_(graph.numberOfVertices()),
+    offsets_(graph.numberOfVertices() + 1),
+    ends_(graph.numberOfVertices()),
+    neighbors_()
+{
+    const std::ptrdiff_t numberOfVertices = graph.numberOfVertices();
+
+    // rank vertices by degree, by a counting sort that keeps ties in the
+    // order of vertex indices
     std::vector<size_t> degrees(graph.numberOfVertices());
+#pragma omp parallel for
+    for (std::ptrdiff_t v = 0; v < numberOfVertices; v++)
+        degrees[v] = graph.numberOfEdgesFromVertex(v);
+
+    size_t maxDegree = 0;
+    for (size_t v = 0; v < graph.numberOfVertices(); v++)
+        maxDegree = std::max(maxDegree, degrees[v]);
+
+    std::vector<size_t> degreeOffsets(maxDegree + 2);
+    for (size_t v = 0; v < graph.numberOfVertices(); v++)
+        degreeOffsets[degrees[v] + 1]++;
+    for (size_t d = 1; d < degreeOffsets.size(); d++)
+        degreeOffsets[d] += degreeOffsets[d - 1];
+
+    std::vector<size_t> ranks(graph.numberOfVertices());
     for (size_t v = 0; v < graph.numberOfVertices(); v++)
     {
-        vertices[v] = v;
-        degrees[v] = graph.numberOfEdgesFromVertex(v);
+        ranks[v] = degreeOffsets[degrees[v]]++;
+        vertices_[ranks[v]] = v;
     }
 
-    // sort vertices according to degrees
-    std::sort(vertices.begin(), vertices.end(), [&] (const size_t& a, const size_t& b) {return (degrees[a] < degrees[b]);});
+    // number of neighbors of higher rank
+#pragma omp parallel for schedule(dynamic, 1024)
+    for (std::ptrdiff_t i = 0; i < numberOfVertices; i++)
+    {
+        size_t count = 0;
+        for (auto it = graph.adjacenciesFromVertexBegin(vertices_[i]); it != graph.adjacenciesFromVertexEnd(vertices_[i]); it++)
+            if (ranks[it->vertex()] > static_cast<size_t>(i))
+                count++;
+
+        offsets_[i + 1] = count;
+    }
 
-    // determine mapping of vertices to indices
     for (size_t i = 0; i < graph.numberOfVertices(); i++)
-        index[vertices[i]] = i;
+        offsets_[i + 1] += offsets_[i];
 
-    // dynamic adjacency data
-    std::vector<std::vector<size_t>> adj(graph.numberOfVertices());
+    neighbors_.resize(offsets_.back());
 
-    // MAIN LOOP
-    for (size_t i = 0; i < graph.numberOfVertices(); i++)
+#pragma omp parallel for schedule(dynamic, 1024)
+    for (std::ptrdiff_t i = 0; i < numberOfVertices; i++)
     {
-        auto u = vertices[i];
-        // iterate over neighbors
-        for (auto it = graph.adjacenciesFromVertexBegin(u); it != graph.adjacenciesFromVertexEnd(u); it++)
-        {
-            auto v = it->vertex();
-            auto j = index[v];
+        auto end = neighbors_.begin() + offsets_[i];
+        for (auto it = graph.adjacenciesFromVertexBegin(vertices_[i]); it != graph.adjacenciesFromVertexEnd(vertices_[i]); it++)
+            if (ranks[it->vertex()] > static_cast<size_t>(i))
+                *end++ = ranks[it->vertex()];
 
-            // only consider smaller indices
-            if (i < j)
-            {
-                // find intersection in adjacency lists
-                auto it_u = adj[i].begin();
-                auto it_v = adj[j].begin();
+        // parallel edges are listed once
+        std::sort(neighbors_.begin() + offsets_[i], end);
+        ends_[i] = std::unique(neighbors_.begin() + offsets_[i], end) - neighbors_.begin();
+    }
+}
+
+// Call callback(i, j, k) for each triangle whose vertex of lowest rank is i,
+// with ranks i < j < k.
+template<typename GRAPH>
+template<typename CALLBACK>
+inline void
+ForwardAdjacency<GRAPH>::forEachTriangle(const size_t i, CALLBACK&& callback) const
+{
+    // lists of very different length are intersected by binary search in the
+    // longer list, other lists by a merge without unpredictable branches
+    const size_t GALLOPING_RATIO = 32;
+
+    const size_t* const first = neighbors_.data();
+    for (auto it = first + offsets_[i]; it != first + ends_[i]; it++)
+    {
+        const size_t j = *it;
 
-                while (it_u != adj[i].end() && it_v != adj[j].end())
+        // neighbors of i of higher rank than j
+        const size_t* a = it + 1;
+        const size_t* const aEnd = first + ends_[i];
+        const size_t* b = first + offsets_[j];
+        const size_t* const bEnd = first + ends_[j];
+
+        if (static_cast<size_t>(bEnd - b) > GALLOPING_RATIO * static_cast<size_t>(aEnd - a))
+        {
+            for (; a != aEnd; a++)
+            {
+                b = std::lower_bound(b, bEnd, *a);
+                if (b == bEnd)
+                    break;
+                if (*b == *a)
+                    callback(i, j, *a);
+            }
+        }
+        else if (static_cast<size_t>(aEnd - a) > GALLOPING_RATIO * static_cast<size_t>(bEnd - b))
+        {
+            for (; b != bEnd; b++)
+            {
+                a = std::lower_bound(a, aEnd, *b);
+                if (a == aEnd)
+                    break;
+                if (*a == *b)
+                    callback(i, j, *b);
+            }
+        }
+        else
+        {
+            while (a != aEnd && b != bEnd)
+            {
+                if (*a == *b)
                 {
-                    if (*it_u == *it_v)
-                    {
-                        auto k = *it_u;
-                        std::vector<size_t> triangle{u,v,vertices[k]}; 
-                        triangles.push_back(triangle);
-                        it_u++;
-                        it_v++;
-                    }
-                    else if (*it_u < *it_v)
-                        it_u++;
-                    else if (*it_v < *it_u)
-                        it_v++;
+                    callback(i, j, *a);
+                    a++;
+                    b++;
+                }
+                else
+                {
+                    const bool less = *a < *b;
+                    a += less;
+                    b += !less;
                 }
-
-                adj[j].push_back(i);
             }
         }
     }
+}
+
+// Vertices of a triangle in ascending order.
+template<typename T>
+inline std::array<T, 3> sortedTriangle(size_t v0, size_t v1, size_t v2)
+{
+    if (v0 > v1)
+        std::swap(v0, v1);
+    if (v1 > v2)
+        std::swap(v1, v2);
+    if (v0 > v1)
+        std::swap(v0, v1);
+
+    return {{static_cast<T>(v0), static_cast<T>(v1), static_cast<T>(v2)}};
+}
+
+} // namespace detail
+// \endcond
+
+// Call a function for each triangle of a graph, without storing the
+// triangles. The callback is called as callback(v0, v1, v2) with vertex
+// indices v0 < v1 < v2, sequentially and in a deterministic order. Triangles
+// joined by parallel edges are reported once.
+//
+// Runtime complexity O(|E|^(3/2)).
+//
+template<typename GRAPH, typename CALLBACK>
+void forEachTriangle(const GRAPH& graph, CALLBACK&& callback)
+{
+    detail::ForwardAdjacency<GRAPH> adjacency(graph);
+
+    for (size_t i = 0; i < adjacency.numberOfVertices(); i++)
+        adjacency.forEachTriangle(i, [&] (const size_t r0, const size_t r1, const size_t r2) {
+            const auto triangle = detail::sortedTriangle<size_t>(adjacency.vertex(r0), adjacency.vertex(r1), adjacency.vertex(r2));
+            callback(triangle[0], triangle[1], triangle[2]);
+        });
+}
+
+// Count the triangles of a graph, in parallel if OpenMP is enabled.
+//
+// Runtime complexity O(|E|^(3/2)).
+//
+template<typename GRAPH>
+size_t countTriangles(const GRAPH& graph)
+{
+    detail::ForwardAdjacency<GRAPH> adjacency(graph);
+
+    const std::ptrdiff_t numberOfVertices = adjacency.numberOfVertices();
+    size_t count = 0;
+#pragma omp parallel for schedule(dynamic, 64) reduction(+:count)
+    for (std::ptrdiff_t i = 0; i < numberOfVertices; i++)
+        adjacency.forEachTriangle(i, [&] (const size_t, const size_t, const size_t) {
+            count++;
+        });
+
+    return count;
+}
+
+// List all triangles of a graph in a flat array, in parallel if OpenMP is
+// enabled. Each triangle is stored as vertex indices v0 < v1 < v2. The order
+// of triangles is that of forEachTriangle, independent of the number of
+// threads. The type T can be chosen smaller than size_t, e.g. uint32_t, to
+// save memory for graphs with fewer vertices.
+//
+// Runtime complexity O(|E|^(3/2)).
+//
+template<typename GRAPH, typename T>
+void findTriangles(const GRAPH& graph, std::vector<std::array<T, 3>>& triangles)
+{
+    // vertices are processed in batches of consecutive ranks, each with a
+    // buffer of its own
+    const size_t BATCH_SIZE = 1024;
+
+    detail::ForwardAdjacency<GRAPH> adjacency(graph);
+
+    const std::ptrdiff_t numberOfBatches = (adjacency.numberOfVertices() + BATCH_SIZE - 1) / BATCH_SIZE;
+    std::vector<std::vector<std::array<T, 3>>> batchTriangles(numberOfBatches);
+
+#pragma omp parallel for schedule(dynamic)
+    for (std::ptrdiff_t batch = 0; batch < numberOfBatches; batch++)
+    {
+        auto& buffer = batchTriangles[batch];
+        const size_t last = std::min((batch + 1) * BATCH_SIZE, adjacency.numberOfVertices());
+        for (size_t i = batch * BATCH_SIZE; i < last; i++)
+            adjacency.forEachTriangle(i, [&] (const size_t r0, const size_t r1, const size_t r2) {
+                buffer.push_back(detail::sortedTriangle<T>(adjacency.vertex(r0), adjacency.vertex(r1), adjacency.vertex(r2)));
+            });
+    }
+
+    std::vector<size_t> batchOffsets(numberOfBatches + 1);
+    for (std::ptrdiff_t batch = 0; batch < numberOfBatches; batch++)
+        batchOffsets[batch + 1] = batchOffsets[batch] + batchTriangles[batch].size();
+
+    triangles.resize(batchOffsets.back());
+
+#pragma omp parallel for schedule(dynamic)
+    for (std::ptrdiff_t batch = 0; batch < numberOfBatches; batch++)
+    {
+        std::copy(batchTriangles[batch].begin(), batchTriangles[batch].end(), triangles.begin() + batchOffsets[batch]);
+        std::vector<std::array<T, 3>>().swap(batchTriangles[batch]);
+    }
+}
+
+// Efficiently list all triangles of a graph
+// with the "compact forward" variant of the
+// "forward" algorithm from [1].
+//
+// [1] Schank, Wagner. Finding, Counting and Listing all
+// Triangles in Large Graphs, An Experimental Study. 2005
+//
+// Implementation by Jan-Hendrik Lange (c) 2018
+//
+// Output: Vector of vertex triples, each in ascending order.
+// For large graphs, prefer the overload with flat output,
+// countTriangles or forEachTriangle, which do not allocate
+// memory per triangle.
+//
+template<typename GRAPH>
+std::vector<std::vector<size_t>> findTriangles(const GRAPH& graph)
+{
+    std::vector<std::vector<size_t>> triangles;
+
+    forEachTriangle(graph, [&] (const size_t v0, const size_t v1, const size_t v2) {
+        triangles.push_back(std::vector<size_t>{v0, v1, v2});
+    });
 
     return triangles;
 }
-    
+
 }
 }
 
@@ -4,7 +4,7 @@
 
 #include <cstddef>
 #include <vector>
-#include <algorithm> // std::lower_bound, std::upper_bound
+#include <algorithm> // std::lower_bound, std::upper_bound, std::sort, std::inplace_merge
 #include <functional> // std::greater
 #include <utility> // std::make_pair
 
@@ -92,7 +92,7 @@ public:
     // TODO: implement C++11 member functions 'emplace' and 'emplace_hint'
 
 private:
-    std::vector<Key> vector_;
+    Vector vector_;
     Comparison compare_;
 };
 
@@ -225,6 +225,10 @@ RandomAccessSet<Key, Comparison, Allocator>::insert(
     return std::make_pair(i, !found);
 }
 
+// inserts a sequence of m elements in O(m log m + n) time by sorting the
+// sequence and merging it with the n elements in the set, instead of
+// inserting the elements one by one in linear time each.
+//
 template<class Key, class Comparison, class Allocator>
 template <class Iterator>
 inline void
@@ -232,9 +236,20 @@ inline void
     Iterator first, 
     Iterator last
 ) {
-    for(; first != last; ++first) {
-        insert(*first);
+    const size_type size = vector_.size();
+    vector_.insert(vector_.end(), first, last);
+    std::sort(vector_.begin() + size, vector_.end(), compare_);
+    std::inplace_merge(vector_.begin(), vector_.begin() + size, vector_.end(), compare_);
+
+    // remove duplicates, keeping the elements that were in the set before
+    iterator out = vector_.begin();
+    for(iterator it = vector_.begin(); it != vector_.end(); ++it) {
+        if(out == vector_.begin() || compare_(*(out - 1), *it)) {
+            *out = *it;
+            ++out;
+        }
     }
+    vector_.erase(out, vector_.end());
 }
 
 // TODO: optimize according to C++11 specification:
@@ -3,6 +3,7 @@
 #define NL_LMP_CALL_MULTICUT_SOLVER_HXX
 
 #include <andres/graph/complete-graph.hxx>
+#include <andres/graph/for-each.hxx>
 #include <andres/graph/multicut-lifted/kernighan-lin.hxx>
 #include <andres/graph/multicut/kernighan-lin.hxx>
 
@@ -49,13 +50,10 @@ double update_multicut(Problem<GRAPH> const& problem, Solution const& input, Sol
     }
 
     std::vector<double> edge_weights(problem.liftedGraph().numberOfEdges());
-    for (size_t e = 0; e < problem.liftedGraph().numberOfEdges(); ++e)
+    andres::graph::forEachEdge(problem.liftedGraph(), [&](size_t e, size_t v0, size_t v1)
     {
-        auto const v0 = problem.liftedGraph().vertexOfEdge(e, 0);
-        auto const v1 = problem.liftedGraph().vertexOfEdge(e, 1);
-
         edge_weights[e] = problem.getPairwiseCutCost(v0, v1, input[v0].classIndex, input[v1].classIndex, e) - problem.getPairwiseJoinCost(v0, v1, input[v0].classIndex, input[v1].classIndex, e);
-    }
+    });
 
     auto new_vertex_labels = call_kernighanLin(problem, edge_weights, vertex_cluster_labels);
 
@@ -2,6 +2,8 @@
 #ifndef NL_LMP_ILP_CALLBACK_HXX
 #define NL_LMP_ILP_CALLBACK_HXX
 
+#include <limits>
+
 #include <andres/graph/components.hxx>
 #include <andres/graph/paths.hxx>
 #include <andres/graph/shortest-paths.hxx>
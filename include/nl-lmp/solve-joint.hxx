@@ -3,6 +3,7 @@
 #define NL_LMP_SOLVE_JOINT_HXX
 
 #include <algorithm>
+#include <limits>
 #include <map>
 #include <stack>
 #include <unordered_set>
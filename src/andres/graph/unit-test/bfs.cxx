@@ -1,7 +1,15 @@
 #include <stdexcept>
+#include <limits>
+#include <vector>
+#include <set>
+#include <utility> // std::pair
+#include <algorithm> // std::count, std::is_sorted, std::adjacent_find
 
 #include "andres/graph/graph.hxx"
+#include "andres/graph/digraph.hxx"
+#include "andres/graph/grid-graph.hxx"
 #include "andres/graph/bfs.hxx"
+#include "andres/graph/search-workspace.hxx"
 
 inline void test(const bool condition) {
     if(!condition) throw std::logic_error("test failed.");
@@ -74,7 +82,333 @@ struct BlockingCallback {
     std::vector<std::size_t> depths_;
 };
 
+struct EvenVerticesMask {
+    bool vertex(const std::size_t v) const { return v % 2 == 0 || v % 7 == 0; }
+    bool edge(const std::size_t e) const { return e % 5 != 0; }
+};
+
+// depths of the level-synchronous search equal those of the sequential search,
+// for graphs in which both top-down and bottom-up levels occur
+template<class GRAPH, class SUBGRAPH_MASK>
+void testLevelSynchronousDepths(const GRAPH& g, const SUBGRAPH_MASK& mask) {
+    andres::graph::BreadthFirstSearchData<> expected(g);
+    andres::graph::LevelSynchronousBreadthFirstSearchData<> data(g);
+    for(std::size_t v = 0; v < g.numberOfVertices(); v += g.numberOfVertices() / 3 + 1) {
+        if(!mask.vertex(v)) {
+            continue;
+        }
+        expected.markAllNotvisited();
+        andres::graph::breadthFirstSearch(g, mask, v, [](std::size_t, std::size_t, bool& proceed, bool& add) {
+            proceed = true;
+            add = true;
+        }, expected);
+
+        data.markAllNotvisited();
+        std::size_t previousDepth = 0;
+        std::size_t previousVertex = 0;
+        std::size_t numberOfCalls = 0;
+        andres::graph::levelSynchronousBreadthFirstSearch(g, mask, v, [&](std::size_t w, std::size_t depth, bool& proceed, bool& add) {
+            // each vertex once, by depth and within a level in ascending order
+            test(data.depth(w) == andres::graph::LevelSynchronousBreadthFirstSearchData<>::NOT_VISITED);
+            test(depth > previousDepth || (depth == previousDepth && (w > previousVertex || numberOfCalls == 0)));
+            previousDepth = depth;
+            previousVertex = w;
+            ++numberOfCalls;
+            proceed = true;
+            add = true;
+        }, data);
+
+        for(std::size_t w = 0; w < g.numberOfVertices(); ++w) {
+            test(data.depth(w) == expected.depth(w));
+        }
+
+        // vertices for which add is false: the same depths, and the same
+        // calls up to their order within a level and repeated calls for a
+        // vertex within a level
+        auto add = [](const std::size_t w) { return w % 5 != 3; };
+        std::set<std::pair<std::size_t, std::size_t> > expectedCalls;
+        expected.markAllNotvisited();
+        andres::graph::breadthFirstSearch(g, mask, v, [&](std::size_t w, std::size_t depth, bool& proceed, bool& a) {
+            expectedCalls.insert(std::make_pair(depth, w));
+            proceed = true;
+            a = add(w);
+        }, expected);
+
+        std::vector<std::pair<std::size_t, std::size_t> > calls;
+        data.markAllNotvisited();
+        andres::graph::levelSynchronousBreadthFirstSearch(g, mask, v, [&](std::size_t w, std::size_t depth, bool& proceed, bool& a) {
+            test(data.depth(w) == andres::graph::LevelSynchronousBreadthFirstSearchData<>::NOT_VISITED);
+            calls.push_back(std::make_pair(depth, w));
+            proceed = true;
+            a = add(w);
+        }, data);
+
+        test(std::is_sorted(calls.begin(), calls.end()));
+        test(std::adjacent_find(calls.begin(), calls.end()) == calls.end());
+        test(std::set<std::pair<std::size_t, std::size_t> >(calls.begin(), calls.end()) == expectedCalls);
+        for(std::size_t w = 0; w < g.numberOfVertices(); ++w) {
+            test(data.depth(w) == expected.depth(w));
+        }
+    }
+}
+
+void testLevelSynchronous() {
+    andres::graph::Graph<> g(7);
+    g.insertEdge(0, 1);
+    g.insertEdge(0, 2);
+    g.insertEdge(0, 4);
+    g.insertEdge(1, 3);
+    g.insertEdge(1, 5);
+    g.insertEdge(2, 6);
+    g.insertEdge(4, 5);
+
+    {
+        SimpleCallback callback;
+        andres::graph::levelSynchronousBreadthFirstSearch(g, 0, callback);
+        const std::size_t vertices[] = {0, 1, 2, 4, 3, 5, 6};
+        const std::size_t depths[] = {0, 1, 1, 1, 2, 2, 2};
+        test(callback.vertexIndices_.size() == 7);
+        for(std::size_t j = 0; j < 7; ++j) {
+            test(callback.vertexIndices_[j] == vertices[j]);
+            test(callback.depths_[j] == depths[j]);
+        }
+    }
+
+    {
+        SearchCallback callback(2);
+        andres::graph::levelSynchronousBreadthFirstSearch(g, 0, callback);
+        test(callback.vertexIndices_.size() == 3);
+        test(callback.vertexIndices_[2] == 2);
+    }
+
+    {
+        BlockingCallback callback(1);
+        andres::graph::levelSynchronousBreadthFirstSearch(g, 0, callback);
+        const std::size_t vertices[] = {0, 1, 2, 4, 5, 6, 1};
+        test(callback.vertexIndices_.size() == 7);
+        for(std::size_t j = 0; j < 7; ++j) {
+            test(callback.vertexIndices_[j] == vertices[j]);
+        }
+    }
+
+    // as in breadthFirstSearch, a vertex for which add is false gets no depth
+    // and is passed to the callback again when reached from vertex 5. The
+    // callbacks differ only in the order of vertices within a level
+    {
+        BlockingCallback expected(1);
+        andres::graph::breadthFirstSearch(g, 0, expected);
+        const std::size_t expectedVertices[] = {0, 1, 2, 4, 6, 5, 1};
+        const std::size_t expectedDepths[] = {0, 1, 1, 1, 2, 2, 3};
+        test(expected.vertexIndices_.size() == 7);
+        for(std::size_t j = 0; j < 7; ++j) {
+            test(expected.vertexIndices_[j] == expectedVertices[j]);
+            test(expected.depths_[j] == expectedDepths[j]);
+        }
+
+        BlockingCallback callback(1);
+        andres::graph::LevelSynchronousBreadthFirstSearchData<> data(g);
+        andres::graph::levelSynchronousBreadthFirstSearch(g, 0, callback, data);
+        test(callback.vertexIndices_.size() == 7);
+        for(std::size_t j = 0; j < 7; ++j) {
+            test(callback.depths_[j] == expectedDepths[j]);
+            test(std::count(callback.vertexIndices_.begin(), callback.vertexIndices_.end(), expectedVertices[j])
+                == std::count(expected.vertexIndices_.begin(), expected.vertexIndices_.end(), expectedVertices[j]));
+        }
+        test(callback.vertexIndices_[6] == 1);
+        test(data.depth(1) == andres::graph::LevelSynchronousBreadthFirstSearchData<>::NOT_VISITED);
+        test(data.depth(3) == andres::graph::LevelSynchronousBreadthFirstSearchData<>::NOT_VISITED);
+
+        // a rejected start vertex gets no depth
+        data.markAllNotvisited();
+        BlockingCallback startCallback(0);
+        andres::graph::levelSynchronousBreadthFirstSearch(g, 0, startCallback, data);
+        test(startCallback.vertexIndices_.size() == 1);
+        test(data.depth(0) == andres::graph::LevelSynchronousBreadthFirstSearchData<>::NOT_VISITED);
+    }
+
+    // random graphs
+    std::size_t state = 1;
+    auto random = [&](const std::size_t n) {
+        state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+        return (state >> 33) % n;
+    };
+    {
+        andres::graph::Graph<> graph(3000);
+        for(std::size_t j = 0; j < 12000; ++j) {
+            graph.insertEdge(random(3000), random(3000));
+        }
+        testLevelSynchronousDepths(graph, andres::graph::DefaultSubgraphMask<>());
+        testLevelSynchronousDepths(graph, EvenVerticesMask());
+    }
+    {
+        andres::graph::Digraph<> graph(3000);
+        for(std::size_t j = 0; j < 15000; ++j) {
+            graph.insertEdge(random(3000), random(3000));
+        }
+        testLevelSynchronousDepths(graph, andres::graph::DefaultSubgraphMask<>());
+        testLevelSynchronousDepths(graph, EvenVerticesMask());
+    }
+    {
+        andres::graph::GridGraph<3> graph({20, 15, 10});
+        testLevelSynchronousDepths(graph, andres::graph::DefaultSubgraphMask<>());
+    }
+}
+
+// multi-source search reports the same depths as one search per source
+template<class GRAPH, class SUBGRAPH_MASK>
+void testMultiSourceDepths(const GRAPH& g, const SUBGRAPH_MASK& mask, const std::vector<std::size_t>& sources, const std::size_t maxDepth) {
+    const std::size_t NOT_VISITED = andres::graph::BreadthFirstSearchData<>::NOT_VISITED;
+    std::vector<std::vector<std::size_t> > depths(sources.size(), std::vector<std::size_t>(g.numberOfVertices(), NOT_VISITED));
+    std::size_t previousDepth = 0;
+    std::size_t previousBatch = 0;
+    andres::graph::MultiSourceBreadthFirstSearchData<> data(g);
+    andres::graph::multiSourceBreadthFirstSearch(g, mask, sources.begin(), sources.end(), maxDepth, [&](std::size_t s, std::size_t w, std::size_t depth) {
+        test(depth <= maxDepth);
+        std::size_t j = 0;
+        while(sources[j] != s) {
+            ++j;
+        }
+        // ordered by batch and depth
+        const std::size_t batch = j / andres::graph::MultiSourceBreadthFirstSearchData<>::BATCH_SIZE;
+        test(batch > previousBatch || (batch == previousBatch && depth >= previousDepth));
+        previousBatch = batch;
+        previousDepth = depth;
+        // duplicate sources share a batch and the depths
+        for(; j < sources.size(); ++j) {
+            if(sources[j] == s && depths[j][w] == NOT_VISITED) {
+                depths[j][w] = depth;
+                break;
+            }
+        }
+    }, data);
+
+    andres::graph::BreadthFirstSearchData<> expected(g);
+    for(std::size_t j = 0; j < sources.size(); ++j) {
+        expected.markAllNotvisited();
+        andres::graph::breadthFirstSearch(g, mask, sources[j], [&](std::size_t, std::size_t depth, bool& proceed, bool& add) {
+            proceed = true;
+            add = depth < maxDepth;
+        }, expected);
+        for(std::size_t w = 0; w < g.numberOfVertices(); ++w) {
+            if(expected.depth(w) != NOT_VISITED) {
+                test(depths[j][w] == expected.depth(w));
+            }
+            else if(w != sources[j]) {
+                test(depths[j][w] == NOT_VISITED || depths[j][w] == maxDepth);
+            }
+        }
+    }
+}
+
+void testMultiSource() {
+    std::size_t state = 1;
+    auto random = [&](const std::size_t n) {
+        state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+        return (state >> 33) % n;
+    };
+
+    andres::graph::Graph<> graph(500);
+    for(std::size_t j = 0; j < 800; ++j) {
+        graph.insertEdge(random(500), random(500));
+    }
+    std::vector<std::size_t> sources;
+    for(std::size_t j = 0; j < 150; ++j) {
+        sources.push_back((j * 7 + 3) % 500);
+    }
+    sources[3] = sources[2]; // duplicate source
+    testMultiSourceDepths(graph, andres::graph::DefaultSubgraphMask<>(), sources, 0);
+    testMultiSourceDepths(graph, andres::graph::DefaultSubgraphMask<>(), sources, 3);
+    testMultiSourceDepths(graph, andres::graph::DefaultSubgraphMask<>(), sources, 500);
+    testMultiSourceDepths(graph, EvenVerticesMask(), sources, 4);
+
+    andres::graph::Digraph<> digraph(500);
+    for(std::size_t j = 0; j < 1500; ++j) {
+        digraph.insertEdge(random(500), random(500));
+    }
+    testMultiSourceDepths(digraph, andres::graph::DefaultSubgraphMask<>(), sources, 5);
+}
+
+// searches with a workspace report the same vertices and depths as searches
+// with buffers that are reset for all vertices, also when one workspace is
+// used for graphs of different size and when its generation wraps around
+template<class GRAPH, class SUBGRAPH_MASK>
+void testWorkspaceSearches(const GRAPH& g, const SUBGRAPH_MASK& mask, andres::graph::SearchWorkspace<>& workspace) {
+    andres::graph::BreadthFirstSearchData<> expected(g);
+    for(std::size_t v = 0; v < g.numberOfVertices(); ++v) {
+        if(!mask.vertex(v)) {
+            continue;
+        }
+        const std::size_t blocked = (v * 7) % g.numberOfVertices();
+
+        BlockingCallback expectedCallback(blocked);
+        expected.markAllNotvisited();
+        andres::graph::breadthFirstSearch(g, mask, v, expectedCallback, expected);
+
+        BlockingCallback callback(blocked);
+        andres::graph::breadthFirstSearch(g, mask, v, callback, workspace);
+
+        test(callback.vertexIndices_ == expectedCallback.vertexIndices_);
+        test(callback.depths_ == expectedCallback.depths_);
+        for(std::size_t w = 0; w < g.numberOfVertices(); ++w) {
+            if(expected.depth(w) == andres::graph::BreadthFirstSearchData<>::NOT_VISITED) {
+                test(!workspace.isVisited(w));
+            }
+            else {
+                test(workspace.distance(w) == expected.depth(w));
+            }
+        }
+    }
+}
+
+void testWorkspace() {
+    std::size_t state = 1;
+    auto random = [&](const std::size_t n) {
+        state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+        return (state >> 33) % n;
+    };
+
+    andres::graph::SearchWorkspace<> workspace;
+    {
+        andres::graph::Graph<> graph(300);
+        for(std::size_t j = 0; j < 400; ++j) {
+            graph.insertEdge(random(300), random(300));
+        }
+        testWorkspaceSearches(graph, andres::graph::DefaultSubgraphMask<>(), workspace);
+        testWorkspaceSearches(graph, EvenVerticesMask(), workspace);
+    }
+    {
+        andres::graph::Digraph<> graph(100);
+        for(std::size_t j = 0; j < 300; ++j) {
+            graph.insertEdge(random(100), random(100));
+        }
+        workspace.generation_ = std::numeric_limits<andres::graph::SearchWorkspace<>::Generation>::max() - 10;
+        testWorkspaceSearches(graph, andres::graph::DefaultSubgraphMask<>(), workspace);
+    }
+    {
+        andres::graph::GridGraph<2> graph({20, 30});
+        testWorkspaceSearches(graph, andres::graph::DefaultSubgraphMask<>(), workspace);
+    }
+
+    // stop at a vertex
+    andres::graph::Graph<> g(7);
+    g.insertEdge(0, 1);
+    g.insertEdge(0, 2);
+    g.insertEdge(0, 4);
+    g.insertEdge(1, 3);
+    g.insertEdge(1, 5);
+    g.insertEdge(2, 6);
+    g.insertEdge(4, 5);
+    SearchCallback callback(2);
+    andres::graph::breadthFirstSearch(g, 0, callback, workspace);
+    test(callback.vertexIndices_.size() == 3);
+    test(callback.vertexIndices_[2] == 2);
+}
+
 int main() {
+    testLevelSynchronous();
+    testMultiSource();
+    testWorkspace();
+
     andres::graph::Graph<> g;
     g.insertVertices(7);
     g.insertEdge(0, 1);
@@ -0,0 +1,241 @@
+#include <cstddef>
+#include <stdexcept>
+#include <random>
+#include <set>
+#include <vector>
+
+#include "andres/graph/graph.hxx"
+#include "andres/graph/grid-graph.hxx"
+#include "andres/graph/components.hxx"
+#include "andres/graph/bridges.hxx"
+#include "andres/graph/cut-vertices.hxx"
+#include "andres/graph/biconnected-components.hxx"
+
+inline void test(const bool& pred) {
+    if(!pred) throw std::runtime_error("Test failed.");
+}
+
+using namespace andres::graph;
+
+// edges of a block remain connected if any single vertex is removed
+template<class GRAPH>
+void testBlock(
+    const GRAPH& graph,
+    const BiconnectedComponents<GRAPH>& components,
+    const std::size_t block
+) {
+    std::set<std::size_t> vertices;
+    for(auto it = components.edgesOfBlockBegin(block); it != components.edgesOfBlockEnd(block); ++it) {
+        vertices.insert(graph.vertexOfEdge(*it, 0));
+        vertices.insert(graph.vertexOfEdge(*it, 1));
+    }
+    if(components.numberOfEdgesInBlock(block) == 1) {
+        return;
+    }
+    for(std::size_t removed : vertices) {
+        struct Mask {
+            bool vertex(const std::size_t v) const
+                { return v != removed_; }
+            bool edge(const std::size_t e) const
+                { return (*blockOfEdge_)[e] == block_; }
+            std::size_t removed_;
+            std::size_t block_;
+            const std::vector<std::size_t>* blockOfEdge_;
+        } mask = {removed, block, &components.blockOfEdge_};
+        ComponentsBySearch<GRAPH> connectedComponents;
+        connectedComponents.build(graph, mask);
+        std::size_t first = removed;
+        for(std::size_t v : vertices) {
+            if(v == removed) {
+                continue;
+            }
+            if(first == removed) {
+                first = v;
+            }
+            test(connectedComponents.areConnected(first, v));
+        }
+    }
+}
+
+// blocks, cut vertices, bridges and the block-cut tree are consistent
+template<class GRAPH>
+void testConsistency(
+    const GRAPH& graph,
+    const BiconnectedComponents<GRAPH>& components
+) {
+    std::vector<char> isCutVertex(graph.numberOfVertices());
+    findCutVertices(graph, isCutVertex);
+    std::vector<char> isBridge(graph.numberOfEdges());
+    findBridges(graph, isBridge);
+
+    for(std::size_t v = 0; v < graph.numberOfVertices(); ++v) {
+        test(components.isCutVertex(v) == (isCutVertex[v] != 0));
+    }
+    std::size_t numberOfEdges = 0;
+    for(std::size_t b = 0; b < components.numberOfBlocks(); ++b) {
+        test(components.numberOfEdgesInBlock(b) > 0);
+        numberOfEdges += components.numberOfEdgesInBlock(b);
+        for(auto it = components.edgesOfBlockBegin(b); it != components.edgesOfBlockEnd(b); ++it) {
+            test(components.blockOfEdge_[*it] == b);
+        }
+        testBlock(graph, components, b);
+    }
+    test(numberOfEdges == graph.numberOfEdges());
+
+    // a vertex is a cut vertex iff it belongs to two or more blocks, and the
+    // block-cut tree connects exactly these vertices to their blocks
+    std::vector<std::set<std::size_t> > blocksOfVertex(graph.numberOfVertices());
+    for(std::size_t e = 0; e < graph.numberOfEdges(); ++e) {
+        // findBridges does not distinguish parallel edges
+        if(!graph.multipleEdgesEnabled()) {
+            test(components.isBridge(e) == (isBridge[e] != 0));
+        }
+        blocksOfVertex[graph.vertexOfEdge(e, 0)].insert(components.blockOfEdge_[e]);
+        blocksOfVertex[graph.vertexOfEdge(e, 1)].insert(components.blockOfEdge_[e]);
+    }
+    std::set<std::pair<std::size_t, std::size_t> > treeEdges;
+    for(std::size_t v = 0; v < graph.numberOfVertices(); ++v) {
+        test(components.isCutVertex(v) == (blocksOfVertex[v].size() >= 2));
+        if(components.isCutVertex(v)) {
+            for(std::size_t b : blocksOfVertex[v]) {
+                treeEdges.insert(std::make_pair(b, v));
+            }
+        }
+    }
+    test(treeEdges.size() == components.blockCutTree_.size());
+    for(std::size_t j = 0; j < components.blockCutTree_.size(); ++j) {
+        test(treeEdges.count(components.blockCutTree_[j]) == 1);
+        if(j > 0) {
+            test(components.blockCutTree_[j - 1] < components.blockCutTree_[j]);
+        }
+    }
+}
+
+void testSmallGraph() {
+    // two triangles sharing vertex 2, a pendant edge, two parallel edges
+    // and an isolated vertex
+    Graph<> graph(9);
+    graph.multipleEdgesEnabled() = true;
+    graph.insertEdge(0, 1); // 0
+    graph.insertEdge(1, 2); // 1
+    graph.insertEdge(0, 2); // 2
+    graph.insertEdge(2, 3); // 3
+    graph.insertEdge(3, 4); // 4
+    graph.insertEdge(2, 4); // 5
+    graph.insertEdge(4, 5); // 6
+    graph.insertEdge(5, 6); // 7
+    graph.insertEdge(5, 6); // 8
+
+    BiconnectedComponents<Graph<> > components;
+    test(components.build(graph) == 4);
+    test(components.blockOfEdge_[0] == components.blockOfEdge_[1]);
+    test(components.blockOfEdge_[0] == components.blockOfEdge_[2]);
+    test(components.blockOfEdge_[3] == components.blockOfEdge_[4]);
+    test(components.blockOfEdge_[3] == components.blockOfEdge_[5]);
+    test(components.blockOfEdge_[0] != components.blockOfEdge_[3]);
+    test(components.blockOfEdge_[7] == components.blockOfEdge_[8]);
+    test(components.isBridge(6));
+    test(!components.isBridge(7));
+
+    test(!components.isCutVertex(0));
+    test(components.isCutVertex(2));
+    test(components.isCutVertex(4));
+    test(components.isCutVertex(5));
+    test(!components.isCutVertex(6));
+    test(!components.isCutVertex(8));
+    test(components.blockCutTree_.size() == 6);
+    testConsistency(graph, components);
+
+    // the buffers are reused for a smaller graph
+    Graph<> path(3);
+    path.insertEdge(0, 1);
+    path.insertEdge(1, 2);
+    test(components.build(path) == 2);
+    test(components.isCutVertex(1));
+    test(components.blockCutTree_.size() == 2);
+    testConsistency(path, components);
+}
+
+void testSelfLoop() {
+    Graph<> graph(3);
+    graph.insertEdge(0, 1);
+    graph.insertEdge(1, 1);
+    graph.insertEdge(1, 2);
+
+    BiconnectedComponents<Graph<> > components;
+    test(components.build(graph) == 3);
+    test(components.numberOfEdgesInBlock(components.blockOfEdge_[1]) == 1);
+    test(!components.isBridge(1));
+    test(components.isBridge(0));
+    test(components.isBridge(2));
+    test(components.isCutVertex(1));
+    test(components.blockCutTree_.size() == 2);
+}
+
+void testSubgraph() {
+    // a cycle 0-1-2-3-0 with a chord 0-2 that is masked
+    Graph<> graph(4);
+    graph.insertEdge(0, 1);
+    graph.insertEdge(1, 2);
+    graph.insertEdge(2, 3);
+    graph.insertEdge(3, 0);
+    graph.insertEdge(0, 2);
+
+    struct Mask {
+        bool vertex(const std::size_t v) const
+            { return v != 3; }
+        bool edge(const std::size_t e) const
+            { return true; }
+    };
+
+    BiconnectedComponents<Graph<> > components;
+    test(components.build(graph, Mask()) == 1);
+    test(components.blockOfEdge_[0] == 0);
+    test(components.blockOfEdge_[1] == 0);
+    test(components.blockOfEdge_[4] == 0);
+    test(components.blockOfEdge_[2] == BiconnectedComponents<Graph<> >::NO_BLOCK);
+    test(components.blockOfEdge_[3] == BiconnectedComponents<Graph<> >::NO_BLOCK);
+    test(components.numberOfEdgesInBlock(0) == 3);
+    test(components.blockCutTree_.empty());
+}
+
+void testGridGraph() {
+    GridGraph<2> graph({4, 3});
+    BiconnectedComponents<GridGraph<2> > components;
+    test(components.build(graph) == 1);
+    for(std::size_t v = 0; v < graph.numberOfVertices(); ++v) {
+        test(!components.isCutVertex(v));
+    }
+}
+
+void testRandomGraphs() {
+    std::mt19937 generator(42);
+    BiconnectedComponents<Graph<> > components;
+    for(std::size_t trial = 0; trial < 200; ++trial) {
+        const std::size_t numberOfVertices = 2 + trial % 30;
+        const std::size_t numberOfEdges = trial % 40;
+        std::uniform_int_distribution<std::size_t> distribution(0, numberOfVertices - 1);
+
+        Graph<> graph(numberOfVertices);
+        for(std::size_t j = 0; j < numberOfEdges; ++j) {
+            const std::size_t v0 = distribution(generator);
+            const std::size_t v1 = distribution(generator);
+            if(v0 != v1) {
+                graph.insertEdge(v0, v1);
+            }
+        }
+
+        components.build(graph);
+        testConsistency(graph, components);
+    }
+}
+
+int main() {
+    testSmallGraph();
+    testSelfLoop();
+    testSubgraph();
+    testGridGraph();
+    testRandomGraphs();
+
+    return 0;
+}
@@ -1,6 +1,9 @@
+#include <random>
 #include <stdexcept>
+#include <vector>
 #include "andres/graph/complete-graph.hxx"
 #include "andres/graph/graph.hxx"
+#include "andres/graph/grid-graph.hxx"
 #include "andres/graph/bridges.hxx"
 
 
@@ -104,11 +107,120 @@ void testCompleteGraph()
     test(isBridge[graph.findEdge(3, 4).second] == false);
 }
 
+void testParallel()
+{
+    Graph<> graph(8);
+    graph.insertEdge(0, 1); // 0
+    graph.insertEdge(0, 2); // 1
+    graph.insertEdge(1, 3); // 2
+    graph.insertEdge(2, 4); // 3
+    graph.insertEdge(2, 5); // 4
+    graph.insertEdge(4, 6); // 5
+    graph.insertEdge(5, 6); // 6
+
+    ParallelBridgesBuffers<Graph<>> buffer(graph);
+    std::vector<char> isBridge(graph.numberOfEdges(), 2);
+    findBridges(graph, isBridge, buffer);
+
+    test(isBridge[0] == true);
+    test(isBridge[1] == true);
+    test(isBridge[2] == true);
+    test(isBridge[3] == false);
+    test(isBridge[4] == false);
+    test(isBridge[5] == false);
+    test(isBridge[6] == false);
+
+    struct mask
+    {
+        bool vertex(std::size_t i) const
+        {
+            return i != 1;
+        }
+
+        bool edge(std::size_t i) const
+        {
+            return !(i == 3);
+        }
+    };
+
+    std::fill(isBridge.begin(), isBridge.end(), 2);
+    findBridges(graph, mask(), isBridge, buffer);
+
+    test(isBridge[0] == 2);
+    test(isBridge[1] == true);
+    test(isBridge[2] == 2);
+    test(isBridge[3] == 2);
+    test(isBridge[4] == true);
+    test(isBridge[5] == true);
+    test(isBridge[6] == true);
+
+    // parallel edges are not bridges
+    graph.multipleEdgesEnabled() = true;
+    graph.insertEdge(0, 2); // 7
+    ParallelBridgesBuffers<Graph<>> multigraphBuffer(graph);
+    isBridge.resize(graph.numberOfEdges());
+    findBridges(graph, isBridge, multigraphBuffer);
+
+    test(isBridge[0] == true);
+    test(isBridge[1] == false);
+    test(isBridge[2] == true);
+    test(isBridge[7] == false);
+}
+
+void testParallelGridGraph()
+{
+    GridGraph<2> graph({5, 4});
+    ParallelBridgesBuffers<GridGraph<2>> buffer(graph);
+
+    std::vector<char> isBridge(graph.numberOfEdges());
+    findBridges(graph, isBridge, buffer);
+
+    for (std::size_t e = 0; e < graph.numberOfEdges(); ++e)
+        test(isBridge[e] == false);
+}
+
+// the parallel and the sequential algorithm find the same bridges
+void testParallelRandomGraphs()
+{
+    std::mt19937 generator(42);
+
+    for (std::size_t trial = 0; trial < 200; ++trial)
+    {
+        const std::size_t numberOfVertices = 2 + trial % 30;
+        const std::size_t numberOfEdges = trial % 40;
+        std::uniform_int_distribution<std::size_t> distribution(0, numberOfVertices - 1);
+
+        Graph<> graph(numberOfVertices);
+        for (std::size_t j = 0; j < numberOfEdges; ++j)
+        {
+            const std::size_t v0 = distribution(generator);
+            const std::size_t v1 = distribution(generator);
+            if (v0 != v1)
+                graph.insertEdge(v0, v1);
+        }
+
+        std::vector<char> isBridge(graph.numberOfEdges());
+        findBridges(graph, isBridge);
+
+        ParallelBridgesBuffers<Graph<>> buffer(graph);
+        std::vector<char> isBridgeParallel(graph.numberOfEdges());
+        findBridges(graph, isBridgeParallel, buffer);
+
+        test(isBridgeParallel == isBridge);
+    }
+}
+
 int main()
 {
     test();
 
     testCompleteGraph();
 
+    testParallel();
+
+    testParallelGridGraph();
+
+    testParallelRandomGraphs();
+
     return 0;
-}
\ No newline at end of file
+}
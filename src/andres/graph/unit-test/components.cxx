@@ -65,13 +65,86 @@ void testComponents() {
     test(!components.areConnected(5, 9));
 }
 
+template<class COMPONENTS>
+void testBitsetSubgraphMask() {
+    typedef COMPONENTS Components;
+    typedef typename Components::Graph Graph;
+
+    Graph graph(100);
+    for(std::size_t v = 0; v + 1 < graph.numberOfVertices(); ++v) {
+        graph.insertEdge(v, v + 1);
+    }
+
+    andres::graph::BitsetSubgraphMask<> mask(graph, SubgraphMask());
+    for(std::size_t v = 0; v < graph.numberOfVertices(); ++v) {
+        test(mask.vertex(v) == SubgraphMask().vertex(v));
+    }
+    for(std::size_t e = 0; e < graph.numberOfEdges(); ++e) {
+        test(mask.edge(e) == SubgraphMask().edge(e));
+    }
+
+    Components components;
+    components.build(graph, mask);
+    test(!components.areConnected(0, 1));
+    test(components.areConnected(1, 2));
+    test(!components.areConnected(2, 4));
+    test(components.areConnected(4, 99));
+
+    mask.setEdge(70, false);
+    test(!mask.edge(70));
+    components.build(graph, mask);
+    test(components.areConnected(4, 70));
+    test(components.areConnected(71, 99));
+    test(!components.areConnected(70, 71));
+
+    mask.setEdge(70, true);
+    mask.setVertex(3, true);
+    components.build(graph, mask);
+    test(!components.areConnected(0, 1));
+    test(components.areConnected(1, 99));
+}
+
+// labels equal those of ComponentsBySearch, also when rebuilt for graphs of different size
+void testParallelUnionFindLabels() {
+    typedef andres::graph::Graph<> Graph;
+
+    andres::graph::ComponentsBySearch<Graph> componentsBySearch;
+    andres::graph::ComponentsByParallelUnionFind<Graph> components;
+    for(std::size_t n = 1000; n <= 4000; n += 3000) {
+        Graph graph(n);
+        std::size_t state = 1;
+        for(std::size_t j = 0; j < n / 2; ++j) {
+            state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+            const std::size_t v0 = (state >> 33) % n;
+            state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+            const std::size_t v1 = (state >> 33) % n;
+            graph.insertEdge(v0, v1);
+        }
+
+        const std::size_t numberOfComponents = componentsBySearch.build(graph);
+        test(components.build(graph) == numberOfComponents);
+        test(components.labels_ == componentsBySearch.labels_);
+
+        const SubgraphMask mask;
+        const std::size_t numberOfSubgraphComponents = componentsBySearch.build(graph, mask);
+        test(components.build(graph, mask) == numberOfSubgraphComponents);
+        test(components.labels_ == componentsBySearch.labels_);
+    }
+}
+
 int main() {
     typedef andres::graph::Graph<> Graph;
     typedef andres::graph::ComponentsBySearch<Graph> ComponentsBySearch;
     typedef andres::graph::ComponentsByPartition<Graph> ComponentsByPartition;
+    typedef andres::graph::ComponentsByParallelUnionFind<Graph> ComponentsByParallelUnionFind;
 
     testComponents<ComponentsBySearch>();
     testComponents<ComponentsByPartition>();
+    testComponents<ComponentsByParallelUnionFind>();
+    testBitsetSubgraphMask<ComponentsBySearch>();
+    testBitsetSubgraphMask<ComponentsByPartition>();
+    testBitsetSubgraphMask<ComponentsByParallelUnionFind>();
+    testParallelUnionFindLabels();
 
     return 0;
 }
@@ -1,6 +1,9 @@
+#include <random>
 #include <stdexcept>
+#include <vector>
 #include "andres/graph/complete-graph.hxx"
 #include "andres/graph/graph.hxx"
+#include "andres/graph/grid-graph.hxx"
 #include "andres/graph/cut-vertices.hxx"
 
 
@@ -95,11 +98,133 @@ void testCompleteGraph()
     test(isCutVertex[4] == false);
 }
 
+void testParallel()
+{
+    Graph<> graph(8);
+    graph.insertEdge(0, 1);
+    graph.insertEdge(0, 2);
+    graph.insertEdge(1, 3);
+    graph.insertEdge(2, 4);
+    graph.insertEdge(2, 5);
+    graph.insertEdge(4, 6);
+    graph.insertEdge(5, 6);
+
+    ParallelCutVerticesBuffers<Graph<>> buffer(graph);
+    std::vector<char> isCutVertex(graph.numberOfVertices(), 2);
+    findCutVertices(graph, isCutVertex, buffer);
+
+    test(isCutVertex[0] == true);
+    test(isCutVertex[1] == true);
+    test(isCutVertex[2] == true);
+    test(isCutVertex[3] == false);
+    test(isCutVertex[4] == false);
+    test(isCutVertex[5] == false);
+    test(isCutVertex[6] == false);
+    test(isCutVertex[7] == false);
+
+    struct mask
+    {
+        bool vertex(std::size_t i) const
+        {
+            return !(i == 4 || i == 5 || i == 6);
+        }
+
+        bool edge(std::size_t i) const
+        {
+            return true;
+        }
+    };
+
+    std::fill(isCutVertex.begin(), isCutVertex.end(), 2);
+    findCutVertices(graph, mask(), isCutVertex, buffer);
+
+    test(isCutVertex[0] == true);
+    test(isCutVertex[1] == true);
+    test(isCutVertex[2] == false);
+    test(isCutVertex[3] == false);
+    test(isCutVertex[4] == 2);
+    test(isCutVertex[5] == 2);
+    test(isCutVertex[6] == 2);
+    test(isCutVertex[7] == false);
+}
+
+void testParallelGridGraph()
+{
+    GridGraph<2> graph({5, 4});
+    ParallelCutVerticesBuffers<GridGraph<2>> buffer(graph);
+
+    std::vector<char> isCutVertex(graph.numberOfVertices());
+    findCutVertices(graph, isCutVertex, buffer);
+
+    for (std::size_t v = 0; v < graph.numberOfVertices(); ++v)
+        test(isCutVertex[v] == false);
+
+    // the first row is joined to the rest of the grid by vertex 5 only
+    struct mask
+    {
+        bool vertex(std::size_t i) const
+        {
+            return i / 5 != 1 || i == 5;
+        }
+
+        bool edge(std::size_t i) const
+        {
+            return true;
+        }
+    };
+
+    std::fill(isCutVertex.begin(), isCutVertex.end(), 2);
+    findCutVertices(graph, mask(), isCutVertex, buffer);
+
+    for (std::size_t v = 0; v < graph.numberOfVertices(); ++v)
+        if (v / 5 == 1 && v != 5)
+            test(isCutVertex[v] == 2);
+        else
+            test(isCutVertex[v] == (v < 4 || v == 5 || v == 10));
+}
+
+// the parallel and the sequential algorithm find the same cut vertices
+void testParallelRandomGraphs()
+{
+    std::mt19937 generator(42);
+
+    for (std::size_t trial = 0; trial < 200; ++trial)
+    {
+        const std::size_t numberOfVertices = 2 + trial % 30;
+        const std::size_t numberOfEdges = trial % 40;
+        std::uniform_int_distribution<std::size_t> distribution(0, numberOfVertices - 1);
+
+        Graph<> graph(numberOfVertices);
+        for (std::size_t j = 0; j < numberOfEdges; ++j)
+        {
+            const std::size_t v0 = distribution(generator);
+            const std::size_t v1 = distribution(generator);
+            if (v0 != v1)
+                graph.insertEdge(v0, v1);
+        }
+
+        std::vector<char> isCutVertex(graph.numberOfVertices());
+        findCutVertices(graph, isCutVertex);
+
+        ParallelCutVerticesBuffers<Graph<>> buffer(graph);
+        std::vector<char> isCutVertexParallel(graph.numberOfVertices());
+        findCutVertices(graph, isCutVertexParallel, buffer);
+
+        test(isCutVertexParallel == isCutVertex);
+    }
+}
+
 int main()
 {
     test();
 
     testCompleteGraph();
 
+    testParallel();
+
+    testParallelGridGraph();
+
+    testParallelRandomGraphs();
+
     return 0;
-}
\ No newline at end of file
+}
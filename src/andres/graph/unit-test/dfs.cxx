@@ -1,7 +1,10 @@
 #include <stdexcept>
+#include <limits>
+#include <algorithm>
 
 #include "andres/graph/graph.hxx"
 #include "andres/graph/dfs.hxx"
+#include "andres/graph/search-workspace.hxx"
 
 inline void test(const bool condition) {
     if(!condition) throw std::logic_error("test failed.");
@@ -130,5 +133,26 @@ int main() {
         test(callback.vertexIndices_[8] == 8);
     }
 
+    // searches with a reused workspace visit the same vertices in the same order
+    {
+        andres::graph::SearchWorkspace<> workspace;
+        workspace.generation_ = std::numeric_limits<andres::graph::SearchWorkspace<>::Generation>::max() - 3;
+        for(std::size_t v = 0; v < g.numberOfVertices(); ++v) {
+            BlockingCallback expected(2);
+            andres::graph::depthFirstSearch(g, v, expected);
+            BlockingCallback callback(2);
+            andres::graph::depthFirstSearch(g, v, callback, workspace);
+            test(callback.vertexIndices_ == expected.vertexIndices_);
+            for(std::size_t w = 0; w < g.numberOfVertices(); ++w) {
+                test(workspace.isVisited(w) == (std::find(expected.vertexIndices_.begin(), expected.vertexIndices_.end(), w) != expected.vertexIndices_.end()));
+            }
+        }
+
+        SearchCallback callback(3);
+        andres::graph::depthFirstSearch(g, 0, callback, workspace);
+        test(callback.vertexIndices_.size() == 5);
+        test(callback.vertexIndices_[4] == 3);
+    }
+
     return 0;
 }
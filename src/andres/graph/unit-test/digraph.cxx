@@ -1,6 +1,10 @@
+#include <cstdint>
 #include <stdexcept>
+#include <vector>
+#include <utility>
 
 #include "andres/graph/digraph.hxx"
+#include "andres/graph/arena.hxx"
 
 inline void test(const bool& pred) { 
     if(!pred) throw std::runtime_error("Test failed."); 
@@ -274,6 +278,55 @@ void testIterators() {
     }
 }
 
+void testEdgesInsertion() {
+    typedef std::pair<std::size_t, std::size_t> Pair;
+    std::vector<Pair> pairs;
+    pairs.push_back(Pair(0, 1));
+    pairs.push_back(Pair(2, 1));
+    pairs.push_back(Pair(1, 0));
+    pairs.push_back(Pair(3, 3));
+    pairs.push_back(Pair(0, 2));
+    pairs.push_back(Pair(2, 1));
+    pairs.push_back(Pair(3, 0));
+
+    for(std::size_t multipleEdgesEnabled = 0; multipleEdgesEnabled < 2; ++multipleEdgesEnabled) {
+        andres::graph::Digraph<> g(4);
+        andres::graph::Digraph<> reference(4);
+        g.multipleEdgesEnabled() = static_cast<bool>(multipleEdgesEnabled);
+        reference.multipleEdgesEnabled() = static_cast<bool>(multipleEdgesEnabled);
+
+        // insert into an empty graph and into a graph that has edges already
+        for(std::size_t j = 0; j < 2; ++j) {
+            const std::size_t position = g.insertEdges(pairs.begin() + 2 * j, pairs.end());
+            test(position == reference.numberOfEdges());
+            for(std::size_t k = 2 * j; k < pairs.size(); ++k) {
+                reference.insertEdge(pairs[k].first, pairs[k].second);
+            }
+
+            test(g.numberOfEdges() == reference.numberOfEdges());
+            for(std::size_t e = 0; e < g.numberOfEdges(); ++e) {
+                test(g.vertexOfEdge(e, 0) == reference.vertexOfEdge(e, 0));
+                test(g.vertexOfEdge(e, 1) == reference.vertexOfEdge(e, 1));
+            }
+            for(std::size_t v = 0; v < g.numberOfVertices(); ++v) {
+                test(g.numberOfEdgesFromVertex(v) == reference.numberOfEdgesFromVertex(v));
+                test(g.numberOfEdgesToVertex(v) == reference.numberOfEdgesToVertex(v));
+                for(std::size_t k = 0; k < g.numberOfEdgesFromVertex(v); ++k) {
+                    test(g.adjacencyFromVertex(v, k) == reference.adjacencyFromVertex(v, k));
+                }
+                for(std::size_t k = 0; k < g.numberOfEdgesToVertex(v); ++k) {
+                    test(g.adjacencyToVertex(v, k) == reference.adjacencyToVertex(v, k));
+                }
+            }
+        }
+    }
+    {
+        andres::graph::Digraph<> g(4);
+        test(g.insertEdges(pairs.begin(), pairs.end()) == 0);
+        test(g.numberOfEdges() == 6);
+    }
+}
+
 void testEdgeRemoval() {
     andres::graph::Digraph<> g(3);
     g.multipleEdgesEnabled() = true;
@@ -441,15 +494,228 @@ void testMultipleEdges() {
     test(g.vertexOfEdge(2, 1) == 0);
 }
 
+template<class GRAPH_A, class GRAPH_B>
+void testEqual(const GRAPH_A& a, const GRAPH_B& b) {
+    test(a.numberOfVertices() == b.numberOfVertices());
+    test(a.numberOfEdges() == b.numberOfEdges());
+    for(size_t e = 0; e < a.numberOfEdges(); ++e) {
+        test(a.vertexOfEdge(e, 0) == b.vertexOfEdge(e, 0));
+        test(a.vertexOfEdge(e, 1) == b.vertexOfEdge(e, 1));
+    }
+    for(size_t v = 0; v < a.numberOfVertices(); ++v) {
+        test(a.numberOfEdgesFromVertex(v) == b.numberOfEdgesFromVertex(v));
+        test(a.numberOfEdgesToVertex(v) == b.numberOfEdgesToVertex(v));
+        for(size_t j = 0; j < a.numberOfEdgesFromVertex(v); ++j) {
+            test(a.vertexFromVertex(v, j) == b.vertexFromVertex(v, j));
+            test(a.edgeFromVertex(v, j) == b.edgeFromVertex(v, j));
+            test(*(a.verticesFromVertexBegin(v) + j) == b.vertexFromVertex(v, j));
+        }
+        for(size_t j = 0; j < a.numberOfEdgesToVertex(v); ++j) {
+            test(a.vertexToVertex(v, j) == b.vertexToVertex(v, j));
+            test(a.edgeToVertex(v, j) == b.edgeToVertex(v, j));
+        }
+        for(size_t w = 0; w < a.numberOfVertices(); ++w) {
+            test(a.findEdge(v, w) == b.findEdge(v, w));
+        }
+    }
+}
+
+void testIndexType() {
+    typedef andres::graph::Digraph<std::uint32_t> GraphType;
+    test(sizeof(GraphType::AdjacencyType) == 2 * sizeof(std::uint32_t));
+    test(sizeof(andres::graph::Digraph<andres::graph::IdleGraphVisitor<std::uint32_t> >::AdjacencyType) == 2 * sizeof(std::uint32_t));
+
+    std::vector<std::pair<size_t, size_t> > edges;
+    edges.push_back(std::make_pair(0, 1));
+    edges.push_back(std::make_pair(1, 2));
+    edges.push_back(std::make_pair(2, 0));
+    edges.push_back(std::make_pair(3, 1));
+    edges.push_back(std::make_pair(4, 4));
+
+    GraphType g(5);
+    andres::graph::Digraph<> reference(5);
+    g.insertEdges(edges.begin(), edges.end());
+    reference.insertEdges(edges.begin(), edges.end());
+    g.insertEdge(3, 2);
+    reference.insertEdge(3, 2);
+    g.eraseEdge(1);
+    reference.eraseEdge(1);
+    g.eraseVertex(0);
+    reference.eraseVertex(0);
+
+    testEqual(g, reference);
+}
+
+void testArenaAllocator() {
+    typedef andres::graph::Digraph<andres::graph::IdleGraphVisitor<>, andres::graph::ArenaAllocator<> > GraphType;
+
+    GraphType g(6);
+    andres::graph::Digraph<> reference(6);
+    for(size_t j = 0; j < 6; ++j) {
+        for(size_t k = 0; k < 6; ++k) {
+            if((j + 2 * k) % 3 == 0) {
+                g.insertEdge(j, k);
+                reference.insertEdge(j, k);
+            }
+        }
+    }
+    testEqual(g, reference);
+
+    g.eraseVertex(1);
+    reference.eraseVertex(1);
+    g.eraseEdge(2);
+    reference.eraseEdge(2);
+    g.insertVertex();
+    reference.insertVertex();
+    g.insertEdge(5, 0);
+    reference.insertEdge(5, 0);
+    testEqual(g, reference);
+
+    // copies have their own arena
+    andres::graph::ArenaAllocator<> allocator;
+    test(std::allocator_traits<andres::graph::ArenaAllocator<> >::select_on_container_copy_construction(allocator) != allocator);
+    test(andres::graph::ArenaAllocator<int>(allocator) == allocator);
+    GraphType h(g);
+    h.eraseVertex(0);
+    h.insertEdge(0, 1);
+    testEqual(g, reference);
+    GraphType i;
+    i = g;
+    i.insertVertices(10);
+    i.insertEdge(7, 8);
+    testEqual(g, reference);
+    h = i;
+    i.eraseVertex(7);
+    h.eraseEdge(0);
+    testEqual(g, reference);
+    test(h.numberOfVertices() == g.numberOfVertices() + 10);
+    test(i.numberOfVertices() == g.numberOfVertices() + 9);
+
+    g.assign(3);
+    reference.assign(3);
+    g.insertEdge(0, 2);
+    reference.insertEdge(0, 2);
+    testEqual(g, reference);
+
+    // all vertices share one arena, held by the graph and by the
+    // adjacencies of each vertex
+    {
+        GraphType big(1000);
+        big.insertVertices(500);
+        big.insertVertex();
+        for(size_t j = 0; j + 1 < big.numberOfVertices(); ++j) {
+            big.insertEdge(j, j + 1);
+        }
+        const andres::graph::ArenaAllocator<> allocator = big.get_allocator();
+        test(allocator.arena().use_count() == static_cast<long>(2 + 2 * big.numberOfVertices()));
+        test(allocator.arena()->numberOfSlabs() <= 4);
+
+        big.assign(1000);
+        test(big.get_allocator() != allocator);
+        test(big.get_allocator().arena().use_count() == static_cast<long>(2 + 2 * big.numberOfVertices()));
+    }
+}
+
+struct RelabelingVisitor : andres::graph::IdleGraphVisitor<size_t> {
+    RelabelingVisitor(std::vector<size_t>* vertexLabels = 0, std::vector<size_t>* edgeLabels = 0)
+        : vertexLabels_(vertexLabels), edgeLabels_(edgeLabels) {}
+    void eraseVertex(const size_t a) const { (*vertexLabels_)[a] = -1; }
+    void relabelVertex(const size_t a, const size_t b) const { (*vertexLabels_)[a] = b; }
+    void eraseEdge(const size_t a) const { (*edgeLabels_)[a] = -1; }
+    void relabelEdge(const size_t a, const size_t b) const { (*edgeLabels_)[a] = b; }
+
+    std::vector<size_t>* vertexLabels_;
+    std::vector<size_t>* edgeLabels_;
+};
+
+void testEraseEdgesAndVertices() {
+    std::vector<std::pair<size_t, size_t> > edges;
+    for(size_t j = 0; j < 7; ++j) {
+        for(size_t k = 0; k < 7; ++k) {
+            if((j + 2 * k) % 3 == 0) {
+                edges.push_back(std::make_pair(j, k));
+            }
+        }
+    }
+
+    std::vector<size_t> vertexLabels(7);
+    std::vector<size_t> edgeLabels;
+    andres::graph::Digraph<RelabelingVisitor> g(7, RelabelingVisitor(&vertexLabels, &edgeLabels));
+    for(size_t j = 0; j < edges.size(); ++j) {
+        g.insertEdge(edges[j].first, edges[j].second);
+    }
+    const andres::graph::Digraph<RelabelingVisitor> original = g;
+
+    // erase edges
+    std::vector<char> edgeMask(g.numberOfEdges());
+    for(size_t e = 0; e < g.numberOfEdges(); ++e) {
+        edgeMask[e] = (e % 3 == 1);
+    }
+    edgeLabels.resize(g.numberOfEdges());
+    for(size_t e = 0; e < edgeLabels.size(); ++e) {
+        edgeLabels[e] = e;
+    }
+    g.eraseEdges(edgeMask);
+
+    andres::graph::Digraph<> reference(7);
+    for(size_t e = 0; e < original.numberOfEdges(); ++e) {
+        if(!edgeMask[e]) {
+            test(edgeLabels[e] == reference.numberOfEdges());
+            reference.insertEdge(original.vertexOfEdge(e, 0), original.vertexOfEdge(e, 1));
+        }
+        else {
+            test(edgeLabels[e] == size_t(-1));
+        }
+    }
+    testEqual(g, reference);
+
+    // erase vertices
+    std::vector<char> vertexMask(g.numberOfVertices());
+    vertexMask[0] = 1;
+    vertexMask[3] = 1;
+    vertexMask[4] = 1;
+    for(size_t v = 0; v < vertexLabels.size(); ++v) {
+        vertexLabels[v] = v;
+    }
+    edgeLabels.resize(g.numberOfEdges());
+    for(size_t e = 0; e < edgeLabels.size(); ++e) {
+        edgeLabels[e] = e;
+    }
+    g.eraseVertices(vertexMask);
+
+    test(vertexLabels[0] == size_t(-1));
+    test(vertexLabels[1] == 0);
+    test(vertexLabels[2] == 1);
+    test(vertexLabels[5] == 2);
+    test(vertexLabels[6] == 3);
+    andres::graph::Digraph<> reference2(4);
+    for(size_t e = 0; e < reference.numberOfEdges(); ++e) {
+        const size_t v0 = reference.vertexOfEdge(e, 0);
+        const size_t v1 = reference.vertexOfEdge(e, 1);
+        if(!vertexMask[v0] && !vertexMask[v1]) {
+            test(edgeLabels[e] == reference2.numberOfEdges());
+            reference2.insertEdge(vertexLabels[v0], vertexLabels[v1]);
+        }
+        else {
+            test(edgeLabels[e] == size_t(-1));
+        }
+    }
+    testEqual(g, reference2);
+}
+
 int main() {
     testConstruction();
     testVertexInsertion();
     testEdgeInsertion();
+    testEdgesInsertion();
     testIterators();
     testEdgeRemoval();
     testVertexRemoval();
     testfindEdge();
     testMultipleEdges();
+    testIndexType();
+    testArenaAllocator();
+    testEraseEdgesAndVertices();
 
     return 0;
 }
@@ -0,0 +1,140 @@
+#include <cstddef>
+#include <stdexcept>
+#include <random>
+#include <vector>
+
+#include "andres/graph/graph.hxx"
+#include "andres/graph/components.hxx"
+#include "andres/graph/dynamic-connectivity.hxx"
+
+inline void test(const bool& pred) {
+    if(!pred) throw std::runtime_error("Test failed.");
+}
+
+using namespace andres::graph;
+
+// subgraph mask of the edges that have not been erased
+struct NotErased {
+    bool vertex(const std::size_t v) const
+        { return true; }
+    bool edge(const std::size_t e) const
+        { return !(*erased_)[e]; }
+    const std::vector<char>* erased_;
+};
+
+void testSmallGraph() {
+    // a cycle 0-1-2-3-0, a pendant edge 3-4 and an isolated vertex 5
+    Graph<> graph(6);
+    graph.insertEdge(0, 1);
+    graph.insertEdge(1, 2);
+    graph.insertEdge(2, 3);
+    graph.insertEdge(3, 0);
+    graph.insertEdge(3, 4);
+
+    DynamicConnectivity<Graph<> > connectivity;
+    connectivity.build(graph);
+    test(connectivity.numberOfVertices() == 6);
+    test(connectivity.numberOfEdges() == 5);
+    test(connectivity.areConnected(0, 4));
+    test(!connectivity.areConnected(0, 5));
+    test(connectivity.areConnected(5, 5));
+
+    // erasing an edge of the cycle keeps the graph connected
+    connectivity.eraseEdge(1);
+    test(connectivity.isEdgeErased(1));
+    test(connectivity.areConnected(1, 2));
+    test(connectivity.areConnected(1, 4));
+
+    connectivity.eraseEdge(3);
+    test(!connectivity.areConnected(0, 2));
+    test(connectivity.areConnected(0, 1));
+    test(connectivity.areConnected(2, 4));
+
+    // inserted edges reconnect
+    test(connectivity.insertEdge(1, 5) == 5);
+    test(connectivity.insertEdge(5, 2) == 6);
+    test(connectivity.areConnected(0, 4));
+    connectivity.eraseEdge(4);
+    test(!connectivity.areConnected(3, 4));
+    test(connectivity.areConnected(0, 3));
+}
+
+void testSubgraph() {
+    Graph<> graph(3);
+    graph.insertEdge(0, 1);
+    graph.insertEdge(1, 2);
+    graph.insertEdge(1, 1);
+
+    struct Mask {
+        bool vertex(const std::size_t v) const
+            { return true; }
+        bool edge(const std::size_t e) const
+            { return e != 1; }
+    };
+
+    DynamicConnectivity<Graph<> > connectivity;
+    connectivity.build(graph, Mask());
+    test(connectivity.isEdgeErased(1));
+    test(!connectivity.isEdgeErased(2));
+    test(connectivity.areConnected(0, 1));
+    test(!connectivity.areConnected(0, 2));
+    connectivity.eraseEdge(2);
+    test(connectivity.areConnected(0, 1));
+}
+
+// erase edges of random graphs in random order, and insert some, comparing
+// with components computed from scratch
+void testRandomGraphs() {
+    std::mt19937 generator(42);
+    DynamicConnectivity<Graph<> > connectivity;
+    for(std::size_t trial = 0; trial < 100; ++trial) {
+        const std::size_t numberOfVertices = 2 + trial % 40;
+        const std::size_t numberOfEdges = 3 * trial % 120;
+        std::uniform_int_distribution<std::size_t> distribution(0, numberOfVertices - 1);
+
+        Graph<> graph(numberOfVertices);
+        graph.multipleEdgesEnabled() = true;
+        for(std::size_t j = 0; j < numberOfEdges; ++j) {
+            graph.insertEdge(distribution(generator), distribution(generator));
+        }
+        std::vector<char> erased(graph.numberOfEdges());
+        for(std::size_t e = 0; e < graph.numberOfEdges(); ++e) {
+            erased[e] = generator() % 8 == 0;
+        }
+        const NotErased mask = {&erased};
+        connectivity.build(graph, mask);
+
+        ComponentsBySearch<Graph<> > components;
+        for(std::size_t step = 0; step < 2 * numberOfEdges; ++step) {
+            if(generator() % 4 == 0) {
+                const std::size_t v0 = distribution(generator);
+                const std::size_t v1 = distribution(generator);
+                test(connectivity.insertEdge(v0, v1) == graph.insertEdge(v0, v1));
+                erased.push_back(0);
+            }
+            else {
+                std::size_t e = generator() % graph.numberOfEdges();
+                if(erased[e]) {
+                    continue;
+                }
+                connectivity.eraseEdge(e);
+                erased[e] = 1;
+            }
+
+            components.build(graph, mask);
+            for(std::size_t v0 = 0; v0 < numberOfVertices; ++v0) {
+                for(std::size_t v1 = 0; v1 < numberOfVertices; ++v1) {
+                    test(connectivity.areConnected(v0, v1) == components.areConnected(v0, v1));
+                }
+            }
+        }
+    }
+}
+
+int main() {
+    testSmallGraph();
+    testSubgraph();
+    testRandomGraphs();
+
+    return 0;
+}
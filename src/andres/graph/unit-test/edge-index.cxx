@@ -0,0 +1,124 @@
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+
+#include "andres/graph/graph.hxx"
+#include "andres/graph/digraph.hxx"
+#include "andres/graph/complete-graph.hxx"
+#include "andres/graph/edge-index.hxx"
+#include "andres/graph/paths.hxx"
+
+inline void test(const bool& pred) {
+    if(!pred) throw std::runtime_error("Test failed.");
+}
+
+template<class GRAPH>
+void testFindEdge(const GRAPH& graph, const andres::graph::EdgeIndex<GRAPH>& edgeIndex) {
+    for(std::size_t v = 0; v < graph.numberOfVertices(); ++v)
+    for(std::size_t w = 0; w < graph.numberOfVertices(); ++w) {
+        const std::pair<bool, std::size_t> p = graph.findEdge(v, w);
+        const std::pair<bool, std::size_t> q = edgeIndex.findEdge(v, w);
+        test(p.first == q.first);
+        if(p.first) {
+            test(p.second == q.second);
+        }
+    }
+}
+
+void testGraph() {
+    andres::graph::Graph<> graph(10);
+    for(std::size_t v = 0; v < graph.numberOfVertices(); ++v)
+    for(std::size_t w = 0; w < v; ++w) {
+        if((v * w) % 3 == 1) {
+            graph.insertEdge(v, w);
+        }
+    }
+    graph.insertEdge(4, 4);
+
+    andres::graph::EdgeIndex<andres::graph::Graph<> > edgeIndex(graph);
+    test(edgeIndex.numberOfEdges() == graph.numberOfEdges());
+    testFindEdge(graph, edgeIndex);
+
+    // insertion with rehashing
+    for(std::size_t v = 0; v < graph.numberOfVertices(); ++v)
+    for(std::size_t w = 0; w < v; ++w) {
+        if(!graph.findEdge(v, w).first) {
+            const std::size_t edge = graph.insertEdge(w, v);
+            edgeIndex.insertEdge(w, v, edge);
+        }
+    }
+    test(edgeIndex.numberOfEdges() == graph.numberOfEdges());
+    testFindEdge(graph, edgeIndex);
+
+    // rebuild
+    graph.eraseVertex(3);
+    edgeIndex.build(graph);
+    test(edgeIndex.numberOfEdges() == graph.numberOfEdges());
+    testFindEdge(graph, edgeIndex);
+}
+
+void testMultipleEdges() {
+    andres::graph::Graph<> graph(3);
+    graph.multipleEdgesEnabled() = true;
+    graph.insertEdge(0, 1); // 0
+    graph.insertEdge(1, 2); // 1
+    graph.insertEdge(1, 0); // 2
+
+    andres::graph::EdgeIndex<andres::graph::Graph<> > edgeIndex(graph);
+    test(edgeIndex.numberOfEdges() == 2);
+    test(edgeIndex.findEdge(1, 0) == std::make_pair(true, std::size_t(0)));
+    testFindEdge(graph, edgeIndex);
+}
+
+void testDigraph() {
+    andres::graph::Digraph<> graph(5);
+    graph.insertEdge(0, 1);
+    graph.insertEdge(1, 0);
+    graph.insertEdge(2, 1);
+    graph.insertEdge(3, 4);
+    graph.insertEdge(2, 2);
+
+    andres::graph::EdgeIndex<andres::graph::Digraph<> > edgeIndex(graph);
+    test(edgeIndex.numberOfEdges() == 5);
+    test(!edgeIndex.findEdge(4, 3).first);
+    testFindEdge(graph, edgeIndex);
+}
+
+void testCompleteGraph() {
+    andres::graph::CompleteGraph<> graph(7);
+    andres::graph::EdgeIndex<andres::graph::CompleteGraph<> > edgeIndex(graph);
+    testFindEdge(graph, edgeIndex);
+}
+
+void testEmpty() {
+    andres::graph::EdgeIndex<andres::graph::Graph<> > edgeIndex;
+    test(edgeIndex.numberOfEdges() == 0);
+    test(!edgeIndex.findEdge(0, 1).first);
+
+    edgeIndex.insertEdge(0, 1, 0);
+    test(edgeIndex.findEdge(1, 0) == std::make_pair(true, std::size_t(0)));
+}
+
+void testFindChord() {
+    andres::graph::Graph<> graph(4);
+    graph.insertEdge(0, 1);
+    graph.insertEdge(1, 2);
+    graph.insertEdge(2, 3);
+    graph.insertEdge(3, 0);
+
+    andres::graph::EdgeIndex<andres::graph::Graph<> > edgeIndex(graph);
+    const std::size_t path[] = {0, 1, 2, 3};
+    test(andres::graph::findChord(edgeIndex, path, path + 4).first);
+    test(!andres::graph::findChord(edgeIndex, path, path + 4, true).first);
+}
+
+int main() {
+    testGraph();
+    testMultipleEdges();
+    testDigraph();
+    testCompleteGraph();
+    testEmpty();
+    testFindChord();
+
+    return 0;
+}
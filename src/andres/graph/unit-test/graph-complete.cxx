@@ -3,6 +3,7 @@
 #include <stdexcept>
 #include <iterator>
 #include <type_traits>
+#include <vector>
 
 #include "andres/graph/complete-graph.hxx"
 
@@ -509,6 +510,43 @@ void testAdjacencyIterator() {
     }
 }
 
+void testForEach() {
+    for(std::size_t n = 0; n < 8; ++n) {
+        CompleteGraph graph(n);
+
+        std::size_t numberOfEdges = 0;
+        graph.forEachEdge([&](const std::size_t e, const std::size_t v0, const std::size_t v1) {
+            test(e == numberOfEdges);
+            test(graph.vertexOfEdge(e, 0) == v0);
+            test(graph.vertexOfEdge(e, 1) == v1);
+            test(graph.findEdge(v0, v1) == Pair(true, e));
+            ++numberOfEdges;
+        });
+        test(numberOfEdges == graph.numberOfEdges());
+
+        for(std::size_t v = 0; v < n; ++v) {
+            std::vector<Adjacency> correct(graph.adjacenciesFromVertexBegin(v), graph.adjacenciesFromVertexEnd(v));
+            std::vector<Adjacency> testing;
+            graph.forEachAdjacency(v, [&](const Adjacency& a) { testing.push_back(a); });
+            test(correct == testing);
+        }
+    }
+}
+
+// vertexOfEdge is exact at the ends of rows, also for large graphs
+void testVertexOfEdgeLarge() {
+    const std::size_t n = 1000000000;
+    CompleteGraph graph(n);
+    for(std::size_t v0 = 0; v0 + 1 < n; v0 += (v0 < 100 || v0 + 100 > n) ? 1 : 99991) {
+        const std::size_t first = graph.findEdge(v0, v0 + 1).second;
+        const std::size_t last = graph.findEdge(v0, n - 1).second;
+        test(graph.vertexOfEdge(first, 0) == v0);
+        test(graph.vertexOfEdge(first, 1) == v0 + 1);
+        test(graph.vertexOfEdge(last, 0) == v0);
+        test(graph.vertexOfEdge(last, 1) == n - 1);
+    }
+}
+
 int main() {
     testConstructionAndNumbers(); // explicit test
     testFindEdge(); // explicit test
@@ -516,6 +554,8 @@ int main() {
     testVertexIterator();
     testEdgeIterator();
     testAdjacencyIterator();
+    testForEach();
+    testVertexOfEdgeLarge();
     testIteratorCompiling(); // Compile time tests
     
     return 0;
@@ -8,6 +8,7 @@
 
 #include "andres/graph/grid-graph.hxx"
 #include "andres/graph/graph.hxx"
+#include "andres/graph/for-each.hxx"
 
 inline void test(const bool& pred) {
     if(!pred)
@@ -476,6 +477,42 @@ void testAdjacencyND(std::vector<size_t> shape) {
     }
 }
 
+// tests consistency of forEachAdjacency and forEachEdge with the iterators
+template<typename G>
+void testForEachND(const typename G::VertexCoordinate& shape) {
+    typedef G GridGraph;
+    typedef typename GridGraph::AdjacencyType AdjacencyType;
+
+    GridGraph gg(shape);
+    for(std::size_t v = 0; v < gg.numberOfVertices(); ++v) {
+        std::vector<AdjacencyType> correct(gg.adjacenciesFromVertexBegin(v), gg.adjacenciesFromVertexEnd(v));
+        std::vector<AdjacencyType> testing;
+        gg.forEachAdjacency(v, [&](const AdjacencyType& a) { testing.push_back(a); });
+        test(correct == testing);
+
+        testing.clear();
+        andres::graph::forEachAdjacency(gg, v, [&](const AdjacencyType& a) { testing.push_back(a); });
+        test(correct == testing);
+    }
+
+    std::size_t numberOfEdges = 0;
+    gg.forEachEdge([&](const std::size_t e, const std::size_t v0, const std::size_t v1) {
+        test(e == numberOfEdges);
+        test(v0 == gg.vertexOfEdge(e, 0));
+        test(v1 == gg.vertexOfEdge(e, 1));
+        ++numberOfEdges;
+    });
+    test(numberOfEdges == gg.numberOfEdges());
+
+    numberOfEdges = 0;
+    andres::graph::forEachEdge(gg, [&](const std::size_t e, const std::size_t v0, const std::size_t v1) {
+        test(e == numberOfEdges);
+        test(v0 == gg.vertexOfEdge(e, 0));
+        ++numberOfEdges;
+    });
+    test(numberOfEdges == gg.numberOfEdges());
+}
+
 // 2D Support functions
 
 void createCorrectGrid(const size_t w, const size_t h, Graph& g) {
@@ -1012,6 +1049,24 @@ int main() {
             testGridEdgeIterator(g, pivot);
             testGridAdjacencyIterator(g, pivot);
         }
+        testForEachND<GridGraph>(VertexCoordinate({{6,5}}));
+        testForEachND<GridGraph>(VertexCoordinate({{1,5}}));
+        testForEachND<GridGraph>(VertexCoordinate({{6,1}}));
+        testForEachND<GridGraph>(VertexCoordinate({{2,2}}));
+    }
+
+    {
+        typedef andres::graph::GridGraph<1> GridGraph;
+        typedef typename GridGraph::VertexCoordinate VertexCoordinate;
+        testForEachND<GridGraph>(VertexCoordinate({{7}}));
+        testForEachND<GridGraph>(VertexCoordinate({{1}}));
+    }
+
+    {
+        typedef andres::graph::GridGraph<3> GridGraph;
+        typedef typename GridGraph::VertexCoordinate VertexCoordinate;
+        testForEachND<GridGraph>(VertexCoordinate({{4,5,3}}));
+        testForEachND<GridGraph>(VertexCoordinate({{4,1,3}}));
     }
 
     {
@@ -1028,6 +1083,7 @@ int main() {
             testFindEdgeND<GridGraph>(shape);
             testAdjacencyND<GridGraph>(shape);
             testOrientationsND<GridGraph>(shape);
+            testForEachND<GridGraph>(VertexCoordinate({{4,5,3,6}}));
         }
         {
             GridGraph g(VertexCoordinate({{3,2,3,2}}));
@@ -0,0 +1,145 @@
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+#include "andres/graph/graph.hxx"
+#include "andres/graph/grid-graph.hxx"
+#include "andres/graph/lifting.hxx"
+#include "andres/graph/lifted-grid-graph.hxx"
+#include "andres/graph/multicut-lifted/kernighan-lin.hxx"
+#include "andres/graph/multicut-lifted/greedy-additive.hxx"
+
+inline void test(const bool& pred) {
+    if(!pred)
+        throw std::runtime_error("Test failed.");
+}
+
+// the lifted grid graph has the same vertices, edges and adjacencies as the
+// graph built by lift()
+void testLift(
+    const std::size_t width,
+    const std::size_t height,
+    const std::size_t distanceUpperBound,
+    const std::size_t distanceLowerBound,
+    const andres::graph::LiftingMetric metric
+) {
+    typedef std::size_t size_type;
+
+    andres::graph::GridGraph<2> gridGraph({width, height});
+    andres::graph::Graph<> graph;
+    andres::graph::lift(gridGraph, graph, distanceUpperBound, distanceLowerBound, metric);
+    andres::graph::LiftedGridGraph liftedGridGraph(gridGraph, distanceUpperBound, distanceLowerBound, metric);
+
+    test(liftedGridGraph.numberOfVertices() == graph.numberOfVertices());
+    test(liftedGridGraph.numberOfEdges() == graph.numberOfEdges());
+    for(size_type e = 0; e < graph.numberOfEdges(); ++e) {
+        test(liftedGridGraph.vertexOfEdge(e, 0) == graph.vertexOfEdge(e, 0));
+        test(liftedGridGraph.vertexOfEdge(e, 1) == graph.vertexOfEdge(e, 1));
+    }
+
+    size_type edges = 0;
+    liftedGridGraph.forEachEdge([&](const size_type e, const size_type v0, const size_type v1) {
+        test(e == edges);
+        test(v0 == graph.vertexOfEdge(e, 0));
+        test(v1 == graph.vertexOfEdge(e, 1));
+        ++edges;
+    });
+    test(edges == graph.numberOfEdges());
+
+    for(size_type v = 0; v < graph.numberOfVertices(); ++v) {
+        test(liftedGridGraph.numberOfEdgesFromVertex(v) == graph.numberOfEdgesFromVertex(v));
+        auto it = liftedGridGraph.adjacenciesFromVertexBegin(v);
+        for(auto it2 = graph.adjacenciesFromVertexBegin(v); it2 != graph.adjacenciesFromVertexEnd(v); ++it2, ++it) {
+            test(it != liftedGridGraph.adjacenciesFromVertexEnd(v));
+            test(it->vertex() == it2->vertex());
+            test(it->edge() == it2->edge());
+        }
+        test(it == liftedGridGraph.adjacenciesFromVertexEnd(v));
+
+        auto vertexIt = liftedGridGraph.verticesFromVertexBegin(v);
+        auto edgeIt = liftedGridGraph.edgesFromVertexBegin(v);
+        for(size_type j = 0; j < graph.numberOfEdgesFromVertex(v); ++j, ++vertexIt, ++edgeIt) {
+            test(*vertexIt == graph.vertexFromVertex(v, j));
+            test(*edgeIt == graph.edgeFromVertex(v, j));
+        }
+        test(vertexIt == liftedGridGraph.verticesFromVertexEnd(v));
+
+        for(size_type w = 0; w < graph.numberOfVertices(); ++w) {
+            const std::pair<bool, size_type> p = liftedGridGraph.findEdge(v, w);
+            const std::pair<bool, size_type> q = graph.findEdge(v, w);
+            test(p.first == q.first);
+            if(p.first) {
+                test(p.second == q.second);
+            }
+        }
+    }
+}
+
+void testLift() {
+    typedef andres::graph::LiftingMetric LiftingMetric;
+
+    for(std::size_t distanceLowerBound = 0; distanceLowerBound < 5; ++distanceLowerBound)
+    for(std::size_t distanceUpperBound = 0; distanceUpperBound < 9; ++distanceUpperBound) {
+        testLift(7, 5, distanceUpperBound, distanceLowerBound, LiftingMetric::PathLength);
+        testLift(7, 5, distanceUpperBound, distanceLowerBound, LiftingMetric::L2);
+        testLift(3, 9, distanceUpperBound, distanceLowerBound, LiftingMetric::PathLength);
+        testLift(3, 9, distanceUpperBound, distanceLowerBound, LiftingMetric::L2);
+    }
+    testLift(1, 1, 2, 0, LiftingMetric::PathLength);
+    testLift(1, 6, 2, 0, LiftingMetric::L2);
+    testLift(6, 1, 2, 0, LiftingMetric::L2);
+}
+
+void testEmpty() {
+    andres::graph::LiftedGridGraph liftedGridGraph;
+    test(liftedGridGraph.numberOfVertices() == 0);
+    test(liftedGridGraph.numberOfEdges() == 0);
+}
+
+// lifted multicut solvers yield the same result for the lifted grid graph and
+// the graph built by lift()
+void testMulticutLifted() {
+    typedef std::size_t size_type;
+
+    andres::graph::GridGraph<2> gridGraph({12, 10});
+    andres::graph::Graph<> graph;
+    andres::graph::lift(gridGraph, graph, 3);
+    andres::graph::LiftedGridGraph liftedGridGraph(gridGraph, 3);
+
+    // attractive within the left and the right half of the grid, repulsive
+    // across
+    std::vector<double> edgeCosts(graph.numberOfEdges());
+    for(size_type e = 0; e < graph.numberOfEdges(); ++e) {
+        const size_type x0 = graph.vertexOfEdge(e, 0) % 12;
+        const size_type x1 = graph.vertexOfEdge(e, 1) % 12;
+        edgeCosts[e] = ((x0 < 6) == (x1 < 6) ? 1.0 : -2.0) + 0.01 * static_cast<double>(e % 7);
+    }
+
+    std::vector<char> edgeLabels(graph.numberOfEdges());
+    std::vector<char> liftedGridGraphEdgeLabels(graph.numberOfEdges());
+    andres::graph::multicut_lifted::greedyAdditiveEdgeContraction(gridGraph, graph, edgeCosts, edgeLabels);
+    andres::graph::multicut_lifted::greedyAdditiveEdgeContraction(gridGraph, liftedGridGraph, edgeCosts, liftedGridGraphEdgeLabels);
+    test(liftedGridGraphEdgeLabels == edgeLabels);
+
+    for(size_type e = 0; e < graph.numberOfEdges(); ++e) {
+        const size_type x0 = graph.vertexOfEdge(e, 0) % 12;
+        const size_type x1 = graph.vertexOfEdge(e, 1) % 12;
+        test(edgeLabels[e] == ((x0 < 6) == (x1 < 6) ? 0 : 1));
+    }
+
+    std::vector<char> kernighanLinEdgeLabels(graph.numberOfEdges());
+    std::vector<char> liftedGridGraphKernighanLinEdgeLabels(graph.numberOfEdges());
+    std::vector<char> initialEdgeLabels(graph.numberOfEdges(), 1);
+    andres::graph::multicut_lifted::kernighanLin(gridGraph, graph, edgeCosts, initialEdgeLabels, kernighanLinEdgeLabels);
+    andres::graph::multicut_lifted::kernighanLin(gridGraph, liftedGridGraph, edgeCosts, initialEdgeLabels, liftedGridGraphKernighanLinEdgeLabels);
+    test(liftedGridGraphKernighanLinEdgeLabels == kernighanLinEdgeLabels);
+    test(kernighanLinEdgeLabels == edgeLabels);
+}
+
+int main() {
+    testLift();
+    testEmpty();
+    testMulticutLifted();
+
+    return 0;
+}
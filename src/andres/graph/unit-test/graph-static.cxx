@@ -0,0 +1,189 @@
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+#include <utility>
+
+#include "andres/graph/graph.hxx"
+#include "andres/graph/static-graph.hxx"
+#include "andres/graph/components.hxx"
+#include "andres/graph/shortest-paths.hxx"
+#include "andres/graph/multicut/kernighan-lin.hxx"
+
+inline void test(const bool& pred) {
+    if(!pred) throw std::runtime_error("Test failed.");
+}
+
+typedef andres::graph::StaticGraph<> StaticGraph;
+typedef std::pair<std::size_t, std::size_t> Pair;
+typedef std::pair<bool, std::size_t> FindResult;
+
+template<class GRAPH_A, class GRAPH_B>
+void testEqual(const GRAPH_A& a, const GRAPH_B& b) {
+    test(a.numberOfVertices() == b.numberOfVertices());
+    test(a.numberOfEdges() == b.numberOfEdges());
+    for(std::size_t e = 0; e < a.numberOfEdges(); ++e) {
+        test(a.vertexOfEdge(e, 0) == b.vertexOfEdge(e, 0));
+        test(a.vertexOfEdge(e, 1) == b.vertexOfEdge(e, 1));
+    }
+    for(std::size_t v = 0; v < a.numberOfVertices(); ++v) {
+        test(a.numberOfEdgesFromVertex(v) == b.numberOfEdgesFromVertex(v));
+        test(a.numberOfEdgesToVertex(v) == b.numberOfEdgesToVertex(v));
+        for(std::size_t j = 0; j < a.numberOfEdgesFromVertex(v); ++j) {
+            test(a.vertexFromVertex(v, j) == b.vertexFromVertex(v, j));
+            test(a.edgeFromVertex(v, j) == b.edgeFromVertex(v, j));
+            test(a.adjacencyFromVertex(v, j) == b.adjacencyFromVertex(v, j));
+            test(*(a.verticesFromVertexBegin(v) + j) == *(b.verticesFromVertexBegin(v) + j));
+            test(*(a.edgesToVertexBegin(v) + j) == *(b.edgesToVertexBegin(v) + j));
+        }
+    }
+}
+
+void testConstruction() {
+    {
+        StaticGraph g;
+        test(g.numberOfVertices() == 0);
+        test(g.numberOfEdges() == 0);
+        test(!g.multipleEdgesEnabled());
+    }
+    {
+        std::vector<Pair> edges;
+        StaticGraph g(10, edges.begin(), edges.end());
+        test(g.numberOfVertices() == 10);
+        test(g.numberOfEdges() == 0);
+        for(std::size_t v = 0; v < g.numberOfVertices(); ++v) {
+            test(g.numberOfEdgesFromVertex(v) == 0);
+            test(g.adjacenciesFromVertexBegin(v) == g.adjacenciesFromVertexEnd(v));
+        }
+    }
+}
+
+void testEdgeList() {
+    std::vector<Pair> edges;
+    edges.push_back(Pair(3, 1)); // 0
+    edges.push_back(Pair(0, 2)); // 1
+    edges.push_back(Pair(1, 0)); // 2
+    edges.push_back(Pair(2, 3)); // 3
+    edges.push_back(Pair(4, 4)); // 4 (self-loop)
+    edges.push_back(Pair(0, 3)); // 5
+
+    StaticGraph g(5, edges.begin(), edges.end());
+
+    andres::graph::Graph<> reference(5);
+    for(std::size_t e = 0; e < edges.size(); ++e) {
+        reference.insertEdge(edges[e].first, edges[e].second);
+    }
+    testEqual(g, reference);
+    test(!g.multipleEdgesEnabled());
+
+    test(g.vertexOfEdge(0, 0) == 1);
+    test(g.vertexOfEdge(0, 1) == 3);
+    test(g.numberOfEdgesFromVertex(4) == 1);
+    test(g.vertexFromVertex(4, 0) == 4);
+
+    test(g.findEdge(0, 1) == FindResult(true, 2));
+    test(g.findEdge(1, 0) == FindResult(true, 2));
+    test(g.findEdge(3, 2) == FindResult(true, 3));
+    test(g.findEdge(4, 4) == FindResult(true, 4));
+    test(!g.findEdge(1, 2).first);
+    test(!g.findEdge(0, 4).first);
+}
+
+void testCopy() {
+    andres::graph::Graph<> graph(6);
+    graph.insertEdge(0, 1);
+    graph.insertEdge(0, 3);
+    graph.insertEdge(1, 2);
+    graph.insertEdge(1, 4);
+    graph.insertEdge(2, 5);
+    graph.insertEdge(3, 4);
+    graph.insertEdge(4, 5);
+    graph.eraseEdge(1); // edge indices are not sorted wrt vertices anymore
+
+    StaticGraph g(graph);
+    testEqual(g, graph);
+
+    g.assign();
+    test(g.numberOfVertices() == 0);
+    test(g.numberOfEdges() == 0);
+
+    g.assign(graph);
+    testEqual(g, graph);
+}
+
+void testMultipleEdges() {
+    std::vector<Pair> edges;
+    edges.push_back(Pair(0, 1));
+    edges.push_back(Pair(1, 2));
+    edges.push_back(Pair(1, 0));
+
+    StaticGraph g(3, edges.begin(), edges.end());
+    test(g.multipleEdgesEnabled());
+    test(g.numberOfEdges() == 3);
+    test(g.numberOfEdgesFromVertex(0) == 2);
+    test(g.numberOfEdgesFromVertex(1) == 3);
+    test(g.adjacencyFromVertex(0, 0) == andres::graph::Adjacency<>(1, 0));
+    test(g.adjacencyFromVertex(0, 1) == andres::graph::Adjacency<>(1, 2));
+    test(g.findEdge(0, 1).first);
+}
+
+void testAlgorithms() {
+    andres::graph::Graph<> graph(6);
+    graph.insertEdge(0, 1); // 0
+    graph.insertEdge(0, 3); // 1
+    graph.insertEdge(1, 2); // 2
+    graph.insertEdge(1, 4); // 3
+    graph.insertEdge(2, 5); // 4
+    graph.insertEdge(3, 4); // 5
+    graph.insertEdge(4, 5); // 6
+    StaticGraph g(graph);
+
+    {
+        std::vector<std::size_t> labels(g.numberOfVertices());
+        andres::graph::DefaultSubgraphMask<> mask;
+        test(andres::graph::labelComponents(g, mask, labels.begin()) == 1);
+
+        andres::graph::ComponentsBySearch<StaticGraph> components;
+        test(components.build(g) == 1);
+        test(components.areConnected(0, 5));
+    }
+    {
+        std::vector<double> weights(g.numberOfEdges(), 1.0);
+        weights[3] = 5.0;
+        std::vector<double> distances(g.numberOfVertices());
+        std::vector<std::size_t> parents(g.numberOfVertices());
+        andres::graph::sssp(g, 0, weights.begin(), distances.begin(), parents.begin());
+        test(distances[4] == 2.0);
+        test(distances[5] == 3.0);
+    }
+    {
+        std::vector<double> weights(7);
+        weights[0] = 5;
+        weights[1] = -20;
+        weights[2] = 5;
+        weights[3] = 5;
+        weights[4] = -20;
+        weights[5] = 5;
+        weights[6] = 5;
+
+        std::vector<char> edge_labels(g.numberOfEdges());
+        andres::graph::multicut::kernighanLin(g, weights, edge_labels, edge_labels);
+
+        test(edge_labels[0] == 0);
+        test(edge_labels[1] == 1);
+        test(edge_labels[2] == 0);
+        test(edge_labels[3] == 1);
+        test(edge_labels[4] == 1);
+        test(edge_labels[5] == 0);
+        test(edge_labels[6] == 0);
+    }
+}
+
+int main() {
+    testConstruction();
+    testEdgeList();
+    testCopy();
+    testMultipleEdges();
+    testAlgorithms();
+
+    return 0;
+}
@@ -0,0 +1,114 @@
+#include <cstddef>
+#include <stdexcept>
+#include <random>
+#include <vector>
+
+#include "andres/graph/indexed-heap.hxx"
+
+inline void test(const bool& pred) {
+    if(!pred) throw std::runtime_error("Test failed.");
+}
+
+using namespace andres::graph;
+
+void testSmallHeap() {
+    IndexedHeap<double> heap(5);
+    test(heap.empty());
+    test(heap.numberOfItems() == 5);
+
+    heap.push(3, 2.0);
+    heap.push(1, 5.0);
+    heap.push(4, 1.0);
+    test(heap.size() == 3);
+    test(heap.contains(1));
+    test(!heap.contains(0));
+    test(heap.top() == 4);
+    test(heap.topKey() == 1.0);
+
+    heap.decreaseKey(1, 0.5);
+    test(heap.top() == 1);
+    test(heap.key(1) == 0.5);
+    test(!heap.pushOrDecreaseKey(3, 3.0));
+    test(heap.key(3) == 2.0);
+    test(heap.pushOrDecreaseKey(0, 1.5));
+
+    heap.pop();
+    test(!heap.contains(1));
+    test(heap.top() == 4);
+    heap.pop();
+    test(heap.top() == 0);
+    heap.pop();
+    test(heap.top() == 3);
+
+    // items can be pushed again after being popped or cleared
+    heap.push(1, 7.0);
+    heap.clear();
+    test(heap.empty());
+    test(!heap.contains(1));
+    test(!heap.contains(3));
+    heap.resize(7);
+    heap.push(6, 1.0);
+    test(heap.top() == 6);
+}
+
+// push, decrease and pop at random and compare with a linear search for the
+// smallest key
+template<std::size_t ARITY>
+void testRandomOperations() {
+    const std::size_t numberOfItems = 100;
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<std::size_t> items(0, numberOfItems - 1);
+    std::uniform_int_distribution<int> keys(0, 1000);
+
+    IndexedHeap<int, ARITY> heap(numberOfItems);
+    std::vector<int> expectedKeys(numberOfItems);
+    std::vector<char> contained(numberOfItems);
+    for(std::size_t step = 0; step < 20000; ++step) {
+        const std::size_t item = items(generator);
+        const int key = keys(generator);
+        if(generator() % 3 != 0) {
+            if(!contained[item]) {
+                heap.push(item, key);
+                expectedKeys[item] = key;
+                contained[item] = 1;
+            }
+            else {
+                test(heap.pushOrDecreaseKey(item, key) == (key < expectedKeys[item]));
+                if(key < expectedKeys[item]) {
+                    expectedKeys[item] = key;
+                }
+            }
+        }
+        else if(!heap.empty()) {
+            int smallestKey = 1001;
+            for(std::size_t j = 0; j < numberOfItems; ++j) {
+                if(contained[j] && expectedKeys[j] < smallestKey) {
+                    smallestKey = expectedKeys[j];
+                }
+            }
+            test(heap.topKey() == smallestKey);
+            test(contained[heap.top()] && expectedKeys[heap.top()] == smallestKey);
+            contained[heap.top()] = 0;
+            heap.pop();
+        }
+
+        std::size_t size = 0;
+        for(std::size_t j = 0; j < numberOfItems; ++j) {
+            test(heap.contains(j) == (contained[j] != 0));
+            if(contained[j]) {
+                test(heap.key(j) == expectedKeys[j]);
+                ++size;
+            }
+        }
+        test(heap.size() == size);
+    }
+}
+
+int main() {
+    testSmallHeap();
+    testRandomOperations<2>();
+    testRandomOperations<4>();
+    testRandomOperations<7>();
+
+    return 0;
+}
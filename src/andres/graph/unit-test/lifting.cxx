@@ -1,6 +1,8 @@
 #include <cstddef>
 
 #include "andres/graph/graph.hxx"
+#include "andres/graph/digraph.hxx"
+#include "andres/graph/static-graph.hxx"
 #include "andres/graph/lifting.hxx"
 
 
@@ -146,10 +148,85 @@ void testLiftGridGraphL2Metric() {
         }
 }
 
+template<class GRAPH>
+void testEdgeOrder(const GRAPH& graph) {
+    for(std::size_t e = 1; e < graph.numberOfEdges(); ++e) {
+        const std::size_t a0 = graph.vertexOfEdge(e - 1, 0);
+        const std::size_t a1 = graph.vertexOfEdge(e - 1, 1);
+        const std::size_t b0 = graph.vertexOfEdge(e, 0);
+        const std::size_t b1 = graph.vertexOfEdge(e, 1);
+        test(a0 < b0 || (a0 == b0 && a1 < b1));
+    }
+}
+
+void testLiftOutputGraphs() {
+    typedef std::size_t size_type;
+
+    // more vertices than fit into one batch of sources
+    andres::graph::GridGraph<2> gridGraph = {23, 11};
+    andres::graph::Graph<> graph(gridGraph.numberOfVertices());
+    for(size_type e = 0; e < gridGraph.numberOfEdges(); ++e)
+        graph.insertEdge(gridGraph.vertexOfEdge(e, 0), gridGraph.vertexOfEdge(e, 1));
+
+    andres::graph::Graph<> graphLifted;
+    andres::graph::lift(graph, graphLifted, 4, 1);
+    test(!graphLifted.multipleEdgesEnabled());
+    testEdgeOrder(graphLifted);
+
+    andres::graph::Graph<> gridGraphLifted;
+    andres::graph::lift(gridGraph, gridGraphLifted, 4, 1);
+    test(gridGraphLifted.numberOfEdges() == graphLifted.numberOfEdges());
+    for(size_type e = 0; e < graphLifted.numberOfEdges(); ++e) {
+        test(gridGraphLifted.vertexOfEdge(e, 0) == graphLifted.vertexOfEdge(e, 0));
+        test(gridGraphLifted.vertexOfEdge(e, 1) == graphLifted.vertexOfEdge(e, 1));
+    }
+
+    andres::graph::StaticGraph<> staticGraphLifted;
+    andres::graph::lift(graph, staticGraphLifted, 4, 1);
+    test(staticGraphLifted.numberOfVertices() == graph.numberOfVertices());
+    test(staticGraphLifted.numberOfEdges() == graphLifted.numberOfEdges());
+    for(size_type e = 0; e < graphLifted.numberOfEdges(); ++e) {
+        test(staticGraphLifted.vertexOfEdge(e, 0) == graphLifted.vertexOfEdge(e, 0));
+        test(staticGraphLifted.vertexOfEdge(e, 1) == graphLifted.vertexOfEdge(e, 1));
+    }
+
+    andres::graph::StaticGraph<> staticGridGraphLifted;
+    andres::graph::lift(gridGraph, staticGridGraphLifted, 4, 1);
+    test(staticGridGraphLifted.numberOfEdges() == graphLifted.numberOfEdges());
+
+    // directed output graphs contain both orientations of each lifted edge
+    andres::graph::Digraph<> digraphLifted;
+    andres::graph::lift(graph, digraphLifted, 4, 1);
+    test(digraphLifted.numberOfEdges() == 2 * graphLifted.numberOfEdges());
+    testEdgeOrder(digraphLifted);
+
+    andres::graph::Digraph<> gridDigraphLifted;
+    andres::graph::lift(gridGraph, gridDigraphLifted, 4, 1);
+    test(gridDigraphLifted.numberOfEdges() == 2 * graphLifted.numberOfEdges());
+    for(size_type e = 0; e < graphLifted.numberOfEdges(); ++e) {
+        const size_type v0 = graphLifted.vertexOfEdge(e, 0);
+        const size_type v1 = graphLifted.vertexOfEdge(e, 1);
+        test(gridDigraphLifted.findEdge(v0, v1).first);
+        test(gridDigraphLifted.findEdge(v1, v0).first);
+    }
+
+    // lifting a directed graph into an undirected graph removes duplicates
+    andres::graph::Digraph<> digraph(4);
+    digraph.insertEdge(0, 1);
+    digraph.insertEdge(1, 2);
+    digraph.insertEdge(3, 2);
+    andres::graph::Graph<> digraphLiftedUndirected;
+    andres::graph::lift(digraph, digraphLiftedUndirected, 2);
+    test(digraphLiftedUndirected.numberOfEdges() == 4);
+    test(digraphLiftedUndirected.findEdge(0, 2).first);
+    test(!digraphLiftedUndirected.findEdge(0, 3).first);
+}
+
 int main() {
     testLiftGraph();
     testLiftGridGraphPathLengthMetric();
     testLiftGridGraphL2Metric();
+    testLiftOutputGraphs();
 
     return 0;
 }
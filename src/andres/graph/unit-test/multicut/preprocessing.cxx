@@ -68,9 +68,67 @@ void testPreprocessing() {
 
 }
 
+void testSplitIntoBlocks() {
+    // triangle 0-1-2, bridge 2-3, square 3-4-5-6 with chord 3-5
+    andres::graph::Graph<> graph(7);
+    graph.insertEdge(0, 1); // 0
+    graph.insertEdge(1, 2); // 1
+    graph.insertEdge(0, 2); // 2
+    graph.insertEdge(2, 3); // 3
+    graph.insertEdge(3, 4); // 4
+    graph.insertEdge(4, 5); // 5
+    graph.insertEdge(5, 6); // 6
+    graph.insertEdge(6, 3); // 7
+    graph.insertEdge(3, 5); // 8
+
+    std::vector<double> edge_costs(graph.numberOfEdges());
+    for (size_t e = 0; e < edge_costs.size(); e++)
+        edge_costs[e] = static_cast<double>(e) - 4.0;
+    std::vector<size_t> vorig = {10, 11, 12, 13, 14, 15, 16};
+
+    std::vector<andres::graph::Graph<>> block_graphs;
+    std::vector<std::vector<double>> block_edge_costs;
+    std::vector<std::vector<size_t>> block_vorig;
+    andres::graph::BiconnectedComponents<andres::graph::Graph<>> components;
+    auto const number_of_blocks = andres::graph::multicut::splitIntoBlocks(graph, edge_costs, vorig,
+        block_graphs, block_edge_costs, block_vorig, components);
+    test(number_of_blocks == 3);
+
+    // each edge appears in exactly one block, with its cost and its vertices
+    size_t number_of_edges = 0;
+    for (size_t b = 0; b < number_of_blocks; b++)
+    {
+        test(block_graphs[b].numberOfVertices() == block_vorig[b].size());
+        test(block_graphs[b].numberOfEdges() == block_edge_costs[b].size());
+        for (size_t e = 0; e < block_graphs[b].numberOfEdges(); e++)
+        {
+            auto const v0 = block_vorig[b][block_graphs[b].vertexOfEdge(e, 0)] - 10;
+            auto const v1 = block_vorig[b][block_graphs[b].vertexOfEdge(e, 1)] - 10;
+            auto const edge = graph.findEdge(v0, v1);
+            test(edge.first);
+            test(edge_costs[edge.second] == block_edge_costs[b][e]);
+            number_of_edges++;
+        }
+    }
+    test(number_of_edges == graph.numberOfEdges());
+    test(block_graphs[components.blockOfEdge_[0]].numberOfVertices() == 3);
+    test(block_graphs[components.blockOfEdge_[3]].numberOfVertices() == 2);
+    test(block_graphs[components.blockOfEdge_[4]].numberOfVertices() == 4);
+
+    // the bridge is removed and fixed according to its cost
+    std::vector<std::pair<std::pair<size_t, size_t>, char>> constr;
+    auto const cost_offset = andres::graph::multicut::removeBridges(graph, edge_costs, constr, vorig, &components);
+    test(cost_offset == -1.0);
+    test(constr.size() == 1);
+    test(constr[0].first == std::make_pair(size_t(12), size_t(13)));
+    test(constr[0].second == 1);
+    test(graph.numberOfEdges() == 7); // the bridge and the edge of cost 0 are removed
+}
+
 int main()
 {
     testPreprocessing();
+    testSplitIntoBlocks();
 
     return 0;
 }
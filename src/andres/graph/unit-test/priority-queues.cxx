@@ -0,0 +1,187 @@
+#include <cstddef>
+#include <stdexcept>
+#include <random>
+#include <deque>
+#include <vector>
+#include <type_traits> // std::is_same
+
+#include "andres/graph/graph.hxx"
+#include "andres/graph/priority-queues.hxx"
+#include "andres/graph/search-workspace.hxx"
+#include "andres/graph/shortest-paths.hxx"
+
+inline void test(const bool& pred) {
+    if(!pred) throw std::runtime_error("Test failed.");
+}
+
+using namespace andres::graph;
+
+template<class QUEUE>
+void testSmallQueue() {
+    QUEUE queue(5);
+    test(queue.empty());
+    test(queue.numberOfItems() == 5);
+
+    queue.push(4, 11);
+    queue.push(3, 12);
+    queue.push(1, 15);
+    test(queue.size() == 3);
+    test(queue.contains(1));
+    test(!queue.contains(0));
+    test(queue.top() == 4);
+    test(queue.topKey() == 11);
+
+    queue.decreaseKey(1, 11);
+    test(queue.key(1) == 11);
+    test(!queue.pushOrDecreaseKey(3, 13));
+    test(queue.key(3) == 12);
+    test(queue.pushOrDecreaseKey(0, 100));
+
+    queue.pop();
+    test(queue.topKey() == 11);
+    queue.pop();
+    test(!queue.contains(1));
+    test(!queue.contains(4));
+    test(queue.top() == 3);
+    queue.pop();
+    test(queue.top() == 0);
+    test(queue.topKey() == 100);
+
+    // after clear, keys may be smaller than before
+    queue.clear();
+    test(queue.empty());
+    test(!queue.contains(0));
+    queue.resize(7);
+    queue.push(5, 1);
+    queue.push(6, 2);
+    test(queue.top() == 5);
+}
+
+template<class QUEUE>
+void testSignedKeys() {
+    QUEUE queue(4);
+    queue.push(0, -5);
+    queue.push(1, 3);
+    queue.push(2, -2);
+    test(queue.top() == 0);
+    queue.pop();
+    queue.push(3, -4);
+    test(queue.top() == 3);
+    queue.pop();
+    test(queue.top() == 2);
+    queue.pop();
+    test(queue.top() == 1);
+    test(queue.topKey() == 3);
+}
+
+// push, decrease and pop at random, with keys not smaller than the key
+// popped last, and compare with IndexedHeap
+template<class QUEUE>
+void testRandomMonotoneOperations(const int maximumIncrement) {
+    const std::size_t numberOfItems = 100;
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<std::size_t> items(0, numberOfItems - 1);
+    std::uniform_int_distribution<int> increments(0, maximumIncrement);
+
+    QUEUE queue(numberOfItems);
+    IndexedHeap<int> heap(numberOfItems);
+    int last = 0;
+    queue.push(0, last);
+    heap.push(0, last);
+    for(std::size_t step = 0; step < 20000; ++step) {
+        const std::size_t item = items(generator);
+        const int key = last + increments(generator);
+        if(generator() % 3 != 0) {
+            test(queue.contains(item) == heap.contains(item));
+            test(queue.pushOrDecreaseKey(item, key) == heap.pushOrDecreaseKey(item, key));
+            test(queue.key(item) == heap.key(item));
+        }
+        else if(!heap.empty()) {
+            test(queue.topKey() == heap.topKey());
+            const std::size_t top = queue.top();
+            test(queue.key(top) == heap.topKey());
+            last = heap.topKey();
+            queue.pop();
+            heap.decreaseKey(top, -1);
+            heap.pop();
+            test(!queue.contains(top));
+        }
+        test(queue.size() == heap.size());
+    }
+    while(!heap.empty()) {
+        test(queue.topKey() == heap.topKey());
+        const std::size_t top = queue.top();
+        queue.pop();
+        heap.decreaseKey(top, -1);
+        heap.pop();
+    }
+    test(queue.empty());
+}
+
+// Dijkstra's algorithm with integral edge weights yields the same distances
+// for all queues
+void testShortestPaths() {
+    const std::size_t numberOfVertices = 200;
+    std::mt19937 generator(7);
+    std::uniform_int_distribution<std::size_t> vertices(0, numberOfVertices - 1);
+    std::uniform_int_distribution<unsigned int> weights(0, 50);
+
+    Graph<> graph(numberOfVertices);
+    std::vector<unsigned int> edgeWeights;
+    for(std::size_t j = 0; j < 800; ++j) {
+        graph.insertEdge(vertices(generator), vertices(generator));
+        edgeWeights.push_back(weights(generator));
+    }
+
+    SearchWorkspace<unsigned int, IndexedHeapTag> heapWorkspace(graph);
+    SearchWorkspace<unsigned int, BucketQueueTag> bucketWorkspace(graph);
+    SearchWorkspace<unsigned int, RadixHeapTag> radixWorkspace(graph);
+    test(std::is_same<SearchWorkspace<unsigned int>::Queue, IndexedHeap<unsigned int> >::value); // monotone queues are opt-in
+    for(std::size_t vs = 0; vs < numberOfVertices; vs += 17) {
+        sssp(graph, vs, edgeWeights.begin(), heapWorkspace);
+        sssp(graph, vs, edgeWeights.begin(), bucketWorkspace);
+        sssp(graph, vs, edgeWeights.begin(), radixWorkspace);
+        for(std::size_t v = 0; v < numberOfVertices; ++v) {
+            test(heapWorkspace.isVisited(v) == bucketWorkspace.isVisited(v));
+            test(heapWorkspace.isVisited(v) == radixWorkspace.isVisited(v));
+            if(heapWorkspace.isVisited(v)) {
+                test(heapWorkspace.distance(v) == bucketWorkspace.distance(v));
+                test(heapWorkspace.distance(v) == radixWorkspace.distance(v));
+            }
+        }
+
+        const std::size_t vt = vertices(generator);
+        std::deque<std::size_t> heapPath;
+        std::deque<std::size_t> bucketPath;
+        std::deque<std::size_t> radixPath;
+        unsigned int heapDistance = 0;
+        unsigned int bucketDistance = 0;
+        unsigned int radixDistance = 0;
+        spsp(graph, vs, vt, edgeWeights.begin(), heapPath, heapDistance, heapWorkspace);
+        spsp(graph, vs, vt, edgeWeights.begin(), bucketPath, bucketDistance, bucketWorkspace);
+        spsp(graph, vs, vt, edgeWeights.begin(), radixPath, radixDistance, radixWorkspace);
+        test(heapPath.empty() == bucketPath.empty());
+        test(heapPath.empty() == radixPath.empty());
+        if(!heapPath.empty()) {
+            test(heapDistance == bucketDistance);
+            test(heapDistance == radixDistance);
+            test(bucketPath.front() == vs && bucketPath.back() == vt);
+            test(radixPath.front() == vs && radixPath.back() == vt);
+        }
+    }
+}
+
+int main() {
+    testSmallQueue<BucketQueue<int> >();
+    testSmallQueue<RadixHeap<int> >();
+    testSmallQueue<RadixHeap<unsigned long long> >();
+    testSignedKeys<BucketQueue<int> >();
+    testSignedKeys<RadixHeap<int> >();
+    testSignedKeys<RadixHeap<signed char> >();
+    testRandomMonotoneOperations<BucketQueue<int> >(10);
+    testRandomMonotoneOperations<BucketQueue<int> >(1000); // grows
+    testRandomMonotoneOperations<RadixHeap<int> >(10);
+    testRandomMonotoneOperations<RadixHeap<int> >(1000000);
+    testShortestPaths();
+    return 0;
+}
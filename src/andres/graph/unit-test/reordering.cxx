@@ -0,0 +1,264 @@
+#include <cstddef>
+#include <stdexcept>
+#include <algorithm>
+#include <array>
+#include <vector>
+
+#include "andres/graph/graph.hxx"
+#include "andres/graph/digraph.hxx"
+#include "andres/graph/grid-graph.hxx"
+#include "andres/graph/static-graph.hxx"
+#include "andres/graph/edge-index.hxx"
+#include "andres/graph/reordering.hxx"
+
+inline void test(const bool& pred) {
+    if(!pred) throw std::runtime_error("Test failed.");
+}
+
+template<class GRAPH>
+void testPermutation(const GRAPH& graph, const std::vector<std::size_t>& order) {
+    test(order.size() == graph.numberOfVertices());
+    std::vector<char> seen(graph.numberOfVertices(), 0);
+    for(std::size_t j = 0; j < order.size(); ++j) {
+        test(order[j] < graph.numberOfVertices());
+        test(!seen[order[j]]);
+        seen[order[j]] = 1;
+    }
+}
+
+template<class GRAPH, class REORDERED_GRAPH>
+void testReordering(
+    const GRAPH& graph,
+    const REORDERED_GRAPH& reorderedGraph,
+    const andres::graph::Reordering& reordering
+) {
+    test(reorderedGraph.numberOfVertices() == graph.numberOfVertices());
+    test(reorderedGraph.numberOfEdges() == graph.numberOfEdges());
+    test(reordering.numberOfVertices() == graph.numberOfVertices());
+    test(reordering.numberOfEdges() == graph.numberOfEdges());
+    for(std::size_t v = 0; v < graph.numberOfVertices(); ++v) {
+        test(reordering.oldVertex(reordering.newVertex(v)) == v);
+        test(reordering.newVertex(reordering.oldVertex(v)) == v);
+        test(reorderedGraph.numberOfEdgesFromVertex(reordering.newVertex(v)) == graph.numberOfEdgesFromVertex(v));
+    }
+    for(std::size_t e = 0; e < graph.numberOfEdges(); ++e) {
+        test(reordering.oldEdge(reordering.newEdge(e)) == e);
+        const std::size_t f = reordering.newEdge(e);
+        const std::size_t v0 = reordering.newVertex(graph.vertexOfEdge(e, 0));
+        const std::size_t v1 = reordering.newVertex(graph.vertexOfEdge(e, 1));
+        if(graph.vertexOfEdge(e, 0) != graph.vertexOfEdge(e, 1) && reorderedGraph.vertexOfEdge(f, 0) == v1) {
+            test(!andres::graph::detail::IsDirected<REORDERED_GRAPH>::value);
+            test(reorderedGraph.vertexOfEdge(f, 1) == v0);
+        }
+        else {
+            test(reorderedGraph.vertexOfEdge(f, 0) == v0);
+            test(reorderedGraph.vertexOfEdge(f, 1) == v1);
+        }
+    }
+
+    // edges are sorted by their smaller and larger vertex
+    for(std::size_t f = 1; f < reorderedGraph.numberOfEdges(); ++f) {
+        const std::size_t a0 = std::min(reorderedGraph.vertexOfEdge(f - 1, 0), reorderedGraph.vertexOfEdge(f - 1, 1));
+        const std::size_t a1 = std::max(reorderedGraph.vertexOfEdge(f - 1, 0), reorderedGraph.vertexOfEdge(f - 1, 1));
+        const std::size_t b0 = std::min(reorderedGraph.vertexOfEdge(f, 0), reorderedGraph.vertexOfEdge(f, 1));
+        const std::size_t b1 = std::max(reorderedGraph.vertexOfEdge(f, 0), reorderedGraph.vertexOfEdge(f, 1));
+        test(a0 < b0 || (a0 == b0 && a1 <= b1));
+    }
+
+    // values round-trip
+    std::vector<double> edgeValues(graph.numberOfEdges());
+    for(std::size_t e = 0; e < edgeValues.size(); ++e) {
+        edgeValues[e] = static_cast<double>(e) * 0.5;
+    }
+    std::vector<double> reorderedEdgeValues(graph.numberOfEdges());
+    reordering.permuteEdgeValues(edgeValues.begin(), reorderedEdgeValues.begin());
+    for(std::size_t e = 0; e < edgeValues.size(); ++e) {
+        test(reorderedEdgeValues[reordering.newEdge(e)] == edgeValues[e]);
+    }
+    std::vector<double> restoredEdgeValues(graph.numberOfEdges());
+    reordering.restoreEdgeValues(reorderedEdgeValues.begin(), restoredEdgeValues.begin());
+    test(restoredEdgeValues == edgeValues);
+
+    std::vector<std::size_t> labels(graph.numberOfVertices());
+    for(std::size_t v = 0; v < labels.size(); ++v) {
+        labels[v] = v % 3;
+    }
+    std::vector<std::size_t> reorderedLabels(graph.numberOfVertices());
+    reordering.permuteVertexValues(labels.begin(), reorderedLabels.begin());
+    for(std::size_t v = 0; v < labels.size(); ++v) {
+        test(reorderedLabels[reordering.newVertex(v)] == labels[v]);
+    }
+    std::vector<std::size_t> restoredLabels(graph.numberOfVertices());
+    reordering.restoreVertexValues(reorderedLabels.begin(), restoredLabels.begin());
+    test(restoredLabels == labels);
+}
+
+template<class GRAPH>
+std::size_t bandwidth(const GRAPH& graph) {
+    std::size_t b = 0;
+    for(std::size_t e = 0; e < graph.numberOfEdges(); ++e) {
+        const std::size_t v0 = graph.vertexOfEdge(e, 0);
+        const std::size_t v1 = graph.vertexOfEdge(e, 1);
+        b = std::max(b, v0 < v1 ? v1 - v0 : v0 - v1);
+    }
+    return b;
+}
+
+// 2D grid with vertices numbered in a scattered order
+void makeScatteredGrid(andres::graph::Graph<>& graph, const std::size_t width, const std::size_t height) {
+    const std::size_t n = width * height;
+    const std::size_t step = 37; // coprime to n
+    auto label = [&](const std::size_t x, const std::size_t y) {
+        return ((y * width + x) * step) % n;
+    };
+    graph.assign(n);
+    for(std::size_t y = 0; y < height; ++y)
+    for(std::size_t x = 0; x < width; ++x) {
+        if(x + 1 < width) {
+            graph.insertEdge(label(x, y), label(x + 1, y));
+        }
+        if(y + 1 < height) {
+            graph.insertEdge(label(x, y), label(x, y + 1));
+        }
+    }
+}
+
+void testGraph() {
+    andres::graph::Graph<> graph;
+    makeScatteredGrid(graph, 20, 10);
+    graph.insertEdge(3, 3);
+
+    std::vector<std::size_t> order;
+    andres::graph::reverseCuthillMcKeeOrder(graph, order);
+    testPermutation(graph, order);
+
+    andres::graph::Graph<> reorderedGraph;
+    andres::graph::Reordering reordering;
+    andres::graph::reorder(graph, order, reorderedGraph, reordering);
+    testReordering(graph, reorderedGraph, reordering);
+    test(bandwidth(reorderedGraph) < bandwidth(graph));
+    test(bandwidth(reorderedGraph) <= 2 * 10);
+
+    andres::graph::breadthFirstOrder(graph, order);
+    testPermutation(graph, order);
+    test(order[0] == 0);
+    andres::graph::reorder(graph, order, reorderedGraph, reordering);
+    testReordering(graph, reorderedGraph, reordering);
+
+    andres::graph::degreeOrder(graph, order);
+    testPermutation(graph, order);
+    for(std::size_t j = 1; j < order.size(); ++j) {
+        test(graph.numberOfEdgesFromVertex(order[j - 1]) >= graph.numberOfEdgesFromVertex(order[j]));
+    }
+
+    andres::graph::StaticGraph<> staticGraph;
+    andres::graph::reorder(graph, order, staticGraph, reordering);
+    testReordering(graph, staticGraph, reordering);
+}
+
+void testComponents() {
+    andres::graph::Graph<> graph(7);
+    graph.insertEdge(5, 1);
+    graph.insertEdge(1, 3);
+    graph.insertEdge(6, 4);
+
+    std::vector<std::size_t> order;
+    andres::graph::reverseCuthillMcKeeOrder(graph, order);
+    testPermutation(graph, order);
+
+    andres::graph::Graph<> reorderedGraph;
+    andres::graph::Reordering reordering;
+    andres::graph::reorder(graph, order, reorderedGraph, reordering);
+    testReordering(graph, reorderedGraph, reordering);
+    test(bandwidth(reorderedGraph) == 1);
+}
+
+void testMultipleEdges() {
+    andres::graph::Graph<> graph(4);
+    graph.multipleEdgesEnabled() = true;
+    graph.insertEdge(0, 3);
+    graph.insertEdge(3, 0);
+    graph.insertEdge(1, 2);
+
+    const std::vector<std::size_t> order = {3, 2, 1, 0};
+    andres::graph::Graph<> reorderedGraph;
+    andres::graph::Reordering reordering;
+    andres::graph::reorder(graph, order, reorderedGraph, reordering);
+    testReordering(graph, reorderedGraph, reordering);
+    test(reorderedGraph.multipleEdgesEnabled());
+}
+
+void testDigraph() {
+    andres::graph::Digraph<> graph(5);
+    graph.insertEdge(4, 0);
+    graph.insertEdge(0, 4);
+    graph.insertEdge(2, 1);
+    graph.insertEdge(3, 2);
+
+    std::vector<std::size_t> order;
+    andres::graph::reverseCuthillMcKeeOrder(graph, order);
+    testPermutation(graph, order);
+
+    andres::graph::Digraph<> reorderedGraph;
+    andres::graph::Reordering reordering;
+    andres::graph::reorder(graph, order, reorderedGraph, reordering);
+    testReordering(graph, reorderedGraph, reordering);
+}
+
+void testGridGraph() {
+    andres::graph::GridGraph<2> graph({5, 4});
+
+    std::vector<std::size_t> order;
+    andres::graph::reverseCuthillMcKeeOrder(graph, order);
+    testPermutation(graph, order);
+
+    andres::graph::Graph<> reorderedGraph;
+    andres::graph::Reordering reordering;
+    andres::graph::reorder(graph, order, reorderedGraph, reordering);
+    testReordering(graph, reorderedGraph, reordering);
+}
+
+void testMortonOrder() {
+    std::vector<std::array<std::size_t, 2> > coordinates;
+    for(std::size_t y = 0; y < 4; ++y)
+    for(std::size_t x = 0; x < 4; ++x) {
+        coordinates.push_back({{x, y}});
+    }
+
+    std::vector<std::size_t> order;
+    andres::graph::mortonOrder(coordinates.begin(), coordinates.end(), order);
+
+    // Z-order with the first coordinate in the more significant bits
+    const std::size_t expected[] = {0, 4, 1, 5, 8, 12, 9, 13, 2, 6, 3, 7, 10, 14, 11, 15};
+    test(order.size() == 16);
+    for(std::size_t j = 0; j < 16; ++j) {
+        test(order[j] == expected[j]);
+    }
+}
+
+void testInvalidOrder() {
+    andres::graph::Graph<> graph(3);
+    andres::graph::Graph<> reorderedGraph;
+    andres::graph::Reordering reordering;
+
+    bool thrown = false;
+    try {
+        andres::graph::reorder(graph, std::vector<std::size_t>({0, 1, 1}), reorderedGraph, reordering);
+    }
+    catch(const std::runtime_error&) {
+        thrown = true;
+    }
+    test(thrown);
+}
+
+int main() {
+    testGraph();
+    testComponents();
+    testMultipleEdges();
+    testDigraph();
+    testGridGraph();
+    testMortonOrder();
+    testInvalidOrder();
+
+    return 0;
+}
@@ -1,9 +1,15 @@
 #include <cstddef>
+#include <cmath>
 #include <stdexcept>
+#include <limits>
+#include <deque>
+#include <vector>
 
 #include "andres/graph/graph.hxx"
 #include "andres/graph/digraph.hxx"
+#include "andres/graph/grid-graph.hxx"
 #include "andres/graph/shortest-paths.hxx"
+#include "andres/graph/search-workspace.hxx"
 
 inline void test(const bool& pred) { 
     if(!pred) throw std::runtime_error("Test failed."); 
@@ -1455,5 +1461,276 @@ int main() {
         }
     }
 
+    // searches with a reused workspace, compared with searches with buffers
+    // that are initialized for all vertices
+    {
+        std::size_t state = 1;
+        auto random = [&](const std::size_t n) {
+            state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+            return (state >> 33) % n;
+        };
+
+        andres::graph::SearchWorkspace<> workspace;
+        andres::graph::SearchWorkspace<unsigned int> weightedWorkspace;
+        workspace.generation_ = std::numeric_limits<andres::graph::SearchWorkspace<>::Generation>::max() - 100;
+        for(std::size_t n = 200; n > 0; n /= 4) {
+            andres::graph::Digraph<> g(n);
+            std::vector<unsigned int> edgeWeights;
+            for(std::size_t j = 0; j < 3 * n; ++j) {
+                g.insertEdge(random(n), random(n));
+                edgeWeights.push_back(random(10));
+            }
+            const unsigned int infinity = std::numeric_limits<unsigned int>::max();
+            std::vector<unsigned int> distances(n);
+            std::vector<std::size_t> parents(n);
+            std::vector<std::size_t> hopDistances(n);
+            std::deque<std::size_t> expectedPath;
+            std::deque<std::size_t> path;
+            for(std::size_t vs = 0; vs < n; ++vs) {
+                andres::graph::sssp(g, vs, edgeWeights.begin(), distances.begin(), parents.begin());
+                andres::graph::sssp(g, vs, edgeWeights.begin(), weightedWorkspace);
+                for(std::size_t v = 0; v < n; ++v) {
+                    test(weightedWorkspace.distance(v) == distances[v]);
+                    if(v != vs && distances[v] != infinity) {
+                        const std::size_t p = weightedWorkspace.parent(v);
+                        test(g.vertexOfEdge(weightedWorkspace.parentEdge(v), 0) == p);
+                        test(g.vertexOfEdge(weightedWorkspace.parentEdge(v), 1) == v);
+                        test(distances[p] + edgeWeights[weightedWorkspace.parentEdge(v)] == distances[v]);
+                    }
+                }
+
+                andres::graph::sssp(g, SubgraphMask4(), vs, hopDistances.begin());
+                andres::graph::sssp(g, SubgraphMask4(), vs, workspace);
+                for(std::size_t v = 0; v < n; ++v) {
+                    test(workspace.distance(v) == hopDistances[v]);
+                }
+
+                const std::size_t vt = random(n);
+                const bool expectedFound = andres::graph::spsp(g, SubgraphMask4(), vs, vt, expectedPath);
+                const bool found = andres::graph::spsp(g, SubgraphMask4(), vs, vt, path, workspace);
+                test(found == expectedFound);
+                test(path.size() == expectedPath.size());
+                for(std::size_t j = 0; j + 1 < path.size(); ++j) {
+                    const std::pair<bool, std::size_t> edge = g.findEdge(path[j], path[j + 1]);
+                    test(edge.first);
+                }
+
+                andres::graph::spspEdges(g, SubgraphMask4(), vs, vt, expectedPath);
+                andres::graph::spspEdges(g, SubgraphMask4(), vs, vt, path, workspace);
+                test(path.size() == expectedPath.size());
+
+                unsigned int expectedDistance;
+                unsigned int distance;
+                andres::graph::spsp(g, vs, vt, edgeWeights.begin(), expectedPath, expectedDistance);
+                andres::graph::spsp(g, vs, vt, edgeWeights.begin(), path, distance, weightedWorkspace);
+                test(distance == expectedDistance);
+                test(path.empty() == expectedPath.empty());
+                if(!path.empty()) {
+                    test(path.front() == vs);
+                    test(path.back() == vt);
+                    for(std::size_t j = 0; j + 1 < path.size(); ++j) {
+                        test(g.findEdge(path[j], path[j + 1]).first);
+                    }
+                }
+
+                andres::graph::spspEdges(g, andres::graph::DefaultSubgraphMask<>(), vs, vt, edgeWeights.begin(), path, distance, weightedWorkspace);
+                test(distance == expectedDistance);
+                unsigned int length = 0;
+                for(std::size_t j = 0; j < path.size(); ++j) {
+                    length += edgeWeights[path[j]];
+                }
+                if(distance != infinity) {
+                    test(length == distance);
+                }
+            }
+        }
+    }
+
+    // bidirectional searches in undirected graphs with real-valued weights,
+    // compared with searches from the source vertex only
+    {
+        std::size_t state = 3;
+        auto random = [&](const std::size_t n) {
+            state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+            return (state >> 33) % n;
+        };
+
+        andres::graph::SearchWorkspace<double> workspace;
+        for(std::size_t n = 300; n > 1; n /= 3) {
+            andres::graph::Graph<> g(n);
+            std::vector<double> edgeWeights;
+            for(std::size_t j = 0; j < 2 * n; ++j) {
+                g.insertEdge(random(n), random(n));
+                edgeWeights.push_back(static_cast<double>(random(1000)) / 100.0);
+            }
+            std::vector<double> distances(n);
+            std::vector<std::size_t> parents(n);
+            std::deque<std::size_t> path;
+            for(std::size_t vs = 0; vs < n; ++vs) {
+                andres::graph::sssp(g, vs, edgeWeights.begin(), distances.begin(), parents.begin());
+                for(std::size_t k = 0; k < 5; ++k) {
+                    const std::size_t vt = random(n);
+                    double distance;
+                    andres::graph::spspEdges(g, andres::graph::DefaultSubgraphMask<>(), vs, vt, edgeWeights.begin(), path, distance, workspace);
+                    const double infinity = std::numeric_limits<double>::infinity();
+                    test((distance == infinity) == (distances[vt] == infinity));
+                    test(path.empty() == (distance == infinity) || (vs == vt && distance == 0));
+                    if(distance != infinity) {
+                        test(std::abs(distance - distances[vt]) < 1e-9);
+                        double length = 0;
+                        std::size_t v = vs;
+                        for(std::size_t j = 0; j < path.size(); ++j) {
+                            length += edgeWeights[path[j]];
+                            v = g.vertexOfEdge(path[j], 0) == v ? g.vertexOfEdge(path[j], 1) : g.vertexOfEdge(path[j], 0);
+                        }
+                        test(v == vt);
+                        test(std::abs(length - distance) < 1e-9);
+                    }
+                }
+            }
+        }
+    }
+
+    // parallel delta-stepping, compared with Dijkstra's algorithm
+    {
+        std::size_t state = 5;
+        auto random = [&](const std::size_t n) {
+            state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+            return (state >> 33) % n;
+        };
+
+        const std::size_t n = 500;
+        andres::graph::Digraph<> g(n);
+        std::vector<unsigned int> edgeWeights;
+        for(std::size_t j = 0; j < 4 * n; ++j) {
+            g.insertEdge(random(n), random(n));
+            edgeWeights.push_back(random(20)); // including 0
+        }
+        const unsigned int infinity = std::numeric_limits<unsigned int>::max();
+        std::vector<unsigned int> expectedDistances(n);
+        std::vector<std::size_t> expectedParents(n);
+        std::vector<unsigned int> distances(n);
+        std::vector<std::size_t> parents(n);
+        const unsigned int deltas[] = {1, 5, 100};
+        for(std::size_t k = 0; k < 3; ++k) {
+            andres::graph::DeltaSteppingBuffers<unsigned int> buffers(deltas[k]);
+            for(std::size_t vs = 0; vs < n; vs += 7) {
+                andres::graph::sssp(g, SubgraphMask4(), vs, edgeWeights.begin(), expectedDistances.begin(), expectedParents.begin());
+                andres::graph::sssp(g, SubgraphMask4(), vs, edgeWeights.begin(), distances.begin(), parents.begin(), buffers);
+                for(std::size_t v = 0; v < n; ++v) {
+                    test(distances[v] == expectedDistances[v]);
+                    if(v == vs || distances[v] == infinity) {
+                        continue;
+                    }
+                    // parents lead back to vs along edges of shortest paths
+                    std::size_t w = v;
+                    for(std::size_t length = 0; w != vs; ++length) {
+                        test(length < n);
+                        const std::size_t u = parents[w];
+                        bool tight = false;
+                        for(auto it = g.adjacenciesToVertexBegin(w); it != g.adjacenciesToVertexEnd(w); ++it) {
+                            if(it->vertex() == u && it->edge() != 3 && distances[u] + edgeWeights[it->edge()] == distances[w]) {
+                                tight = true;
+                            }
+                        }
+                        test(tight);
+                        w = u;
+                    }
+                }
+            }
+        }
+
+        andres::graph::Graph<> h(n);
+        std::vector<double> realWeights;
+        for(std::size_t j = 0; j < 3 * n; ++j) {
+            h.insertEdge(random(n), random(n));
+            realWeights.push_back(static_cast<double>(random(1000)) / 100.0);
+        }
+        std::vector<double> expectedRealDistances(n);
+        std::vector<double> realDistances(n);
+        andres::graph::DeltaSteppingBuffers<double> buffers(2.5);
+        for(std::size_t vs = 0; vs < n; vs += 11) {
+            andres::graph::sssp(h, andres::graph::DefaultSubgraphMask<>(), vs, realWeights.begin(), expectedRealDistances.begin(), expectedParents.begin());
+            andres::graph::sssp(h, vs, realWeights.begin(), realDistances.begin(), parents.begin(), buffers);
+            for(std::size_t v = 0; v < n; ++v) {
+                test(realDistances[v] == expectedRealDistances[v] || std::abs(realDistances[v] - expectedRealDistances[v]) < 1e-9);
+            }
+        }
+
+        // small delta, weights that are inexact multiples of delta, and
+        // cyclic buckets whose number depends only on the largest weight
+        andres::graph::DeltaSteppingBuffers<double> smallBuffers(0.01);
+        for(std::size_t vs = 0; vs < n; vs += 37) {
+            andres::graph::sssp(h, andres::graph::DefaultSubgraphMask<>(), vs, realWeights.begin(), expectedRealDistances.begin(), expectedParents.begin());
+            andres::graph::sssp(h, vs, realWeights.begin(), realDistances.begin(), parents.begin(), smallBuffers);
+            for(std::size_t v = 0; v < n; ++v) {
+                test(realDistances[v] == expectedRealDistances[v] || std::abs(realDistances[v] - expectedRealDistances[v]) < 1e-9);
+            }
+            for(std::size_t t = 0; t < smallBuffers.buckets_.size(); ++t) {
+                test(smallBuffers.buckets_[t].size() <= 1001);
+            }
+        }
+    }
+
+    // grid graphs, whose adjacencies are enumerated from the stencil, and
+    // A*, compared with Dijkstra's algorithm in a graph with the same edges
+    {
+        std::size_t state = 9;
+        auto random = [&](const std::size_t n) {
+            state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+            return (state >> 33) % n;
+        };
+
+        andres::graph::GridGraph<3> grid({7, 5, 4});
+        const std::size_t n = grid.numberOfVertices();
+        andres::graph::Graph<> g(n);
+        std::vector<unsigned int> edgeWeights(grid.numberOfEdges());
+        for(std::size_t e = 0; e < grid.numberOfEdges(); ++e) {
+            g.insertEdge(grid.vertexOfEdge(e, 0), grid.vertexOfEdge(e, 1));
+            edgeWeights[e] = 2 + random(9);
+        }
+        const unsigned int infinity = std::numeric_limits<unsigned int>::max();
+        std::vector<unsigned int> expectedDistances(n);
+        std::vector<unsigned int> distances(n);
+        std::vector<std::size_t> parents(n);
+        andres::graph::SearchWorkspace<unsigned int, andres::graph::IndexedHeapTag> heapWorkspace;
+        andres::graph::SearchWorkspace<unsigned int, andres::graph::BucketQueueTag> bucketWorkspace;
+        andres::graph::SearchWorkspace<unsigned int> workspace;
+        std::deque<std::size_t> path;
+        for(std::size_t vs = 0; vs < n; vs += 3) {
+            andres::graph::sssp(g, SubgraphMask4(), vs, edgeWeights.begin(), expectedDistances.begin(), parents.begin());
+            andres::graph::sssp(grid, SubgraphMask4(), vs, edgeWeights.begin(), distances.begin(), parents.begin());
+            for(std::size_t v = 0; v < n; ++v) {
+                test(distances[v] == expectedDistances[v]);
+            }
+            andres::graph::sssp(grid, SubgraphMask4(), vs, edgeWeights.begin(), workspace);
+            for(std::size_t v = 0; v < n; ++v) {
+                test(workspace.distance(v) == expectedDistances[v]);
+            }
+
+            for(std::size_t vt = 0; vt < n; vt += 5) {
+                unsigned int distance;
+                andres::graph::spsp(grid, SubgraphMask4(), vs, vt, edgeWeights.begin(), path, distance, heapWorkspace, 2u);
+                test(distance == expectedDistances[vt]);
+                andres::graph::spsp(grid, SubgraphMask4(), vs, vt, edgeWeights.begin(), path, distance, workspace, 0u);
+                test(distance == expectedDistances[vt]);
+                andres::graph::spsp(grid, SubgraphMask4(), vs, vt, edgeWeights.begin(), path, distance, bucketWorkspace, 2u);
+                test(distance == expectedDistances[vt]);
+                test(path.empty() == (distance == infinity));
+                if(!path.empty()) {
+                    test(path.front() == vs);
+                    test(path.back() == vt);
+                    unsigned int length = 0;
+                    for(std::size_t j = 0; j + 1 < path.size(); ++j) {
+                        const std::pair<bool, std::size_t> edge = grid.findEdge(path[j], path[j + 1]);
+                        test(edge.first && edge.second != 3);
+                        length += edgeWeights[edge.second];
+                    }
+                    test(length == distance);
+                }
+            }
+        }
+    }
+
     return 0;
 }
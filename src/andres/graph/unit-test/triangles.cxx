@@ -1,5 +1,11 @@
+#include <array>
+#include <cstdint>
+#include <random>
+#include <set>
 #include <stdexcept>
+#include <vector>
 #include "andres/graph/graph.hxx"
+#include "andres/graph/complete-graph.hxx"
 #include "andres/graph/triangles.hxx"
 
 
@@ -48,9 +54,95 @@ void testTriangles()
     }
 }
 
+void testFlatTriangles()
+{
+    andres::graph::Graph<> graph(6);
+    graph.insertEdge(0, 1);
+    graph.insertEdge(0, 2);
+    graph.insertEdge(1, 2);
+    graph.insertEdge(1, 4);
+    graph.insertEdge(1, 3);
+    graph.insertEdge(3, 4);
+    graph.insertEdge(2, 4);
+    graph.insertEdge(4, 5);
+    graph.insertEdge(3, 5);
+
+    std::vector<std::array<std::uint32_t, 3>> triangles;
+    findTriangles(graph, triangles);
+
+    test(triangles.size() == 4);
+    test(countTriangles(graph) == 4);
+
+    std::set<std::array<std::uint32_t, 3>> expected{{{0, 1, 2}}, {{1, 2, 4}}, {{1, 3, 4}}, {{3, 4, 5}}};
+    test(std::set<std::array<std::uint32_t, 3>>(triangles.begin(), triangles.end()) == expected);
+
+    // forEachTriangle reports the triangles in the same order
+    size_t j = 0;
+    forEachTriangle(graph, [&] (const size_t v0, const size_t v1, const size_t v2) {
+        test(j < triangles.size());
+        test(triangles[j][0] == v0 && triangles[j][1] == v1 && triangles[j][2] == v2);
+        j++;
+    });
+    test(j == triangles.size());
+
+    // parallel edges do not duplicate triangles
+    graph.multipleEdgesEnabled() = true;
+    graph.insertEdge(2, 1);
+    test(countTriangles(graph) == 4);
+}
+
+void testCompleteGraph()
+{
+    andres::graph::CompleteGraph<> graph(9);
+
+    test(countTriangles(graph) == 84);
+
+    std::vector<std::array<size_t, 3>> triangles;
+    findTriangles(graph, triangles);
+    test(std::set<std::array<size_t, 3>>(triangles.begin(), triangles.end()).size() == 84);
+}
+
+// every triangle is found once, compared to all vertex triples
+void testRandomGraphs()
+{
+    std::mt19937 generator(42);
+
+    for (size_t trial = 0; trial < 50; trial++)
+    {
+        const size_t numberOfVertices = 3 + trial;
+        std::bernoulli_distribution distribution(0.3);
+
+        andres::graph::Graph<> graph(numberOfVertices);
+        for (size_t v0 = 0; v0 < numberOfVertices; v0++)
+        for (size_t v1 = v0 + 1; v1 < numberOfVertices; v1++)
+            if (distribution(generator))
+                graph.insertEdge(v0, v1);
+
+        std::set<std::array<size_t, 3>> expected;
+        for (size_t v0 = 0; v0 < numberOfVertices; v0++)
+        for (size_t v1 = v0 + 1; v1 < numberOfVertices; v1++)
+        for (size_t v2 = v1 + 1; v2 < numberOfVertices; v2++)
+            if (graph.findEdge(v0, v1).first && graph.findEdge(v0, v2).first && graph.findEdge(v1, v2).first)
+                expected.insert({{v0, v1, v2}});
+
+        std::vector<std::array<size_t, 3>> triangles;
+        findTriangles(graph, triangles);
+
+        test(triangles.size() == expected.size());
+        test(std::set<std::array<size_t, 3>>(triangles.begin(), triangles.end()) == expected);
+        test(countTriangles(graph) == expected.size());
+    }
+}
+
 int main()
 {
     testTriangles();
 
+    testFlatTriangles();
+
+    testCompleteGraph();
+
+    testRandomGraphs();
+
     return 0;
-}
\ No newline at end of file
+}
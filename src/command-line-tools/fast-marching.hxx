@@ -6,8 +6,11 @@
 #include <iterator>
 #include <vector>
 #include <type_traits>
+#include <limits>
+#include <algorithm> // std::fill
 
 #include <andres/graph/grid-graph.hxx>
+#include <andres/graph/search-workspace.hxx>
 
 
 /// \cond SUPPRESS DOXYGEN
@@ -27,21 +30,45 @@ struct my_make_signed<T,
 }
 /// \endcond
 
+/// Buffers for fastMarching that are reused across calls without being reset
+/// for all vertices. Vertices are marked with the generation of the search
+/// that has last reached, frozen or found them next to the source vertex.
+///
 template<class T = double, class S = std::size_t>
 class FastMarchingBuffers {
 public:
     typedef T value_type;
     typedef S size_type;
+    typedef typename andres::graph::SearchWorkspace<value_type, andres::graph::IndexedHeapTag>::Generation Generation;
 
-    FastMarchingBuffers(std::size_t N)
-        :   targetEdgeOfVertexWithSource_(N),
-            isVertexFrozen_(N),
-            distances_(N)
+    FastMarchingBuffers(std::size_t N = 0)
+        :   workspace_(N),
+            targetEdgeOfVertexWithSource_(N),
+            sourceNeighborGenerations_(N),
+            frozenGenerations_(N)
         {}
+    void startSearch(const std::size_t N)
+        {
+            workspace_.startSearch(N);
+            if(frozenGenerations_.size() < N) {
+                targetEdgeOfVertexWithSource_.resize(N);
+                sourceNeighborGenerations_.resize(N, 0);
+                frozenGenerations_.resize(N, 0);
+            }
+            if(workspace_.generation_ == 1) { // generations have wrapped around
+                std::fill(sourceNeighborGenerations_.begin(), sourceNeighborGenerations_.end(), 0);
+                std::fill(frozenGenerations_.begin(), frozenGenerations_.end(), 0);
+            }
+        }
+    bool isSourceNeighbor(const std::size_t v) const
+        { return sourceNeighborGenerations_[v] == workspace_.generation_; }
+    bool isVertexFrozen(const std::size_t v) const
+        { return frozenGenerations_[v] == workspace_.generation_; }
 
+    andres::graph::SearchWorkspace<value_type, andres::graph::IndexedHeapTag> workspace_; // distances, arrival times need not be monotone
     std::vector<size_type> targetEdgeOfVertexWithSource_;
-    std::vector<unsigned char> isVertexFrozen_;
-    std::vector<value_type> distances_;
+    std::vector<Generation> sourceNeighborGenerations_;
+    std::vector<Generation> frozenGenerations_;
 };
 
 /// Fast Marching Algorithm for (a subgraph of) a 2-dimensional grid graph.
@@ -99,9 +126,9 @@ fastMarching(
     typedef std::size_t size_type;
     typedef andres::graph::GridGraph<2, INPUT_GRAPH_VISITOR> InputGraph;
     typedef typename InputGraph::AdjacencyType Adjacency;
-    typedef typename InputGraph::EdgeCoordinate EdgeCoordinate;
     typedef typename std::iterator_traits<TARGET_EDGE_VALUE_ITERATOR>::value_type Value;
     typedef typename detail::my_make_signed<Value>::type signedValue;
+    typedef typename FastMarchingBuffers<Value, std::size_t>::Generation Generation;
     if(interpolationOrder > 1) {
         throw std::runtime_error("specified interpolation order not implemented.");
     }
@@ -114,71 +141,43 @@ fastMarching(
         ? std::numeric_limits<Value>::infinity()
         : std::numeric_limits<Value>::max();
 
-    // make explicit, for each vertex:
-    // - if it is a neighbor of sourceVertex in the targret graph
-    // - if so, what the index of the connecting edge is (-1 if none)
-    // initialize isVertexFrozen is a Boolean vector with
-    // - size targetGraph.numberOfVertices()
-    // - isVertexFrozen[v] == 1 iff, for the edge e = (sourceVertex, v) in the target graph, targetEdgeValues[e] < infinity
-    size_type maxEdge = targetGraph.numberOfEdges();
-
-    // buffers.targetEdgeOfVertexWithSource_.resize(targetGraph.numberOfVertices());
-    std::fill(
-        buffers.targetEdgeOfVertexWithSource_.begin(),
-        buffers.targetEdgeOfVertexWithSource_.end(),
-        maxEdge + 1
-    );
+    // make explicit, for each neighbor of sourceVertex in the target graph,
+    // what the index of the connecting edge is. all other vertices are
+    // neither neighbors of the source vertex, nor frozen, nor reached, by
+    // starting a new search in the buffers.
+    // edges along dimension 0 precede those along dimension 1
+    const size_type numberOfHorizontalEdges = inputGraph.shape(0) == 0 ? 0 : (inputGraph.shape(0) - 1) * inputGraph.shape(1);
 
-    size_type numberOfVerticesLeft = targetGraph.numberOfEdgesFromVertex(sourceVertex);
+    buffers.startSearch(targetGraph.numberOfVertices());
+    const Generation generation = buffers.workspace_.generation_;
 
-    // buffers.isVertexFrozen_.resize(targetGraph.numberOfVertices());
-    std::fill(buffers.isVertexFrozen_.begin(), buffers.isVertexFrozen_.end(), 0);
-
-    // buffers.distances_.resize(targetGraph.numberOfVertices());
-    std::fill(buffers.distances_.begin(), buffers.distances_.end(), infinity);
+    size_type numberOfVerticesLeft = targetGraph.numberOfEdgesFromVertex(sourceVertex);
 
-    buffers.distances_[sourceVertex] = 0;
+    buffers.workspace_.markVisited(sourceVertex);
+    buffers.workspace_.distances_[sourceVertex] = 0;
 
     for (auto it = targetGraph.adjacenciesFromVertexBegin(sourceVertex); it != targetGraph.adjacenciesFromVertexEnd(sourceVertex); ++it)
-        buffers.targetEdgeOfVertexWithSource_[it->vertex()] = it->edge();
-
-    struct elem
     {
-        size_type v;
-        Value minArrivalTime;
-
-        elem(size_type _v, Value _minArrivalTime) :
-            v(_v), minArrivalTime(_minArrivalTime)
-        {}
-
-        // because we need min-priority queue
-        bool operator<(elem const& other) const
-        {
-            return minArrivalTime > other.minArrivalTime;
-        }
-    };
+        buffers.targetEdgeOfVertexWithSource_[it->vertex()] = it->edge();
+        buffers.sourceNeighborGenerations_[it->vertex()] = generation;
+    }
 
-    std::priority_queue<elem> trial;
-    trial.emplace(sourceVertex, Value());
+    // each vertex is contained at most once, with its arrival time
+    auto& trial = buffers.workspace_.heap_;
+    trial.push(sourceVertex, Value());
 
     while (!trial.empty() && numberOfVerticesLeft > 0)
     {
-        while (!trial.empty() && buffers.isVertexFrozen_[trial.top().v])
-            trial.pop();
-
-        if (trial.empty())
-            return;
-
-        auto frozenVertex = trial.top().v;
-        auto minArrivalTime = trial.top().minArrivalTime;
+        auto frozenVertex = trial.top();
+        auto minArrivalTime = trial.topKey();
 
         trial.pop();
 
-        buffers.isVertexFrozen_[frozenVertex] = 1;
+        buffers.frozenGenerations_[frozenVertex] = generation;
 
-        const size_type targetEdge = buffers.targetEdgeOfVertexWithSource_[frozenVertex];
-        if (targetEdge <= maxEdge) // if frozenVertex is a neighbor of sourceVertex in targetGraph
+        if (buffers.isSourceNeighbor(frozenVertex)) // if frozenVertex is a neighbor of sourceVertex in targetGraph
         {
+            const size_type targetEdge = buffers.targetEdgeOfVertexWithSource_[frozenVertex];
 #pragma omp critical
             {
                 targetEdgeValues[targetEdge] = minArrivalTime;
@@ -193,41 +192,34 @@ fastMarching(
         // For each neighbor u of frozenVertex do unless isFrozen[u]
         // 1. Calculate arrival-time
         // 2. Insert u into trial set or update arrival time of u if already in the trial set.
-        size_type numAdjacenciesOfFrozen = inputGraph.numberOfEdgesFromVertex(frozenVertex);
-        for (size_type a_id = 0; a_id < numAdjacenciesOfFrozen; ++a_id)
+        inputGraph.forEachAdjacency(frozenVertex, [&](const Adjacency& a)
         {
-            const Adjacency& a = inputGraph.adjacencyFromVertex(frozenVertex, a_id);
             const size_type u = a.vertex();
-            const size_type ue = a.edge();
 
-            if (buffers.isVertexFrozen_[u] == 0)
+            if (!buffers.isVertexFrozen(u))
             {
                 // Compute Arrival time
                 std::array<Value, 2> d;
                 std::array<Value, 2> T = {{infinity,infinity}};
 
-                EdgeCoordinate veCoord;
-                for (size_type au_id = 0; au_id < inputGraph.numberOfEdgesFromVertex(u); ++au_id)
+                inputGraph.forEachAdjacency(u, [&](const Adjacency& au)
                 {
-                    const Adjacency& au = inputGraph.adjacencyFromVertex(u, au_id);
                     const size_type v = au.vertex();
                     const size_type ve = au.edge();
 
-                    inputGraph.edge(ve, veCoord);
-
-                    const size_type dimension = veCoord.dimension_; // Dimension along which the edge runs (0=horiz)
+                    const size_type dimension = ve < numberOfHorizontalEdges ? 0 : 1; // Dimension along which the edge runs (0=horiz)
                     const Value edgeWeight = inputEdgeValues[ve];
-                    const Value vDistance = buffers.distances_[v];
+                    const Value vDistance = buffers.workspace_.distance(v);
 
                     if (vDistance == infinity)
-                        continue; // Otherwise addition overflows
+                        return; // Otherwise addition overflows
 
                     if (T[dimension] == infinity || vDistance + edgeWeight < T[dimension] + d[dimension])
                     {
                         d[dimension] = edgeWeight;
                         T[dimension] = vDistance;
                     }
-                }
+                });
                 // Compute arrival time.
 
 
@@ -260,11 +252,13 @@ fastMarching(
                     }
                 }
 
-                buffers.distances_[u] = std::min(buffers.distances_[u], at);
+                const Value uDistance = std::min(buffers.workspace_.distance(u), at);
+                buffers.workspace_.markVisited(u);
+                buffers.workspace_.distances_[u] = uDistance;
 
-                trial.emplace(u, buffers.distances_[u]);
+                trial.pushOrDecreaseKey(u, uDistance);
             }
-        }
+        });
     }
 }
 
@@ -2,6 +2,7 @@
 #include <iostream>
 #include <sstream>
 #include <numeric>
+#include <limits>
 
 #include <tclap/CmdLine.h>
 
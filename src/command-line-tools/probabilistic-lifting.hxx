@@ -3,17 +3,22 @@
 #define PROBABILISTIC_LIFTING
 
 #include <andres/graph/shortest-paths.hxx>
+#include <andres/graph/edge-index.hxx>
 
 #include "fast-marching.hxx"
 
 /// Lift edge values from a source graph to a target graph.
+///
+/// Edges of the target graph are looked up in the optional edge index.
+///
 template<class SOURCE_GRAPH, class TARGET_GRAPH, class SOURCE_EDGE_VALUE_ITERATOR, class TARGET_EDGE_VALUE_ITERATOR>
 void
 liftEdgeValues(
     const SOURCE_GRAPH& sourceGraph,
     const TARGET_GRAPH& targetGraph,
     const SOURCE_EDGE_VALUE_ITERATOR sit,
-    TARGET_EDGE_VALUE_ITERATOR tit
+    TARGET_EDGE_VALUE_ITERATOR tit,
+    const andres::graph::EdgeIndex<TARGET_GRAPH>* targetEdgeIndex = nullptr
 ) {
     typedef std::size_t size_type;
     typedef typename std::iterator_traits<SOURCE_EDGE_VALUE_ITERATOR>::value_type value_type;
@@ -85,11 +90,15 @@ liftEdgeValues(
         auto v0 = sourceGraph.vertexOfEdge(e, 0);
         auto v1 = sourceGraph.vertexOfEdge(e, 1);
 
-        tit[targetGraph.findEdge(v0, v1).second] = sit[e];
+        auto const p = targetEdgeIndex ? targetEdgeIndex->findEdge(v0, v1) : targetGraph.findEdge(v0, v1);
+        tit[p.second] = sit[e];
     }
 }
 
 /// Lift edge values from a 2-dimensional grid graph to a target graph.
+///
+/// Edges of the target graph are looked up in the optional edge index.
+///
 template<class SOURCE_GRAPH_VISITOR, class TARGET_GRAPH, class SOURCE_EDGE_VALUE_ITERATOR, class TARGET_EDGE_VALUE_ITERATOR>
 void
 liftEdgeValues(
@@ -97,7 +106,8 @@ liftEdgeValues(
     const TARGET_GRAPH& targetGraph,
     SOURCE_EDGE_VALUE_ITERATOR sit,
     TARGET_EDGE_VALUE_ITERATOR tit,
-    const std::size_t interpolationOrder = 0
+    const std::size_t interpolationOrder = 0,
+    const andres::graph::EdgeIndex<TARGET_GRAPH>* targetEdgeIndex = nullptr
 ) {
     typedef std::size_t size_type;
     typedef typename std::iterator_traits<TARGET_EDGE_VALUE_ITERATOR>::value_type target_value_type;
@@ -127,7 +137,8 @@ liftEdgeValues(
         auto v0 = sourceGraph.vertexOfEdge(e, 0);
         auto v1 = sourceGraph.vertexOfEdge(e, 1);
 
-        tit[targetGraph.findEdge(v0, v1).second] = sit[e];
+        auto const p = targetEdgeIndex ? targetEdgeIndex->findEdge(v0, v1) : targetGraph.findEdge(v0, v1);
+        tit[p.second] = sit[e];
     }
 }
 
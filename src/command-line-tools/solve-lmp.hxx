@@ -1,3 +1,4 @@
+#include <cstdint>
 #include <numeric>
 #include <stdexcept>
 #include <iostream>
@@ -49,6 +50,7 @@ struct Parameters {
     Method optimizationMethod { Method::Kernighan_Lin };
     Initialization initialization { Initialization::Zeros };
     bool probabilistic { true };
+    bool reorder { false };
 };
 
 inline void
@@ -66,12 +68,14 @@ try
     TCLAP::ValueArg<std::string> argOptimizationMethod("m", "optimization-method", "optimization method to use {zeros, ones, ILP, LP, GAEC, KL}", false, "KL", "OPTIMIZATION_METHOD", tclap);
     TCLAP::ValueArg<std::string> argInitializationMethod("I", "initialization-method", "initialization method to use {zeros, ones, GAEC}", false, "zeros", "INITIALIZATION_METHOD", tclap);
     TCLAP::SwitchArg argNonProbabilistic("p", "non-probabilistic", "Assume inputs are not probabilities. By default, all inputs are assumed to be Logistic Probabilities. (Default: disabled).",tclap);
+    TCLAP::SwitchArg argReorder("r", "reorder", "Renumber vertices by reverse Cuthill-McKee before solving, for better memory locality. Outputs refer to the original numbering. (Default: disabled).", tclap);
 
     tclap.parse(argc, argv);
 
     parameters.inputHDF5FileName = argInputHDF5FileName.getValue();
     parameters.outputHDF5FileName = argOutputHDF5FileName.getValue();
     parameters.probabilistic = !argNonProbabilistic.getValue();
+    parameters.reorder = argReorder.getValue();
 
     if (!argOptimizationMethod.isSet())
         throw std::runtime_error("No optimization method specified");
@@ -129,25 +133,47 @@ void solveLiftedMulticutProblem(
     std::ostream& stream = std::cerr
 )
 {
-    GraphType original_graph;
-    andres::graph::Graph<> lifted_graph;
+    typedef andres::graph::Graph<std::uint32_t> LiftedGraphType;
+
+    GraphType input_original_graph;
+    LiftedGraphType input_lifted_graph;
     std::vector<double> edge_values;
 
     // Load Lifted Multicut Problem
     {
         auto fileHandle = andres::graph::hdf5::openFile(parameters.inputHDF5FileName);
 
-        andres::graph::hdf5::load(fileHandle, "graph", original_graph);
-        andres::graph::hdf5::load(fileHandle, "graph-lifted", lifted_graph);
+        andres::graph::hdf5::load(fileHandle, "graph", input_original_graph);
+        andres::graph::hdf5::load(fileHandle, "graph-lifted", input_lifted_graph);
 
         std::vector<size_t> shape;
         andres::graph::hdf5::load(fileHandle, "edge-cut-probabilities", shape, edge_values);
         andres::graph::hdf5::closeFile(fileHandle);
     }
 
-    std::cout << "Number of vertices: " << original_graph.numberOfVertices() << std::endl;
-    std::cout << "Number of non-lifted edges: " << original_graph.numberOfEdges() << std::endl;
-    std::cout << "Number of edges: " << lifted_graph.numberOfEdges() << std::endl;
+    std::cout << "Number of vertices: " << input_original_graph.numberOfVertices() << std::endl;
+    std::cout << "Number of non-lifted edges: " << input_original_graph.numberOfEdges() << std::endl;
+    std::cout << "Number of edges: " << input_lifted_graph.numberOfEdges() << std::endl;
+
+    // the problem is solved for the reordered graphs, and all outputs are mapped back to the input graphs.
+    // both graphs are renumbered by the same vertex order, computed for the original graph.
+    GraphType reordered_original_graph;
+    LiftedGraphType reordered_lifted_graph;
+    andres::graph::Reordering original_reordering;
+    andres::graph::Reordering lifted_reordering;
+    if (parameters.reorder)
+    {
+        std::vector<size_t> order;
+        andres::graph::reverseCuthillMcKeeOrder(input_original_graph, order);
+        reorderGraph(input_original_graph, order, reordered_original_graph, original_reordering);
+        reorderGraph(input_lifted_graph, order, reordered_lifted_graph, lifted_reordering);
+
+        std::vector<double> reordered_edge_values(edge_values.size());
+        lifted_reordering.permuteEdgeValues(edge_values.begin(), reordered_edge_values.begin());
+        edge_values.swap(reordered_edge_values);
+    }
+    const GraphType& original_graph = parameters.reorder ? reordered_original_graph : input_original_graph;
+    const LiftedGraphType& lifted_graph = parameters.reorder ? reordered_lifted_graph : input_lifted_graph;
 
     if (parameters.probabilistic)
         std::transform(
@@ -180,6 +206,13 @@ void solveLiftedMulticutProblem(
         assert(shape.size() == 1);
         assert(shape[0] == lifted_graph.numberOfVertices());
 
+        if (parameters.reorder)
+        {
+            std::vector<size_t> reordered_vertex_labels(vertex_labels.size());
+            lifted_reordering.permuteVertexValues(vertex_labels.begin(), reordered_vertex_labels.begin());
+            vertex_labels.swap(reordered_vertex_labels);
+        }
+
         edge_labels.resize(lifted_graph.numberOfEdges());
 
         vertexToEdgeLabels(original_graph, lifted_graph, vertex_labels, edge_labels);
@@ -206,11 +239,17 @@ void solveLiftedMulticutProblem(
 
         auto energy_value = std::inner_product(edge_values.begin(), edge_values.end(), values.begin(), .0);
 
+        if (parameters.reorder)
+        {
+            auto reordered_values = values;
+            lifted_reordering.restoreEdgeValues(reordered_values.begin(), values.begin());
+        }
+
         if (!parameters.outputHDF5FileName.empty())
         {
             auto file = andres::graph::hdf5::createFile(parameters.outputHDF5FileName);
 
-            andres::graph::hdf5::save(file, "graph", original_graph);
+            andres::graph::hdf5::save(file, "graph", input_original_graph);
             andres::graph::hdf5::save(file, "energy-value", energy_value);
             andres::graph::hdf5::save(file, "running-time", t.get_elapsed_seconds());
             andres::graph::hdf5::save(file, "labels", { values.size() }, values.data()); // we save directly edge values as given by the LP solution, since the latter is not guaranteed to be integer
@@ -234,23 +273,27 @@ void solveLiftedMulticutProblem(
     {
         auto file = andres::graph::hdf5::createFile(parameters.outputHDF5FileName);
 
-        andres::graph::hdf5::save(file, "graph", original_graph);
+        andres::graph::hdf5::save(file, "graph", input_original_graph);
 
         std::vector<size_t> vertex_labels(lifted_graph.numberOfVertices());
         edgeToVertexLabels(lifted_graph, edge_labels, vertex_labels);
 
-        andres::graph::hdf5::save(file, "labels", { vertex_labels.size() }, vertex_labels.data());
-
         auto energy_value = std::inner_product(edge_values.begin(), edge_values.end(), edge_labels.begin(), .0);
 
-        andres::graph::hdf5::save(file, "energy-value", energy_value);
-        andres::graph::hdf5::save(file, "running-time", t.get_elapsed_seconds());
-
         std::vector<char> true_edge_labels(lifted_graph.numberOfEdges());
         vertexToEdgeLabels(original_graph, lifted_graph, vertex_labels, true_edge_labels);
 
         auto true_energy_value = std::inner_product(edge_values.begin(), edge_values.end(), true_edge_labels.begin(), .0);
 
+        if (parameters.reorder)
+        {
+            auto reordered_vertex_labels = vertex_labels;
+            lifted_reordering.restoreVertexValues(reordered_vertex_labels.begin(), vertex_labels.begin());
+        }
+
+        andres::graph::hdf5::save(file, "labels", { vertex_labels.size() }, vertex_labels.data());
+        andres::graph::hdf5::save(file, "energy-value", energy_value);
+        andres::graph::hdf5::save(file, "running-time", t.get_elapsed_seconds());
         andres::graph::hdf5::save(file, "true-energy-value", true_energy_value);
 
         andres::graph::hdf5::closeFile(file);
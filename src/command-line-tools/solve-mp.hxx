@@ -60,6 +60,7 @@ struct Parameters {
     std::string labelingHDF5FileName;
     Method optimizationMethod_;
     Initialization initialization;
+    bool reorder;
 };
 
 inline void
@@ -78,12 +79,14 @@ parseCommandLine(
 
         TCLAP::ValueArg<std::string> argOptimizationMethod("m", "optimization-method", "optimization method to use {LP, ILP, GAEC, GF, KL, ICP, P, MWS, zeros, ones}", false, "KL", "OPTIMIZATION_METHOD", tclap);
         TCLAP::ValueArg<std::string> argInitializationMethod("I", "initialization-method", "initialization method to use {zeros, ones, GAEC, GF, MWS}", false, "zeros", "INITIALIZATION_METHOD", tclap);
+        TCLAP::SwitchArg argReorder("r", "reorder", "Renumber vertices by reverse Cuthill-McKee before solving, for better memory locality. Outputs refer to the original numbering. (Default: disabled).", tclap);
         
         tclap.parse(argc, argv);
 
         parameters.inputHDF5FileName = argInputHDF5FileName.getValue();
         parameters.outputHDF5FileName = argOutputHDF5FileName.getValue();
         parameters.labelingHDF5FileName = argLabelingHDF5FileName.getValue();
+        parameters.reorder = argReorder.getValue();
 
         if (!argOptimizationMethod.isSet())
             throw std::runtime_error("No optimization method specified");
@@ -139,21 +142,36 @@ void solveMulticutProblem(
     const Parameters& parameters
 )
 {
-    GraphType graph;
+    GraphType input_graph;
     std::vector<double> edge_values;
 
     {
         auto fileHandle = andres::graph::hdf5::openFile(parameters.inputHDF5FileName);
 
-        andres::graph::hdf5::load(fileHandle, "graph", graph);
+        andres::graph::hdf5::load(fileHandle, "graph", input_graph);
 
         std::vector<size_t> shape;
         andres::graph::hdf5::load(fileHandle, "edge-values", shape, edge_values);
 
         andres::graph::hdf5::closeFile(fileHandle);
     }
-    std::cout << "Number of nodes: " << graph.numberOfVertices() << std::endl;
-    std::cout << "Number of edges: " << graph.numberOfEdges() << std::endl;
+    std::cout << "Number of nodes: " << input_graph.numberOfVertices() << std::endl;
+    std::cout << "Number of edges: " << input_graph.numberOfEdges() << std::endl;
+
+    // the problem is solved for the reordered graph, and all outputs are mapped back to the input graph
+    GraphType reordered_graph;
+    andres::graph::Reordering reordering;
+    if (parameters.reorder)
+    {
+        std::vector<size_t> order;
+        andres::graph::reverseCuthillMcKeeOrder(input_graph, order);
+        reorderGraph(input_graph, order, reordered_graph, reordering);
+
+        std::vector<double> reordered_edge_values(edge_values.size());
+        reordering.permuteEdgeValues(edge_values.begin(), reordered_edge_values.begin());
+        edge_values.swap(reordered_edge_values);
+    }
+    const GraphType& graph = parameters.reorder ? reordered_graph : input_graph;
 
     // Solve Multicut problem
     std::vector<char> edge_labels(graph.numberOfEdges());
@@ -184,6 +202,13 @@ void solveMulticutProblem(
         assert(shape.size() == 1);
         assert(shape[0] == graph.numberOfVertices());
 
+        if (parameters.reorder)
+        {
+            std::vector<size_t> reordered_vertex_labels(vertex_labels.size());
+            reordering.permuteVertexValues(vertex_labels.begin(), reordered_vertex_labels.begin());
+            vertex_labels.swap(reordered_vertex_labels);
+        }
+
         edge_labels.resize(graph.numberOfEdges());
         vertexToEdgeLabels(graph, vertex_labels, edge_labels);
     }
@@ -228,7 +253,7 @@ void solveMulticutProblem(
 
         auto file = andres::graph::hdf5::createFile(parameters.outputHDF5FileName);
 
-        andres::graph::hdf5::save(file, "graph", graph);
+        andres::graph::hdf5::save(file, "graph", input_graph);
         andres::graph::hdf5::save(file, "edge-values", { reduced_edge_costs.size() }, reduced_edge_costs.data());
         andres::graph::hdf5::closeFile(file);
 
@@ -247,11 +272,17 @@ void solveMulticutProblem(
 
         auto energy_value = inner_product(edge_values.begin(), edge_values.end(), values.begin(), .0);
 
+        if (parameters.reorder)
+        {
+            auto reordered_values = values;
+            reordering.restoreEdgeValues(reordered_values.begin(), values.begin());
+        }
+
         if (!parameters.outputHDF5FileName.empty())
         {
             auto file = andres::graph::hdf5::createFile(parameters.outputHDF5FileName);
             
-            andres::graph::hdf5::save(file, "graph", graph);
+            andres::graph::hdf5::save(file, "graph", input_graph);
             andres::graph::hdf5::save(file, "energy-value", energy_value);
             andres::graph::hdf5::save(file, "running-time", t.get_elapsed_seconds());
             andres::graph::hdf5::save(file, "labels", { values.size() }, values.data()); // we save directly edge values as given by the LP solution, since the latter is not guaranteed to be integer
@@ -276,9 +307,15 @@ void solveMulticutProblem(
     std::vector<size_t> vertex_labels(graph.numberOfVertices());
     edgeToVertexLabels(graph, edge_labels, vertex_labels);
 
+    if (parameters.reorder)
+    {
+        auto reordered_vertex_labels = vertex_labels;
+        reordering.restoreVertexValues(reordered_vertex_labels.begin(), vertex_labels.begin());
+    }
+
     auto file = andres::graph::hdf5::createFile(parameters.outputHDF5FileName);
 
-    andres::graph::hdf5::save(file, "graph", graph);
+    andres::graph::hdf5::save(file, "graph", input_graph);
     andres::graph::hdf5::save(file, "labels", { vertex_labels.size() }, vertex_labels.data());
     andres::graph::hdf5::save(file, "energy-value", energy_value);
     andres::graph::hdf5::save(file, "running-time", t.get_elapsed_seconds());
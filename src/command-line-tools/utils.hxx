@@ -3,8 +3,10 @@
 #define UTILS_HXX
 
 #include <stack>
+#include <stdexcept>
 #include <vector>
 #include <andres/graph/dfs.hxx>
+#include <andres/graph/reordering.hxx>
 
 template<typename GRAPH, typename VLA, typename ELA>
 inline
@@ -97,4 +99,28 @@ void edgeToVertexLabels(const GRAPH& graph, const ELA& edge_labels, VLA& vertex_
         }
 }
 
+// graphs that are built by insertEdges(), e.g. Graph
+template<typename GRAPH>
+inline
+auto reorderGraph(const GRAPH& graph, const std::vector<std::size_t>& order, GRAPH& reordered_graph, andres::graph::Reordering& reordering, int)
+    -> decltype(reordered_graph.multipleEdgesEnabled() = true, void())
+{
+    andres::graph::reorder(graph, order, reordered_graph, reordering);
+}
+
+// graphs whose vertex numbering is implicit, e.g. GridGraph and CompleteGraph
+template<typename GRAPH>
+inline
+void reorderGraph(const GRAPH&, const std::vector<std::size_t>&, GRAPH&, andres::graph::Reordering&, long)
+{
+    throw std::runtime_error("Reordering is not supported for this type of graph");
+}
+
+template<typename GRAPH>
+inline
+void reorderGraph(const GRAPH& graph, const std::vector<std::size_t>& order, GRAPH& reordered_graph, andres::graph::Reordering& reordering)
+{
+    reorderGraph(graph, order, reordered_graph, reordering, 0);
+}
+
 #endif // #ifndef UTILS_HXX